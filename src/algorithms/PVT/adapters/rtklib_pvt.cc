@@ -534,6 +534,12 @@ bool RtklibPvt::get_latest_PVT(double* longitude_deg,
 }
 
 
+bool RtklibPvt::get_hot_start(Agnss_Hot_Start& hot_start)
+{
+    return pvt_->get_hot_start(hot_start);
+}
+
+
 void RtklibPvt::clear_ephemeris()
 {
     pvt_->clear_ephemeris();
@@ -92,6 +92,8 @@ public:
         double* course_over_ground_deg,
         time_t* UTC_time) override;
 
+    bool get_hot_start(Agnss_Hot_Start& hot_start) override;
+
 private:
     rtklib_pvt_cc_sptr pvt_;
     rtk_t rtk{};
@@ -43,6 +43,7 @@
 #include <gnuradio/gr_complex.h>
 #include <gnuradio/io_signature.h>
 #include <algorithm>
+#include <cmath>
 #include <exception>
 #include <iostream>
 #include <map>
@@ -504,6 +505,8 @@ rtklib_pvt_cc::rtklib_pvt_cc(uint32_t nchannels,
     d_pvt_solver->set_averaging_depth(1);
 
     d_rx_time = 0.0;
+    d_last_clock_offset_s = 0.0;
+    d_last_clock_rx_time_s = 0.0;
 
     d_last_status_print_seg = 0;
 
@@ -904,6 +907,55 @@ bool rtklib_pvt_cc::load_gnss_synchro_map_xml(const std::string& file_name)
 }
 
 
+void rtklib_pvt_cc::update_hot_start(const Gnss_Synchro** in, int32_t epoch)
+{
+    // Keep the channels that reached a valid pseudorange in this epoch. Their
+    // sample stamps are all taken at the same receiver time, so the one of
+    // the latest channel dates the whole set in the session clock.
+    bool any_valid = false;
+    for (uint32_t i = 0; i < d_nchannels; i++)
+        {
+            if (in[i][epoch].Flag_valid_pseudorange and in[i][epoch].fs > 0)
+                {
+                    if (!any_valid)
+                        {
+                            d_hot_start.channels.clear();
+                            d_hot_start.session_time_s = 0.0;
+                            any_valid = true;
+                        }
+                    Agnss_Hot_Start_Channel channel;
+                    channel.system = in[i][epoch].System;
+                    channel.signal[0] = in[i][epoch].Signal[0];
+                    channel.signal[1] = in[i][epoch].Signal[1];
+                    channel.prn = in[i][epoch].PRN;
+                    channel.doppler_hz = in[i][epoch].Carrier_Doppler_hz;
+                    channel.code_phase_s = in[i][epoch].Code_phase_samples / static_cast<double>(in[i][epoch].fs);
+                    channel.sample_stamp = in[i][epoch].Tracking_sample_counter;
+                    channel.fs = in[i][epoch].fs;
+                    channel.cn0_db_hz = in[i][epoch].CN0_dB_hz;
+                    d_hot_start.channels.push_back(channel);
+                    d_hot_start.session_time_s = std::max(d_hot_start.session_time_s, static_cast<double>(channel.sample_stamp) / static_cast<double>(channel.fs));
+                }
+        }
+    if (any_valid)
+        {
+            d_hot_start.save_time_s = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+}
+
+
+bool rtklib_pvt_cc::get_hot_start(Agnss_Hot_Start& hot_start)
+{
+    gr::thread::scoped_lock lock(d_setlock);
+    if (d_hot_start.channels.empty())
+        {
+            return false;
+        }
+    hot_start = d_hot_start;
+    return true;
+}
+
+
 bool rtklib_pvt_cc::get_latest_PVT(double* longitude_deg,
     double* latitude_deg,
     double* height_m,
@@ -1013,6 +1065,8 @@ int rtklib_pvt_cc::work(int noutput_items, gr_vector_const_void_star& input_item
                         }
                 }
 
+            update_hot_start(in, epoch);
+
             // ############ 2 COMPUTE THE PVT ################################
             if (gnss_observables_map.empty() == false)
                 {
@@ -1040,6 +1094,26 @@ int rtklib_pvt_cc::work(int noutput_items, gr_vector_const_void_star& input_item
 
                             if (d_pvt_solver->get_PVT(gnss_observables_map, false))
                                 {
+                                    // Position and receiver clock drift for the next session. The drift is
+                                    // taken from consecutive fixes, discarding the jumps of a solver reset
+                                    double clock_offset_s = d_pvt_solver->get_time_offset_s();
+                                    if (d_last_clock_rx_time_s > 0.0 and d_rx_time > d_last_clock_rx_time_s)
+                                        {
+                                            double drift_ppm = (clock_offset_s - d_last_clock_offset_s) / (d_rx_time - d_last_clock_rx_time_s) * 1e6;
+                                            if (std::abs(drift_ppm) < 1e3)
+                                                {
+                                                    d_hot_start.clock_drift_ppm = drift_ppm;
+                                                    d_hot_start.clock_drift_valid = true;
+                                                }
+                                        }
+                                    d_last_clock_offset_s = clock_offset_s;
+                                    d_last_clock_rx_time_s = d_rx_time;
+                                    arma::vec rx_pos = d_pvt_solver->get_rx_pos();
+                                    d_hot_start.position_ecef_m[0] = rx_pos(0);
+                                    d_hot_start.position_ecef_m[1] = rx_pos(1);
+                                    d_hot_start.position_ecef_m[2] = rx_pos(2);
+                                    d_hot_start.position_valid = true;
+
                                     //Optional debug code: export observables snapshot for rtklib unit testing
                                     //std::cout << "step 1: save gnss_synchro map" << std::endl;
                                     //save_gnss_synchro_map_xml("./gnss_synchro_map.xml");
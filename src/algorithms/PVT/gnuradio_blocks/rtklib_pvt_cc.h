@@ -31,6 +31,7 @@
 #ifndef GNSS_SDR_RTKLIB_PVT_CC_H
 #define GNSS_SDR_RTKLIB_PVT_CC_H
 
+#include "agnss_hot_start.h"
 #include "geojson_printer.h"
 #include "gps_ephemeris.h"
 #include "gpx_printer.h"
@@ -116,6 +117,11 @@ private:
     std::shared_ptr<rtklib_solver> d_pvt_solver;
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
+
+    Agnss_Hot_Start d_hot_start;    // last tracked channels, position and clock drift, for the next session
+    double d_last_clock_offset_s;   // receiver clock offset of the previous fix
+    double d_last_clock_rx_time_s;  // receiver time of the previous fix
+    void update_hot_start(const Gnss_Synchro** in, int32_t epoch);
     bool observables_pairCompare_min(const std::pair<int, Gnss_Synchro>& a, const std::pair<int, Gnss_Synchro>& b);
 
     uint32_t type_of_rx;
@@ -177,6 +183,13 @@ public:
         double* course_over_ground_deg,
         time_t* UTC_time);
 
+    /*!
+     * \brief Get the last tracked channels, position and receiver clock
+     * drift, to be stored for a hot start of the next session. Returns false
+     * if no channel has been tracked yet.
+     */
+    bool get_hot_start(Agnss_Hot_Start& hot_start);
+
     ~rtklib_pvt_cc();  //!< Default destructor
 
     int work(int noutput_items, gr_vector_const_void_star& input_items,
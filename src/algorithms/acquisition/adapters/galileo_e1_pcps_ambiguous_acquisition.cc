@@ -32,6 +32,7 @@
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
 #include "Galileo_E1.h"
 #include "acq_conf.h"
+#include "acq_decimator.h"
 #include "configuration_interface.h"
 #include "galileo_e1_signal_processing.h"
 #include "gnss_sdr_flags.h"
@@ -77,11 +78,19 @@ GalileoE1PcpsAmbiguousAcquisition::GalileoE1PcpsAmbiguousAcquisition(
     use_CFAR_algorithm_flag_ = configuration_->property(role + ".use_CFAR_algorithm", true);  //will be false in future versions
     acq_parameters_.use_CFAR_algorithm_flag = use_CFAR_algorithm_flag_;
     acquire_pilot_ = configuration_->property(role + ".acquire_pilot", false);  //will be true in future versions
+    combine_data_pilot_ = configuration_->property(role + ".combine_data_pilot", false);
+    if (combine_data_pilot_)
+        {
+            acquire_pilot_ = false;  // the data code is the main one, the pilot is added to it
+        }
+    acq_parameters_.combine_data_pilot = combine_data_pilot_;
     max_dwells_ = configuration_->property(role + ".max_dwells", 1);
     acq_parameters_.max_dwells = max_dwells_;
     dump_ = configuration_->property(role + ".dump", false);
     acq_parameters_.dump = dump_;
     acq_parameters_.dump_channel = configuration_->property(role + ".dump_channel", 0);
+    acq_parameters_.dump_queue_size = configuration_->property(role + ".dump_queue_size", 16);
+    acq_parameters_.dump_queue_policy = configuration_->property(role + ".dump_queue_policy", std::string("block"));
     blocking_ = configuration_->property(role + ".blocking", true);
     acq_parameters_.blocking = blocking_;
     dump_filename_ = configuration_->property(role + ".dump_filename", default_dump_filename);
@@ -95,7 +104,13 @@ GalileoE1PcpsAmbiguousAcquisition::GalileoE1PcpsAmbiguousAcquisition(
         }
     if (acq_parameters_.use_automatic_resampler)
         {
-            if (acq_parameters_.fs_in > Galileo_E1_OPT_ACQ_FS_HZ)
+            if (configuration_->property("GNSS-SDR.use_acquisition_decimator", false))
+                {
+                    // Polyphase decimator down to the code resolution, see GNSSFlowgraph::connect()
+                    acq_parameters_.resampler_ratio = Acq_Decimator::choose_decimation(acq_parameters_.fs_in, Galileo_E1_CODE_CHIP_RATE_HZ, 4.0);
+                    acq_parameters_.resampled_fs = acq_parameters_.fs_in / static_cast<int>(acq_parameters_.resampler_ratio);
+                }
+            else if (acq_parameters_.fs_in > Galileo_E1_OPT_ACQ_FS_HZ)
                 {
                     acq_parameters_.resampler_ratio = floor(static_cast<float>(acq_parameters_.fs_in) / Galileo_E1_OPT_ACQ_FS_HZ);
                     uint32_t decimation = acq_parameters_.fs_in / Galileo_E1_OPT_ACQ_FS_HZ;
@@ -140,6 +155,17 @@ GalileoE1PcpsAmbiguousAcquisition::GalileoE1PcpsAmbiguousAcquisition(
     acq_parameters_.num_doppler_bins_step2 = configuration_->property(role + ".second_nbins", 4);
     acq_parameters_.doppler_step2 = configuration_->property(role + ".second_doppler_step", 125.0);
     acq_parameters_.make_2_steps = configuration_->property(role + ".make_two_steps", false);
+    acq_parameters_.peak_interpolation = configuration_->property(role + ".peak_interpolation", std::string("none"));
+    acq_parameters_.peak_interpolation_check = configuration_->property(role + ".peak_interpolation_check", false);
+    acq_parameters_.sequential_detection = configuration_->property(role + ".sequential_detection", false);
+    acq_parameters_.sequential_dismissal_ratio = configuration_->property(role + ".sequential_dismissal_ratio", 0.5);
+    acq_parameters_.fft_doppler_shift = configuration_->property(role + ".fft_doppler_shift", false);
+    acq_parameters_.share_input_spectra = configuration_->property(role + ".share_input_spectra", false);
+    acq_parameters_.fixed_point_wipeoff = configuration_->property(role + ".fixed_point_wipeoff", false);
+    acq_parameters_.doppler_workers = configuration_->property(role + ".doppler_workers", 1);
+    acq_parameters_.use_search_windows = configuration_->property(role + ".use_search_windows", false);
+    acq_parameters_.use_sample_ring = configuration_->property(role + ".use_sample_ring", false);
+    acq_parameters_.warm_up_code_spectra = configuration_->property(role + ".warm_up_code_spectra", false);
     acq_parameters_.blocking_on_standby = configuration_->property(role + ".blocking_on_standby", false);
     acquisition_ = pcps_make_acquisition(acq_parameters_);
     DLOG(INFO) << "acquisition(" << acquisition_->unique_id() << ")";
@@ -180,6 +206,7 @@ void GalileoE1PcpsAmbiguousAcquisition::set_channel(unsigned int channel)
 {
     channel_ = channel;
     acquisition_->set_channel(channel_);
+    acquisition_->set_rf_channel(configuration_->property("Channel" + std::to_string(channel_) + ".RF_channel_ID", 0));
 }
 
 
@@ -237,44 +264,60 @@ signed int GalileoE1PcpsAmbiguousAcquisition::mag()
 void GalileoE1PcpsAmbiguousAcquisition::init()
 {
     acquisition_->init();
-    //set_local_code();
+    if (acq_parameters_.warm_up_code_spectra)
+        {
+            for (uint32_t prn = 1; prn <= 36; prn++)
+                {
+                    acquisition_->warm_up_local_code(code_id(acquire_pilot_), prn, [this](uint32_t code_prn) { return generate_code(code_prn, acquire_pilot_); });
+                    if (combine_data_pilot_)
+                        {
+                            acquisition_->warm_up_local_code(code_id(true), prn, [this](uint32_t code_prn) { return generate_code(code_prn, true); });
+                        }
+                }
+        }
 }
 
 
 void GalileoE1PcpsAmbiguousAcquisition::set_local_code()
+{
+    acquisition_->set_local_code(code_id(acquire_pilot_), gnss_synchro_->PRN, [this](uint32_t prn) { return generate_code(prn, acquire_pilot_); });
+    if (combine_data_pilot_)
+        {
+            acquisition_->set_pilot_local_code(code_id(true), gnss_synchro_->PRN, [this](uint32_t prn) { return generate_code(prn, true); });
+        }
+}
+
+
+std::string GalileoE1PcpsAmbiguousAcquisition::code_id(bool pilot) const
+{
+    bool cboc = configuration_->property(
+        "Acquisition" + std::to_string(channel_) + ".cboc", false);
+    return std::string(pilot ? "1C" : "1B") + (cboc ? "_cboc" : "");
+}
+
+
+const std::complex<float>* GalileoE1PcpsAmbiguousAcquisition::generate_code(uint32_t prn, bool pilot)
 {
     bool cboc = configuration_->property(
         "Acquisition" + std::to_string(channel_) + ".cboc", false);
 
     auto* code = new std::complex<float>[code_length_];
 
-    if (acquire_pilot_ == true)
+    // set local signal generator to Galileo E1 pilot (1C) or data (1B) component
+    char signal[3] = "1B";
+    if (pilot == true)
         {
-            //set local signal generator to Galileo E1 pilot component (1C)
-            char pilot_signal[3] = "1C";
-            if (acq_parameters_.use_automatic_resampler)
-                {
-                    galileo_e1_code_gen_complex_sampled(code, pilot_signal,
-                        cboc, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0, false);
-                }
-            else
-                {
-                    galileo_e1_code_gen_complex_sampled(code, pilot_signal,
-                        cboc, gnss_synchro_->PRN, fs_in_, 0, false);
-                }
+            signal[1] = 'C';
+        }
+    if (acq_parameters_.use_automatic_resampler)
+        {
+            galileo_e1_code_gen_complex_sampled(code, signal,
+                cboc, prn, acq_parameters_.resampled_fs, 0, false);
         }
     else
         {
-            if (acq_parameters_.use_automatic_resampler)
-                {
-                    galileo_e1_code_gen_complex_sampled(code, gnss_synchro_->Signal,
-                        cboc, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0, false);
-                }
-            else
-                {
-                    galileo_e1_code_gen_complex_sampled(code, gnss_synchro_->Signal,
-                        cboc, gnss_synchro_->PRN, fs_in_, 0, false);
-                }
+            galileo_e1_code_gen_complex_sampled(code, signal,
+                cboc, prn, fs_in_, 0, false);
         }
 
 
@@ -283,8 +326,8 @@ void GalileoE1PcpsAmbiguousAcquisition::set_local_code()
             memcpy(&(code_[i * code_length_]), code, sizeof(gr_complex) * code_length_);
         }
 
-    acquisition_->set_local_code(code_);
     delete[] code;
+    return code_;
 }
 
 
@@ -398,3 +441,9 @@ void GalileoE1PcpsAmbiguousAcquisition::set_resampler_latency(uint32_t latency_s
 {
     acquisition_->set_resampler_latency(latency_samples);
 }
+
+
+bool GalileoE1PcpsAmbiguousAcquisition::set_sample_ring(const std::string& ring_key)
+{
+    return acquisition_->set_sample_ring(ring_key);
+}
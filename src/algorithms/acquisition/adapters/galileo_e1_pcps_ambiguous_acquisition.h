@@ -144,6 +144,8 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples) override;
 
+    bool set_sample_ring(const std::string& ring_key) override;
+
 
 private:
     ConfigurationInterface* configuration_;
@@ -158,6 +160,7 @@ private:
     bool bit_transition_flag_;
     bool use_CFAR_algorithm_flag_;
     bool acquire_pilot_;
+    bool combine_data_pilot_;
     unsigned int channel_;
     float threshold_;
     unsigned int doppler_max_;
@@ -174,6 +177,9 @@ private:
     unsigned int in_streams_;
     unsigned int out_streams_;
     float calculate_threshold(float pfa);
+
+    std::string code_id(bool pilot) const;
+    const std::complex<float>* generate_code(uint32_t prn, bool pilot);
 };
 
 #endif /* GNSS_SDR_GALILEO_E1_PCPS_AMBIGUOUS_ACQUISITION_H_ */
@@ -255,23 +255,23 @@ void GalileoE1PcpsQuickSyncAmbiguousAcquisition::set_local_code()
             bool cboc = configuration_->property(
                 "Acquisition" + std::to_string(channel_) + ".cboc", false);
 
-            auto* code = new std::complex<float>[code_length_];
+            std::string code_id = std::string(gnss_synchro_->Signal, 2) + (cboc ? "_cboc" : "");
+            acquisition_cc_->set_local_code(code_id, gnss_synchro_->PRN, [this, cboc](uint32_t prn) -> const std::complex<float>* {
+                auto* code = new std::complex<float>[code_length_];
 
-            galileo_e1_code_gen_complex_sampled(code, gnss_synchro_->Signal,
-                cboc, gnss_synchro_->PRN, fs_in_, 0, false);
+                galileo_e1_code_gen_complex_sampled(code, gnss_synchro_->Signal,
+                    cboc, prn, fs_in_, 0, false);
 
 
-            for (unsigned int i = 0; i < (sampled_ms_ / (folding_factor_ * 4)); i++)
-                {
-                    memcpy(&(code_[i * code_length_]), code,
-                        sizeof(gr_complex) * code_length_);
-                }
-
-            // memcpy(code_, code,sizeof(gr_complex)*code_length_);
-            acquisition_cc_->set_local_code(code_);
+                for (unsigned int i = 0; i < (sampled_ms_ / (folding_factor_ * 4)); i++)
+                    {
+                        memcpy(&(code_[i * code_length_]), code,
+                            sizeof(gr_complex) * code_length_);
+                    }
 
-            delete[] code;
-            code = nullptr;
+                delete[] code;
+                return code_;
+            });
         }
 }
 
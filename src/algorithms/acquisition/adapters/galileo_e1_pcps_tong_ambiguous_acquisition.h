@@ -136,6 +136,8 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples __attribute__((unused))) override{};
 
+    bool set_sample_ring(const std::string& ring_key __attribute__((unused))) override { return false; };
+
 private:
     ConfigurationInterface* configuration_;
     pcps_tong_acquisition_cc_sptr acquisition_cc_;
@@ -31,6 +31,7 @@
 #include "galileo_e5a_pcps_acquisition.h"
 #include "Galileo_E5a.h"
 #include "acq_conf.h"
+#include "acq_decimator.h"
 #include "configuration_interface.h"
 #include "galileo_e5_signal_processing.h"
 #include "gnss_sdr_flags.h"
@@ -66,9 +67,22 @@ GalileoE5aPcpsAcquisition::GalileoE5aPcpsAcquisition(ConfigurationInterface* con
         {
             acq_pilot_ = false;
         }
+    combine_data_pilot_ = configuration_->property(role + ".combine_data_pilot", false);
+    if (combine_data_pilot_ and acq_iq_)
+        {
+            LOG(WARNING) << "Galileo E5a acquisition: acquire_iq already uses both components, combine_data_pilot ignored";
+            combine_data_pilot_ = false;
+        }
+    if (combine_data_pilot_)
+        {
+            acq_pilot_ = false;  // the data code is the main one, the pilot is added to it
+        }
+    acq_parameters_.combine_data_pilot = combine_data_pilot_;
     dump_ = configuration_->property(role + ".dump", false);
     acq_parameters_.dump = dump_;
     acq_parameters_.dump_channel = configuration_->property(role + ".dump_channel", 0);
+    acq_parameters_.dump_queue_size = configuration_->property(role + ".dump_queue_size", 16);
+    acq_parameters_.dump_queue_policy = configuration_->property(role + ".dump_queue_policy", std::string("block"));
     doppler_max_ = configuration_->property(role + ".doppler_max", 5000);
     if (FLAGS_doppler_max != 0) doppler_max_ = FLAGS_doppler_max;
     acq_parameters_.doppler_max = doppler_max_;
@@ -93,7 +107,13 @@ GalileoE5aPcpsAcquisition::GalileoE5aPcpsAcquisition(ConfigurationInterface* con
         }
     if (acq_parameters_.use_automatic_resampler)
         {
-            if (acq_parameters_.fs_in > Galileo_E5a_OPT_ACQ_FS_HZ)
+            if (configuration_->property("GNSS-SDR.use_acquisition_decimator", false))
+                {
+                    // Polyphase decimator down to the code resolution, see GNSSFlowgraph::connect()
+                    acq_parameters_.resampler_ratio = Acq_Decimator::choose_decimation(acq_parameters_.fs_in, Galileo_E5a_CODE_CHIP_RATE_HZ);
+                    acq_parameters_.resampled_fs = acq_parameters_.fs_in / static_cast<int>(acq_parameters_.resampler_ratio);
+                }
+            else if (acq_parameters_.fs_in > Galileo_E5a_OPT_ACQ_FS_HZ)
                 {
                     acq_parameters_.resampler_ratio = floor(static_cast<float>(acq_parameters_.fs_in) / Galileo_E5a_OPT_ACQ_FS_HZ);
                     uint32_t decimation = acq_parameters_.fs_in / Galileo_E5a_OPT_ACQ_FS_HZ;
@@ -145,6 +165,17 @@ GalileoE5aPcpsAcquisition::GalileoE5aPcpsAcquisition(ConfigurationInterface* con
     acq_parameters_.num_doppler_bins_step2 = configuration_->property(role + ".second_nbins", 4);
     acq_parameters_.doppler_step2 = configuration_->property(role + ".second_doppler_step", 125.0);
     acq_parameters_.make_2_steps = configuration_->property(role + ".make_two_steps", false);
+    acq_parameters_.peak_interpolation = configuration_->property(role + ".peak_interpolation", std::string("none"));
+    acq_parameters_.peak_interpolation_check = configuration_->property(role + ".peak_interpolation_check", false);
+    acq_parameters_.sequential_detection = configuration_->property(role + ".sequential_detection", false);
+    acq_parameters_.sequential_dismissal_ratio = configuration_->property(role + ".sequential_dismissal_ratio", 0.5);
+    acq_parameters_.fft_doppler_shift = configuration_->property(role + ".fft_doppler_shift", false);
+    acq_parameters_.share_input_spectra = configuration_->property(role + ".share_input_spectra", false);
+    acq_parameters_.fixed_point_wipeoff = configuration_->property(role + ".fixed_point_wipeoff", false);
+    acq_parameters_.doppler_workers = configuration_->property(role + ".doppler_workers", 1);
+    acq_parameters_.use_search_windows = configuration_->property(role + ".use_search_windows", false);
+    acq_parameters_.use_sample_ring = configuration_->property(role + ".use_sample_ring", false);
+    acq_parameters_.warm_up_code_spectra = configuration_->property(role + ".warm_up_code_spectra", false);
     acq_parameters_.blocking_on_standby = configuration_->property(role + ".blocking_on_standby", false);
     acquisition_ = pcps_make_acquisition(acq_parameters_);
 
@@ -178,6 +209,7 @@ void GalileoE5aPcpsAcquisition::set_channel(unsigned int channel)
 {
     channel_ = channel;
     acquisition_->set_channel(channel_);
+    acquisition_->set_rf_channel(configuration_->property("Channel" + std::to_string(channel_) + ".RF_channel_ID", 0));
 }
 
 
@@ -236,34 +268,57 @@ signed int GalileoE5aPcpsAcquisition::mag()
 void GalileoE5aPcpsAcquisition::init()
 {
     acquisition_->init();
+    if (acq_parameters_.warm_up_code_spectra)
+        {
+            for (uint32_t prn = 1; prn <= 36; prn++)
+                {
+                    acquisition_->warm_up_local_code(code_id(acq_pilot_), prn, [this](uint32_t code_prn) { return generate_code(code_prn, acq_pilot_); });
+                    if (combine_data_pilot_)
+                        {
+                            acquisition_->warm_up_local_code(code_id(true), prn, [this](uint32_t code_prn) { return generate_code(code_prn, true); });
+                        }
+                }
+        }
 }
 
 
 void GalileoE5aPcpsAcquisition::set_local_code()
 {
-    auto* code = new gr_complex[code_length_];
-    char signal_[3];
-
-    if (acq_iq_)
+    acquisition_->set_local_code(code_id(acq_pilot_), gnss_synchro_->PRN, [this](uint32_t prn) { return generate_code(prn, acq_pilot_); });
+    if (combine_data_pilot_)
         {
-            strcpy(signal_, "5X");
+            acquisition_->set_pilot_local_code(code_id(true), gnss_synchro_->PRN, [this](uint32_t prn) { return generate_code(prn, true); });
         }
-    else if (acq_pilot_)
+}
+
+
+std::string GalileoE5aPcpsAcquisition::code_id(bool pilot) const
+{
+    if (acq_iq_)
         {
-            strcpy(signal_, "5Q");
+            return std::string("5X");
         }
-    else
+    if (pilot)
         {
-            strcpy(signal_, "5I");
+            return std::string("5Q");
         }
+    return std::string("5I");
+}
+
+
+const std::complex<float>* GalileoE5aPcpsAcquisition::generate_code(uint32_t prn, bool pilot)
+{
+    auto* code = new gr_complex[code_length_];
+    char signal_[3];
+    strcpy(signal_, code_id(pilot).c_str());
 
     if (acq_parameters_.use_automatic_resampler)
         {
-            galileo_e5_a_code_gen_complex_sampled(code, signal_, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0);
+            galileo_e5_a_code_gen_complex_sampled(code, signal_, prn, acq_parameters_.resampled_fs, 0);
         }
     else
         {
-            galileo_e5_a_code_gen_complex_sampled(code, signal_, gnss_synchro_->PRN, fs_in_, 0);
+            galileo_e5_a_code_gen_complex_sampled(code, signal_, prn, fs_in_, 0);
         }
 
     for (unsigned int i = 0; i < sampled_ms_; i++)
@@ -271,8 +326,8 @@ void GalileoE5aPcpsAcquisition::set_local_code()
             memcpy(code_ + (i * code_length_), code, sizeof(gr_complex) * code_length_);
         }
 
-    acquisition_->set_local_code(code_);
     delete[] code;
+    return code_;
 }
 
 
@@ -356,3 +411,9 @@ void GalileoE5aPcpsAcquisition::set_resampler_latency(uint32_t latency_samples)
 {
     acquisition_->set_resampler_latency(latency_samples);
 }
+
+
+bool GalileoE5aPcpsAcquisition::set_sample_ring(const std::string& ring_key)
+{
+    return acquisition_->set_sample_ring(ring_key);
+}
@@ -134,9 +134,14 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples) override;
 
+    bool set_sample_ring(const std::string& ring_key) override;
+
 private:
     float calculate_threshold(float pfa);
 
+    std::string code_id(bool pilot) const;
+    const std::complex<float>* generate_code(uint32_t prn, bool pilot);
+
     ConfigurationInterface* configuration_;
 
     pcps_acquisition_sptr acquisition_;
@@ -153,6 +158,7 @@ private:
     bool use_CFAR_;
     bool blocking_;
     bool acq_iq_;
+    bool combine_data_pilot_;
 
     unsigned int vector_length_;
     unsigned int code_length_;
@@ -35,6 +35,7 @@
 #include "GLONASS_L1_L2_CA.h"
 #include "acq_conf.h"
 #include "configuration_interface.h"
+#include "glonass_fdma_channelizer.h"
 #include "glonass_l1_signal_processing.h"
 #include "gnss_sdr_flags.h"
 #include <boost/math/distributions/exponential.hpp>
@@ -63,11 +64,25 @@ GlonassL1CaPcpsAcquisition::GlonassL1CaPcpsAcquisition(
 
     int64_t fs_in_deprecated = configuration_->property("GNSS-SDR.internal_fs_hz", 2048000);
     fs_in_ = configuration_->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+    // With the FDMA channelizer, the channel receives its sub-band already at baseband and decimated
+    acq_parameters.fdma_channelized = configuration_->property("GNSS-SDR.GLONASS_FDMA_channelizer", false);
+    if (acq_parameters.fdma_channelized)
+        {
+            fs_in_ = Glonass_Fdma_Channelizer::output_rate(GLONASS_L1_CA_DFREQ_HZ);
+            if (item_type_ != "gr_complex")
+                {
+                    // The sub-band selector only delivers gr_complex samples
+                    LOG(WARNING) << item_type_ << " acquisition item type is not supported with the GLONASS FDMA channelizer. Using gr_complex";
+                    item_type_ = "gr_complex";
+                }
+        }
     acq_parameters.fs_in = fs_in_;
     acq_parameters.samples_per_chip = static_cast<unsigned int>(ceil(GLONASS_L1_CA_CHIP_PERIOD * static_cast<float>(acq_parameters.fs_in)));
     dump_ = configuration_->property(role + ".dump", false);
     acq_parameters.dump = dump_;
     acq_parameters.dump_channel = configuration_->property(role + ".dump_channel", 0);
+    acq_parameters.dump_queue_size = configuration_->property(role + ".dump_queue_size", 16);
+    acq_parameters.dump_queue_policy = configuration_->property(role + ".dump_queue_policy", std::string("block"));
     blocking_ = configuration_->property(role + ".blocking", true);
     acq_parameters.blocking = blocking_;
     doppler_max_ = configuration_->property(role + ".doppler_max", 5000);
@@ -111,6 +126,16 @@ GlonassL1CaPcpsAcquisition::GlonassL1CaPcpsAcquisition(
     acq_parameters.num_doppler_bins_step2 = configuration_->property(role + ".second_nbins", 4);
     acq_parameters.doppler_step2 = configuration_->property(role + ".second_doppler_step", 125.0);
     acq_parameters.make_2_steps = configuration_->property(role + ".make_two_steps", false);
+    acq_parameters.peak_interpolation = configuration_->property(role + ".peak_interpolation", std::string("none"));
+    acq_parameters.peak_interpolation_check = configuration_->property(role + ".peak_interpolation_check", false);
+    acq_parameters.sequential_detection = configuration_->property(role + ".sequential_detection", false);
+    acq_parameters.sequential_dismissal_ratio = configuration_->property(role + ".sequential_dismissal_ratio", 0.5);
+    acq_parameters.fft_doppler_shift = configuration_->property(role + ".fft_doppler_shift", false);
+    acq_parameters.share_input_spectra = configuration_->property(role + ".share_input_spectra", false);
+    acq_parameters.fixed_point_wipeoff = configuration_->property(role + ".fixed_point_wipeoff", false);
+    acq_parameters.doppler_workers = configuration_->property(role + ".doppler_workers", 1);
+    acq_parameters.use_search_windows = configuration_->property(role + ".use_search_windows", false);
+    acq_parameters.use_sample_ring = configuration_->property(role + ".use_sample_ring", false) and !acq_parameters.fdma_channelized;
     acq_parameters.blocking_on_standby = configuration_->property(role + ".blocking_on_standby", false);
     acquisition_ = pcps_make_acquisition(acq_parameters);
     DLOG(INFO) << "acquisition(" << acquisition_->unique_id() << ")";
@@ -151,6 +176,7 @@ void GlonassL1CaPcpsAcquisition::set_channel(unsigned int channel)
 {
     channel_ = channel;
     acquisition_->set_channel(channel_);
+    acquisition_->set_rf_channel(configuration_->property("Channel" + std::to_string(channel_) + ".RF_channel_ID", 0));
 }
 
 
@@ -212,6 +238,13 @@ void GlonassL1CaPcpsAcquisition::init()
 
 
 void GlonassL1CaPcpsAcquisition::set_local_code()
+{
+    // FDMA: all the satellites share the same code, so it is cached as PRN 0
+    acquisition_->set_local_code("1G", 0, [this](uint32_t prn) { return generate_code(prn); });
+}
+
+
+const std::complex<float>* GlonassL1CaPcpsAcquisition::generate_code(uint32_t prn __attribute__((unused)))
 {
     auto* code = new std::complex<float>[code_length_];
 
@@ -223,8 +256,8 @@ void GlonassL1CaPcpsAcquisition::set_local_code()
                 sizeof(gr_complex) * code_length_);
         }
 
-    acquisition_->set_local_code(code_);
     delete[] code;
+    return code_;
 }
 
 
@@ -337,3 +370,9 @@ gr::basic_block_sptr GlonassL1CaPcpsAcquisition::get_right_block()
 {
     return acquisition_;
 }
+
+
+bool GlonassL1CaPcpsAcquisition::set_sample_ring(const std::string& ring_key)
+{
+    return acquisition_->set_sample_ring(ring_key);
+}
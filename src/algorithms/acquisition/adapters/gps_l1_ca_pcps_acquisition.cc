@@ -36,6 +36,7 @@
 #include "gps_l1_ca_pcps_acquisition.h"
 #include "GPS_L1_CA.h"
 #include "acq_conf.h"
+#include "acq_decimator.h"
 #include "configuration_interface.h"
 #include "gnss_sdr_flags.h"
 #include "gps_sdr_signal_processing.h"
@@ -67,6 +68,8 @@ GpsL1CaPcpsAcquisition::GpsL1CaPcpsAcquisition(
     dump_ = configuration_->property(role + ".dump", false);
     acq_parameters_.dump = dump_;
     acq_parameters_.dump_channel = configuration_->property(role + ".dump_channel", 0);
+    acq_parameters_.dump_queue_size = configuration_->property(role + ".dump_queue_size", 16);
+    acq_parameters_.dump_queue_policy = configuration_->property(role + ".dump_queue_policy", std::string("block"));
     blocking_ = configuration_->property(role + ".blocking", true);
     acq_parameters_.blocking = blocking_;
     doppler_max_ = configuration_->property(role + ".doppler_max", 5000);
@@ -86,6 +89,17 @@ GpsL1CaPcpsAcquisition::GpsL1CaPcpsAcquisition(
     acq_parameters_.num_doppler_bins_step2 = configuration_->property(role + ".second_nbins", 4);
     acq_parameters_.doppler_step2 = configuration_->property(role + ".second_doppler_step", 125.0);
     acq_parameters_.make_2_steps = configuration_->property(role + ".make_two_steps", false);
+    acq_parameters_.peak_interpolation = configuration_->property(role + ".peak_interpolation", std::string("none"));
+    acq_parameters_.peak_interpolation_check = configuration_->property(role + ".peak_interpolation_check", false);
+    acq_parameters_.sequential_detection = configuration_->property(role + ".sequential_detection", false);
+    acq_parameters_.sequential_dismissal_ratio = configuration_->property(role + ".sequential_dismissal_ratio", 0.5);
+    acq_parameters_.fft_doppler_shift = configuration_->property(role + ".fft_doppler_shift", false);
+    acq_parameters_.share_input_spectra = configuration_->property(role + ".share_input_spectra", false);
+    acq_parameters_.fixed_point_wipeoff = configuration_->property(role + ".fixed_point_wipeoff", false);
+    acq_parameters_.doppler_workers = configuration_->property(role + ".doppler_workers", 1);
+    acq_parameters_.use_search_windows = configuration_->property(role + ".use_search_windows", false);
+    acq_parameters_.use_sample_ring = configuration_->property(role + ".use_sample_ring", false);
+    acq_parameters_.warm_up_code_spectra = configuration_->property(role + ".warm_up_code_spectra", false);
     acq_parameters_.use_automatic_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
     if (acq_parameters_.use_automatic_resampler == true and item_type_ != "gr_complex")
         {
@@ -94,7 +108,13 @@ GpsL1CaPcpsAcquisition::GpsL1CaPcpsAcquisition(
         }
     if (acq_parameters_.use_automatic_resampler)
         {
-            if (acq_parameters_.fs_in > GPS_L1_CA_OPT_ACQ_FS_HZ)
+            if (configuration_->property("GNSS-SDR.use_acquisition_decimator", false))
+                {
+                    // Polyphase decimator down to the code resolution, see GNSSFlowgraph::connect()
+                    acq_parameters_.resampler_ratio = Acq_Decimator::choose_decimation(acq_parameters_.fs_in, GPS_L1_CA_CODE_RATE_HZ);
+                    acq_parameters_.resampled_fs = acq_parameters_.fs_in / static_cast<int>(acq_parameters_.resampler_ratio);
+                }
+            else if (acq_parameters_.fs_in > GPS_L1_CA_OPT_ACQ_FS_HZ)
                 {
                     acq_parameters_.resampler_ratio = floor(static_cast<float>(acq_parameters_.fs_in) / GPS_L1_CA_OPT_ACQ_FS_HZ);
                     uint32_t decimation = acq_parameters_.fs_in / GPS_L1_CA_OPT_ACQ_FS_HZ;
@@ -173,6 +193,7 @@ void GpsL1CaPcpsAcquisition::set_channel(unsigned int channel)
 {
     channel_ = channel;
     acquisition_->set_channel(channel_);
+    acquisition_->set_rf_channel(configuration_->property("Channel" + std::to_string(channel_) + ".RF_channel_ID", 0));
 }
 
 
@@ -228,20 +249,33 @@ signed int GpsL1CaPcpsAcquisition::mag()
 void GpsL1CaPcpsAcquisition::init()
 {
     acquisition_->init();
+    if (acq_parameters_.warm_up_code_spectra)
+        {
+            for (uint32_t prn = 1; prn <= 32; prn++)
+                {
+                    acquisition_->warm_up_local_code("1C", prn, [this](uint32_t code_prn) { return generate_code(code_prn); });
+                }
+        }
 }
 
 
 void GpsL1CaPcpsAcquisition::set_local_code()
+{
+    acquisition_->set_local_code("1C", gnss_synchro_->PRN, [this](uint32_t prn) { return generate_code(prn); });
+}
+
+
+const std::complex<float>* GpsL1CaPcpsAcquisition::generate_code(uint32_t prn)
 {
     auto* code = new std::complex<float>[code_length_];
 
     if (acq_parameters_.use_automatic_resampler)
         {
-            gps_l1_ca_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0);
+            gps_l1_ca_code_gen_complex_sampled(code, prn, acq_parameters_.resampled_fs, 0);
         }
     else
         {
-            gps_l1_ca_code_gen_complex_sampled(code, gnss_synchro_->PRN, fs_in_, 0);
+            gps_l1_ca_code_gen_complex_sampled(code, prn, fs_in_, 0);
         }
     for (unsigned int i = 0; i < sampled_ms_; i++)
         {
@@ -249,8 +283,8 @@ void GpsL1CaPcpsAcquisition::set_local_code()
                 sizeof(gr_complex) * code_length_);
         }
 
-    acquisition_->set_local_code(code_);
     delete[] code;
+    return code_;
 }
 
 
@@ -363,3 +397,9 @@ void GpsL1CaPcpsAcquisition::set_resampler_latency(uint32_t latency_samples)
 {
     acquisition_->set_resampler_latency(latency_samples);
 }
+
+
+bool GpsL1CaPcpsAcquisition::set_sample_ring(const std::string& ring_key)
+{
+    return acquisition_->set_sample_ring(ring_key);
+}
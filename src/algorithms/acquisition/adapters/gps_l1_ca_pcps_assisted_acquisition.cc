@@ -160,8 +160,10 @@ void GpsL1CaPcpsAssistedAcquisition::init()
 
 void GpsL1CaPcpsAssistedAcquisition::set_local_code()
 {
-    gps_l1_ca_code_gen_complex_sampled(code_, gnss_synchro_->PRN, fs_in_, 0);
-    acquisition_cc_->set_local_code(code_);
+    acquisition_cc_->set_local_code("1C", gnss_synchro_->PRN, [this](uint32_t prn) -> const std::complex<float>* {
+        gps_l1_ca_code_gen_complex_sampled(code_, prn, fs_in_, 0);
+        return code_;
+    });
 }
 
 void GpsL1CaPcpsAssistedAcquisition::reset()
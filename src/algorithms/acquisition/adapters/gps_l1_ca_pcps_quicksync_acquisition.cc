@@ -246,20 +246,20 @@ void GpsL1CaPcpsQuickSyncAcquisition::set_local_code()
 {
     if (item_type_ == "gr_complex")
         {
-            auto* code = new std::complex<float>[code_length_]();
+            acquisition_cc_->set_local_code("1C", gnss_synchro_->PRN, [this](uint32_t prn) -> const std::complex<float>* {
+                auto* code = new std::complex<float>[code_length_]();
 
-            gps_l1_ca_code_gen_complex_sampled(code, gnss_synchro_->PRN, fs_in_, 0);
+                gps_l1_ca_code_gen_complex_sampled(code, prn, fs_in_, 0);
 
-            for (unsigned int i = 0; i < (sampled_ms_ / folding_factor_); i++)
-                {
-                    memcpy(&(code_[i * code_length_]), code,
-                        sizeof(gr_complex) * code_length_);
-                }
-
-            //memcpy(code_, code,sizeof(gr_complex)*code_length_);
-            acquisition_cc_->set_local_code(code_);
+                for (unsigned int i = 0; i < (sampled_ms_ / folding_factor_); i++)
+                    {
+                        memcpy(&(code_[i * code_length_]), code,
+                            sizeof(gr_complex) * code_length_);
+                    }
 
-            delete[] code;
+                delete[] code;
+                return code_;
+            });
         }
 }
 
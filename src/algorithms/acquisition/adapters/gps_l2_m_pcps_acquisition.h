@@ -145,6 +145,8 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples) override;
 
+    bool set_sample_ring(const std::string& ring_key) override;
+
 
 private:
     ConfigurationInterface* configuration_;
@@ -175,6 +177,8 @@ private:
     unsigned int num_codes_;
 
     float calculate_threshold(float pfa);
+
+    const std::complex<float>* generate_code(uint32_t prn);
 };
 
 #endif /* GNSS_SDR_GPS_L2_M_PCPS_ACQUISITION_H_ */
@@ -145,6 +145,8 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples) override;
 
+    bool set_sample_ring(const std::string& ring_key) override;
+
 private:
     ConfigurationInterface* configuration_;
     pcps_acquisition_sptr acquisition_;
@@ -174,6 +176,8 @@ private:
     unsigned int out_streams_;
 
     float calculate_threshold(float pfa);
+
+    const std::complex<float>* generate_code(uint32_t prn, bool pilot);
 };
 
 #endif /* GNSS_SDR_GPS_L5i_PCPS_ACQUISITION_H_ */
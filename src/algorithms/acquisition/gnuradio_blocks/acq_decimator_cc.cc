@@ -0,0 +1,74 @@
+/*!
+ * \file acq_decimator_cc.cc
+ * \brief GNU Radio block that decimates the input of the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_decimator_cc.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+
+
+acq_decimator_cc_sptr acq_make_decimator_cc(uint32_t decimation)
+{
+    return acq_decimator_cc_sptr(new acq_decimator_cc(decimation));
+}
+
+
+acq_decimator_cc::acq_decimator_cc(uint32_t decimation) : gr::block("acq_decimator_cc",
+                                                              gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                                                              gr::io_signature::make(1, 1, sizeof(gr_complex))),
+                                                          d_decimator(decimation)
+{
+    set_relative_rate(1.0 / static_cast<double>(decimation));
+    LOG(INFO) << "Acquisition decimator with " << d_decimator.taps().size() << " taps and decimation factor of " << decimation;
+}
+
+
+void acq_decimator_cc::forecast(int noutput_items, gr_vector_int &ninput_items_required)
+{
+    ninput_items_required[0] = noutput_items * static_cast<int>(d_decimator.decimation());
+}
+
+
+int acq_decimator_cc::general_work(int noutput_items, gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    // Whole decimation periods only, so that every call produces at most
+    // one output sample per period consumed
+    const auto decimation = static_cast<int>(d_decimator.decimation());
+    int periods = std::min(noutput_items, ninput_items[0] / decimation);
+    if (periods == 0)
+        {
+            return 0;
+        }
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+    uint32_t produced = d_decimator.filter(in, periods * decimation, out);
+    consume_each(periods * decimation);
+    return static_cast<int>(produced);
+}
@@ -0,0 +1,65 @@
+/*!
+ * \file acq_decimator_cc.h
+ * \brief GNU Radio block that decimates the input of the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_DECIMATOR_CC_H_
+#define GNSS_SDR_ACQ_DECIMATOR_CC_H_
+
+#include "acq_decimator.h"
+#include <boost/shared_ptr.hpp>
+#include <gnuradio/block.h>
+#include <cstdint>
+
+
+class acq_decimator_cc;
+
+typedef boost::shared_ptr<acq_decimator_cc> acq_decimator_cc_sptr;
+
+acq_decimator_cc_sptr acq_make_decimator_cc(uint32_t decimation);
+
+/*!
+ * \brief Implementation of a GNU Radio block that wraps an Acq_Decimator.
+ * Output sample n corresponds to input sample n * decimation, so the
+ * acquisition blocks fed by it see no filter latency.
+ */
+class acq_decimator_cc : public gr::block
+{
+public:
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
+
+private:
+    friend acq_decimator_cc_sptr acq_make_decimator_cc(uint32_t decimation);
+    acq_decimator_cc(uint32_t decimation);
+
+    Acq_Decimator d_decimator;
+};
+
+#endif
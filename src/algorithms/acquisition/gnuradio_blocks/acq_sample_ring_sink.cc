@@ -0,0 +1,75 @@
+/*!
+ * \file acq_sample_ring_sink.cc
+ * \brief GNU Radio sink that feeds an acquisition sample ring
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_sample_ring_sink.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+
+
+acq_sample_ring_sink_sptr acq_make_sample_ring_sink(const std::string& ring_key, size_t item_size)
+{
+    return acq_sample_ring_sink_sptr(new acq_sample_ring_sink(ring_key, item_size));
+}
+
+
+acq_sample_ring_sink::acq_sample_ring_sink(const std::string& ring_key, size_t item_size) : gr::sync_block("acq_sample_ring_sink",
+                                                                                              gr::io_signature::make(1, 1, item_size),
+                                                                                              gr::io_signature::make(0, 0, 0))
+{
+    // The acquisition blocks grow the ring to the length of their snapshots
+    d_ring = Acq_Sample_Ring_Registry::instance().get(ring_key, item_size, 1);
+    if (d_ring == nullptr)
+        {
+            throw std::runtime_error("Sample ring " + ring_key + " already exists with another item size");
+        }
+}
+
+
+bool acq_sample_ring_sink::start()
+{
+    d_ring->reopen();
+    return true;
+}
+
+
+bool acq_sample_ring_sink::stop()
+{
+    // Do not leave acquisition blocks waiting for samples that will never arrive
+    d_ring->close();
+    return true;
+}
+
+
+int acq_sample_ring_sink::work(int noutput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items __attribute__((unused)))
+{
+    d_ring->write(input_items[0], static_cast<uint64_t>(noutput_items));
+    return noutput_items;
+}
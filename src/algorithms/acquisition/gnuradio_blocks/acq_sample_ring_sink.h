@@ -0,0 +1,67 @@
+/*!
+ * \file acq_sample_ring_sink.h
+ * \brief GNU Radio sink that feeds an acquisition sample ring
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SAMPLE_RING_SINK_H_
+#define GNSS_SDR_ACQ_SAMPLE_RING_SINK_H_
+
+#include "acq_sample_ring.h"
+#include <boost/shared_ptr.hpp>
+#include <gnuradio/sync_block.h>
+#include <memory>
+#include <string>
+
+
+class acq_sample_ring_sink;
+
+typedef boost::shared_ptr<acq_sample_ring_sink> acq_sample_ring_sink_sptr;
+
+acq_sample_ring_sink_sptr acq_make_sample_ring_sink(const std::string& ring_key, size_t item_size);
+
+/*!
+ * \brief This class implements the single reader of a signal conditioner
+ * (or acquisition resampler) output that stores the samples in a shared
+ * Acq_Sample_Ring. The acquisition blocks attached to the ring take their
+ * snapshots from it instead of being connected to the stream themselves.
+ */
+class acq_sample_ring_sink : public gr::sync_block
+{
+private:
+    friend acq_sample_ring_sink_sptr acq_make_sample_ring_sink(const std::string& ring_key, size_t item_size);
+    acq_sample_ring_sink(const std::string& ring_key, size_t item_size);
+    std::shared_ptr<Acq_Sample_Ring> d_ring;
+
+public:
+    bool start();
+    bool stop();
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+};
+
+#endif
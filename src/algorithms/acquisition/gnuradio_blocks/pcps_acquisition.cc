@@ -36,12 +36,17 @@
 #include "pcps_acquisition.h"
 #include "GLONASS_L1_L2_CA.h"  // for GLONASS_TWO_PI
 #include "GPS_L1_CA.h"         // for GPS_TWO_PI
+#include "acq_shared_engine.h"
+#include "acq_worker_pool.h"
+#include "gnss_frequencies.h"
 #include "gnss_sdr_create_directory.h"
 #include <boost/filesystem/path.hpp>
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <matio.h>
 #include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 
 
@@ -54,7 +59,7 @@ pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_)
 
 
 pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acquisition",
-                                                                gr::io_signature::make(1, 1, conf_.it_size),
+                                                                gr::io_signature::make(conf_.use_sample_ring ? 0 : 1, 1, conf_.it_size),
                                                                 gr::io_signature::make(0, 0, conf_.it_size))
 {
     this->message_port_register_out(pmt::mp("events"));
@@ -79,11 +84,24 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
     d_mag = 0;
     d_input_power = 0.0;
     d_num_doppler_bins = 0U;
+    d_full_num_doppler_bins = 0U;
+    d_magnitude_grid_rows = 0U;
+    d_doppler_center = 0;
+    d_doppler_window = acq_parameters.doppler_max;
+    d_use_code_phase_mask = false;
+    d_search_window_narrowed = false;
+    d_failed_window_system = 0;
+    d_failed_window_prn = 0U;
+    d_failed_window_time_s = 0.0;
+    d_ring_stop = false;
+    d_ring_resync = true;
+    d_ring_next_sample = 0ULL;
     d_threshold = 0.0;
     d_doppler_step = 0U;
     d_doppler_center_step_two = 0.0;
     d_test_statistics = 0.0;
     d_channel = 0U;
+    d_rf_channel = 0;
     if (conf_.it_size == sizeof(gr_complex))
         {
             d_cshort = false;
@@ -111,19 +129,111 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
 
     d_tmp_buffer = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
     d_fft_codes = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_fft_size * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
+    d_fft_codes_pilot = nullptr;
+    if (acq_parameters.combine_data_pilot)
+        {
+            d_fft_codes_pilot = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_fft_size * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
+            std::fill_n(d_fft_codes_pilot, d_fft_size, gr_complex(0.0, 0.0));
+        }
     d_magnitude = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
+    d_code_phase_mask = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
     d_input_signal = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_fft_size * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
+    if (acq_parameters.use_automatic_resampler)
+        {
+            d_fft_bin_hz = static_cast<double>(acq_parameters.resampled_fs) / static_cast<double>(d_fft_size);
+        }
+    else
+        {
+            d_fft_bin_hz = static_cast<double>(acq_parameters.fs_in) / static_cast<double>(d_fft_size);
+        }
+    d_fft_doppler_shift = false;
+
+    // Interpolating the peak of the grid gives a fine estimate at no extra
+    // FFT cost, so it replaces the second, narrower grid
+    d_peak_interpolation = Acq_Peak_Interpolator::method_from_string(acq_parameters.peak_interpolation);
+    if (d_peak_interpolation != Acq_Peak_Interpolator::Method::None and acq_parameters.make_2_steps)
+        {
+            LOG(INFO) << "Acquisition peak interpolation (" << acq_parameters.peak_interpolation << ") replaces the two-step acquisition";
+            acq_parameters.make_2_steps = false;
+        }
+    d_code_replica = nullptr;
+    if (d_peak_interpolation != Acq_Peak_Interpolator::Method::None and acq_parameters.peak_interpolation_check)
+        {
+            d_code_replica = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_fft_size * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
+            std::fill_n(d_code_replica, d_fft_size, gr_complex(0.0, 0.0));
+        }
+
+    // With cshort inputs, the snapshot can stay in 16-bit integers up to the
+    // FFT: each Doppler bin rotates it on the fly and converts it to floats
+    // while loading the FFT input. Neither the float copy of the input nor the
+    // wipeoff tables are needed then, but the modes that start from them are.
+    d_fixed_point_wipeoff = acq_parameters.fixed_point_wipeoff and d_cshort;
+    if (acq_parameters.fixed_point_wipeoff and !d_cshort)
+        {
+            LOG(WARNING) << "The fixed-point acquisition wipeoff needs cshort input samples, ignored";
+        }
+    if (d_fixed_point_wipeoff and (acq_parameters.fft_doppler_shift or acq_parameters.share_input_spectra))
+        {
+            LOG(INFO) << "The fixed-point acquisition wipeoff replaces fft_doppler_shift and share_input_spectra";
+            acq_parameters.fft_doppler_shift = false;
+            acq_parameters.share_input_spectra = false;
+        }
+    d_input_signal_converted = true;
+    d_input_shift = 0;
+    d_grid_scale = 1.0;
+    d_dwell_scale = 1.0;
+    d_input_signal_sc = nullptr;
+    if (d_fixed_point_wipeoff)
+        {
+            d_input_signal_sc = static_cast<lv_16sc_t*>(volk_gnsssdr_malloc(d_fft_size * sizeof(lv_16sc_t), volk_gnsssdr_get_alignment()));
+            std::fill_n(d_input_signal_sc, d_fft_size, lv_cmake(static_cast<int16_t>(0), static_cast<int16_t>(0)));
+        }
 
     // Direct FFT
-    d_fft_if = new gr::fft::fft_complex(d_fft_size, true);
+    d_fft_if = new Gnss_Fft(d_fft_size, true);
 
     // Inverse FFT
-    d_ifft = new gr::fft::fft_complex(d_fft_size, false);
+    d_ifft = new Gnss_Fft(d_fft_size, false);
+
+    // Doppler bin search workers, each one with its own plans and scratch buffers
+    uint32_t num_doppler_workers = std::max(acq_parameters.doppler_workers, 1U);
+    d_doppler_workers.resize(num_doppler_workers);
+    for (uint32_t w = 0; w < num_doppler_workers; w++)
+        {
+            Acq_Doppler_Worker& worker = d_doppler_workers[w];
+            if (w == 0)
+                {
+                    worker.fft_if = d_fft_if;
+                    worker.ifft = d_ifft;
+                    worker.magnitude = d_magnitude;
+                    worker.tmp_buffer = d_tmp_buffer;
+                }
+            else
+                {
+                    worker.fft_if = new Gnss_Fft(d_fft_size, true);
+                    worker.ifft = new Gnss_Fft(d_fft_size, false);
+                    worker.magnitude = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
+                    worker.tmp_buffer = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
+                }
+            worker.wipeoff_sc = nullptr;
+            if (d_fixed_point_wipeoff)
+                {
+                    worker.wipeoff_sc = static_cast<lv_16sc_t*>(volk_gnsssdr_malloc(d_fft_size * sizeof(lv_16sc_t), volk_gnsssdr_get_alignment()));
+                }
+            worker.first_peak = 0.0;
+            worker.second_peak = 0.0;
+            worker.peak_index_doppler = 0U;
+            worker.peak_index_time = 0U;
+        }
 
     d_gnss_synchro = nullptr;
-    d_grid_doppler_wipeoffs = nullptr;
     d_grid_doppler_wipeoffs_step_two = nullptr;
     d_magnitude_grid = nullptr;
+    d_streaming_peaks = false;
+    d_first_peak = 0.0;
+    d_second_peak = 0.0;
+    d_peak_index_doppler = 0U;
+    d_peak_index_time = 0U;
     d_worker_active = false;
     d_data_buffer = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_consumed_samples * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
     if (d_cshort)
@@ -150,6 +260,8 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
         {
             d_use_CFAR_algorithm_flag = false;
         }
+    // Only the CFAR statistic grows with the accumulated dwells
+    d_sequential_test = Acq_Sequential_Test(acq_parameters.sequential_dismissal_ratio, acq_parameters.max_dwells, d_use_CFAR_algorithm_flag);
     d_dump_number = 0LL;
     d_dump_channel = acq_parameters.dump_channel;
     d_dump = acq_parameters.dump;
@@ -185,18 +297,22 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
                     d_dump = false;
                 }
         }
+    if (d_dump)
+        {
+            d_dump_writer = std::unique_ptr<Acq_Dump_Writer>(new Acq_Dump_Writer(acq_parameters.dump_queue_size,
+                Acq_Dump_Writer::policy_from_string(acq_parameters.dump_queue_policy)));
+        }
 }
 
 pcps_acquisition::~pcps_acquisition()
 {
-    if (d_num_doppler_bins > 0)
+    stop();
+    if (d_magnitude_grid != nullptr)
         {
-            for (uint32_t i = 0; i < d_num_doppler_bins; i++)
+            for (uint32_t i = 0; i < d_magnitude_grid_rows; i++)
                 {
-                    volk_gnsssdr_free(d_grid_doppler_wipeoffs[i]);
                     volk_gnsssdr_free(d_magnitude_grid[i]);
                 }
-            delete[] d_grid_doppler_wipeoffs;
             delete[] d_magnitude_grid;
         }
     if (acq_parameters.make_2_steps)
@@ -208,9 +324,36 @@ pcps_acquisition::~pcps_acquisition()
             delete[] d_grid_doppler_wipeoffs_step_two;
         }
     volk_gnsssdr_free(d_fft_codes);
+    if (d_fft_codes_pilot != nullptr)
+        {
+            volk_gnsssdr_free(d_fft_codes_pilot);
+        }
     volk_gnsssdr_free(d_magnitude);
+    volk_gnsssdr_free(d_code_phase_mask);
     volk_gnsssdr_free(d_tmp_buffer);
     volk_gnsssdr_free(d_input_signal);
+    if (d_code_replica != nullptr)
+        {
+            volk_gnsssdr_free(d_code_replica);
+        }
+    if (d_input_signal_sc != nullptr)
+        {
+            volk_gnsssdr_free(d_input_signal_sc);
+        }
+    for (auto& worker : d_doppler_workers)
+        {
+            if (worker.wipeoff_sc != nullptr)
+                {
+                    volk_gnsssdr_free(worker.wipeoff_sc);
+                }
+        }
+    for (uint32_t w = 1; w < d_doppler_workers.size(); w++)
+        {
+            delete d_doppler_workers[w].fft_if;
+            delete d_doppler_workers[w].ifft;
+            volk_gnsssdr_free(d_doppler_workers[w].magnitude);
+            volk_gnsssdr_free(d_doppler_workers[w].tmp_buffer);
+        }
     delete d_ifft;
     delete d_fft_if;
     volk_gnsssdr_free(d_data_buffer);
@@ -227,7 +370,81 @@ void pcps_acquisition::set_resampler_latency(uint32_t latency_samples)
     acq_parameters.resampler_latency_samples = latency_samples;
 }
 
+
+bool pcps_acquisition::set_sample_ring(const std::string& ring_key)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    if (!acq_parameters.use_sample_ring)
+        {
+            return false;
+        }
+    // Room for a few snapshots, so consecutive dwells see contiguous samples
+    // even if the ring thread is scheduled late
+    d_sample_ring = Acq_Sample_Ring_Registry::instance().get(ring_key, acq_parameters.it_size, 4ULL * d_consumed_samples);
+    return d_sample_ring != nullptr;
+}
+
 void pcps_acquisition::set_local_code(std::complex<float>* code)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    prepare_fdma_local_code();
+    fill_code_fft_input(code);
+    if (d_code_replica != nullptr)
+        {
+            memcpy(d_code_replica, d_fft_if->get_inbuf(), sizeof(gr_complex) * d_fft_size);
+        }
+    d_fft_if->execute();  // We need the FFT of local code
+    volk_32fc_conjugate_32fc(d_fft_codes, d_fft_if->get_outbuf(), d_fft_size);
+    if (d_fft_codes_pilot != nullptr)
+        {
+            // Each component contributes half of the combined magnitude
+            volk_32fc_s32fc_multiply_32fc(d_fft_codes, d_fft_codes, lv_cmake(std::sqrt(0.5F), 0.0F), d_fft_size);
+        }
+}
+
+
+void pcps_acquisition::set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    prepare_fdma_local_code();
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = get_code_spectrum(code_id, prn, generate);
+    if (d_fft_codes_pilot != nullptr)
+        {
+            // Each component contributes half of the combined magnitude
+            volk_32fc_s32fc_multiply_32fc(d_fft_codes, spectrum->spectrum(), lv_cmake(std::sqrt(0.5F), 0.0F), d_fft_size);
+        }
+    else
+        {
+            memcpy(d_fft_codes, spectrum->spectrum(), sizeof(gr_complex) * d_fft_size);
+        }
+    if (d_code_replica != nullptr)
+        {
+            memcpy(d_code_replica, spectrum->code(), sizeof(gr_complex) * d_fft_size);
+        }
+}
+
+
+void pcps_acquisition::set_pilot_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    if (d_fft_codes_pilot == nullptr)
+        {
+            LOG(WARNING) << "Pilot code " << code_id << " ignored, combine_data_pilot is not set";
+            return;
+        }
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = get_code_spectrum(code_id, prn, generate);
+    volk_32fc_s32fc_multiply_32fc(d_fft_codes_pilot, spectrum->spectrum(), lv_cmake(std::sqrt(0.5F), 0.0F), d_fft_size);
+}
+
+
+void pcps_acquisition::warm_up_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate)
+{
+    gr::thread::scoped_lock lock(d_setlock);
+    get_code_spectrum(code_id, prn, generate);
+}
+
+
+void pcps_acquisition::prepare_fdma_local_code()
 {
     // reset the intermediate frequency
     d_old_freq = 0LL;
@@ -236,11 +453,15 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
         {
             update_grid_doppler_wipeoffs();
         }
+}
+
+
+void pcps_acquisition::fill_code_fft_input(const std::complex<float>* code)
+{
     // COD
     // Here we want to create a buffer that looks like this:
     // [ 0 0 0 ... 0 c_0 c_1 ... c_L]
     // where c_i is the local code and there are L zeros and L chips
-    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
     if (acq_parameters.bit_transition_flag)
         {
             int32_t offset = d_fft_size / 2;
@@ -259,15 +480,48 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
                     memcpy(d_fft_if->get_inbuf() + d_consumed_samples, code, sizeof(gr_complex) * d_consumed_samples);
                 }
         }
+}
 
-    d_fft_if->execute();  // We need the FFT of local code
-    volk_32fc_conjugate_32fc(d_fft_codes, d_fft_if->get_outbuf(), d_fft_size);
+
+Acq_Code_Spectra_Cache::Spectrum_sptr pcps_acquisition::get_code_spectrum(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate)
+{
+    // The spectrum depends on how the code is laid out in the FFT buffer,
+    // which is fully determined by the FFT size, the dwell length and the
+    // bit transition flag
+    Acq_Code_Key key;
+    key.block = acq_parameters.bit_transition_flag ? "pcps_bt" : "pcps";
+    key.code_id = code_id;
+    key.prn = prn;
+    key.fs = acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in;
+    key.fft_size = d_fft_size;
+    key.dwell_samples = d_consumed_samples;
+    uint32_t code_size = 0U;
+    if (d_code_replica != nullptr)
+        {
+            // Entries stored without the time-domain code cannot be reused
+            key.block += "_t";
+            code_size = d_fft_size;
+        }
+    return Acq_Code_Spectra_Cache::instance().get(key, code_size, [this, &generate, prn](Acq_Code_Spectrum& spectrum) {
+        fill_code_fft_input(generate(prn));
+        if (spectrum.code() != nullptr)
+            {
+                memcpy(spectrum.code(), d_fft_if->get_inbuf(), sizeof(gr_complex) * d_fft_size);
+            }
+        d_fft_if->execute();
+        volk_32fc_conjugate_32fc(spectrum.spectrum(), d_fft_if->get_outbuf(), d_fft_size);
+    });
 }
 
 
 bool pcps_acquisition::is_fdma()
 {
     // Dealing with FDMA system
+    if (acq_parameters.fdma_channelized)
+        {
+            // The FDMA channelizer already brought the sub-band of the satellite to baseband
+            return false;
+        }
     if (strcmp(d_gnss_synchro->Signal, "1G") == 0)
         {
             d_old_freq += DFRQ1_GLO * GLONASS_PRN.at(d_gnss_synchro->PRN);
@@ -314,10 +568,21 @@ void pcps_acquisition::init()
     d_mag = 0.0;
     d_input_power = 0.0;
 
+    if (acq_parameters.fft_doppler_shift and !is_multiple_of_fft_bin(static_cast<double>(d_doppler_step)))
+        {
+            // Coarsening the step to a whole number of bins would add scalloping
+            // loss, so the configured grid is kept with the time-domain wipeoff
+            LOG(WARNING) << "fft_doppler_shift needs a Doppler step multiple of the FFT bin width (" << d_fft_bin_hz
+                         << " Hz), but it is " << d_doppler_step << " Hz. Using time-domain Doppler wipeoff";
+        }
+
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(static_cast<int32_t>(acq_parameters.doppler_max) - static_cast<int32_t>(-acq_parameters.doppler_max)) / static_cast<double>(d_doppler_step)));
+    d_full_num_doppler_bins = d_num_doppler_bins;
+    d_doppler_center = 0;
+    d_doppler_window = acq_parameters.doppler_max;
+    d_use_code_phase_mask = false;
 
     // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs == nullptr) d_grid_doppler_wipeoffs = new gr_complex*[d_num_doppler_bins];
     if (acq_parameters.make_2_steps && (d_grid_doppler_wipeoffs_step_two == nullptr))
         {
             d_grid_doppler_wipeoffs_step_two = new gr_complex*[d_num_doppler_bins_step2];
@@ -327,25 +592,49 @@ void pcps_acquisition::init()
                 }
         }
 
-    if (d_magnitude_grid == nullptr)
+    // Without dump nor non-coherent accumulation, the peak-to-peak statistic
+    // can be tracked while each row of the grid is computed, so only one
+    // scratch row is needed instead of the whole magnitude grid. The peak
+    // interpolation needs the neighbouring bins, so it keeps the grid.
+    d_streaming_peaks = !d_use_CFAR_algorithm_flag and !d_dump and acq_parameters.max_dwells == 1 and
+                        d_peak_interpolation == Acq_Peak_Interpolator::Method::None;
+    if (d_streaming_peaks)
         {
-            d_magnitude_grid = new float*[d_num_doppler_bins];
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+            for (auto& worker : d_doppler_workers)
                 {
-                    d_grid_doppler_wipeoffs[doppler_index] = static_cast<gr_complex*>(volk_gnsssdr_malloc(d_fft_size * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
-                    d_magnitude_grid[doppler_index] = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
+                    std::fill_n(worker.magnitude, d_fft_size, 0.0);
                 }
         }
-
-    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+    else
         {
-            for (uint32_t k = 0; k < d_fft_size; k++)
+            if (d_magnitude_grid != nullptr and d_magnitude_grid_rows != d_num_doppler_bins)
                 {
-                    d_magnitude_grid[doppler_index][k] = 0.0;
+                    for (uint32_t i = 0; i < d_magnitude_grid_rows; i++)
+                        {
+                            volk_gnsssdr_free(d_magnitude_grid[i]);
+                        }
+                    delete[] d_magnitude_grid;
+                    d_magnitude_grid = nullptr;
+                }
+            if (d_magnitude_grid == nullptr)
+                {
+                    d_magnitude_grid_rows = d_num_doppler_bins;
+                    d_magnitude_grid = new float*[d_num_doppler_bins];
+                    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                        {
+                            d_magnitude_grid[doppler_index] = static_cast<float*>(volk_gnsssdr_malloc(d_fft_size * sizeof(float), volk_gnsssdr_get_alignment()));
+                        }
+                }
+
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    for (uint32_t k = 0; k < d_fft_size; k++)
+                        {
+                            d_magnitude_grid[doppler_index][k] = 0.0;
+                        }
                 }
-            int32_t doppler = -static_cast<int32_t>(acq_parameters.doppler_max) + d_doppler_step * doppler_index;
-            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], d_fft_size, d_old_freq + doppler);
         }
+    update_grid_doppler_wipeoffs();
 
     d_worker_active = false;
 
@@ -360,14 +649,228 @@ void pcps_acquisition::init()
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    update_doppler_bin_shifts();
+    if (d_fft_doppler_shift)
+        {
+            // The Doppler is removed in the frequency domain, no wipeoff table needed
+            d_grid_doppler_wipeoffs.reset();
+            return;
+        }
+    if (d_fixed_point_wipeoff)
+        {
+            // The input is rotated on the fly, only the phase step of each bin is needed
+            d_grid_doppler_wipeoffs.reset();
+            auto fs = static_cast<double>(acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in);
+            d_wipeoff_phase_steps.resize(d_num_doppler_bins);
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    double phase_step_rad = -GPS_TWO_PI * static_cast<double>(d_old_freq + grid_doppler(doppler_index)) / fs;
+                    d_wipeoff_phase_steps[doppler_index] = gr_complex(std::cos(phase_step_rad), std::sin(phase_step_rad));
+                }
+            return;
+        }
+    d_grid_doppler_wipeoffs = Acq_Wipeoff_Store::instance().get(wipeoff_key(), d_num_doppler_bins, d_fft_size,
+        [this](Acq_Doppler_Wipeoffs& wipeoffs) {
+            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+                {
+                    update_local_carrier(wipeoffs.row(doppler_index), d_fft_size, d_old_freq + grid_doppler(doppler_index));
+                }
+        });
+}
+
+
+bool pcps_acquisition::is_multiple_of_fft_bin(double freq_hz) const
+{
+    double bins = freq_hz / d_fft_bin_hz;
+    return std::abs(bins - std::round(bins)) < 1e-6;
+}
+
+
+double pcps_acquisition::carrier_frequency_hz() const
+{
+    std::string signal(d_gnss_synchro->Signal, 2);
+    if (signal == "1C" or signal == "1B")
+        {
+            return FREQ1;
+        }
+    if (signal == "2S")
+        {
+            return FREQ2;
+        }
+    if (signal == "L5" or signal == "5X")
+        {
+            return FREQ5;
+        }
+    return 0.0;  // no search window prediction for FDMA signals
+}
+
+
+int32_t pcps_acquisition::grid_doppler(uint32_t doppler_index) const
+{
+    return d_doppler_center - static_cast<int32_t>(d_doppler_window) + static_cast<int32_t>(d_doppler_step * doppler_index);
+}
+
+
+void pcps_acquisition::update_search_window()
+{
+    // Search only around the predicted Doppler of the satellite, if any. The
+    // narrowed grid keeps the Doppler step, and its center is rounded to a
+    // multiple of it, so it stays aligned with the FFT bins in shift mode and
+    // channels with similar predictions can share their wipeoff tables.
+    int32_t center = 0;
+    uint32_t window = acq_parameters.doppler_max;
+    uint32_t num_bins = d_full_num_doppler_bins;
+    d_use_code_phase_mask = false;
+    d_search_window_narrowed = false;
+    double carrier_hz = carrier_frequency_hz();
+    if (acq_parameters.use_search_windows and carrier_hz > 0.0 and
+        Acq_Search_Window_Store::instance().find(d_gnss_synchro->System, d_gnss_synchro->PRN, d_search_window))
+        {
+            double age_s = d_search_window.age_s();
+            bool failed = (d_failed_window_system == d_gnss_synchro->System and d_failed_window_prn == d_gnss_synchro->PRN and
+                           d_failed_window_time_s == d_search_window.reference_time_s);
+            if (d_search_window.expired(age_s))
+                {
+                    DLOG(INFO) << "Channel " << d_channel << ": search window of " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
+                               << " expired " << age_s << " s after its prediction";
+                }
+            else if (failed)
+                {
+                    // The satellite was missed inside this window, so it may be
+                    // wrong: the full grid is searched until a new one is set
+                    DLOG(INFO) << "Channel " << d_channel << ": search window of " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
+                               << " failed, searching the full grid";
+                }
+            else
+                {
+                    auto step = static_cast<double>(d_doppler_step);
+                    auto half_bins = static_cast<uint32_t>(std::ceil(std::max(d_search_window.doppler_uncertainty_hz(carrier_hz, age_s), step) / step));
+                    if (2 * half_bins < d_full_num_doppler_bins)
+                        {
+                            center = static_cast<int32_t>(std::round(d_search_window.doppler_hz(carrier_hz) / step)) * static_cast<int32_t>(d_doppler_step);
+                            window = half_bins * d_doppler_step;
+                            num_bins = 2 * half_bins;
+                            d_search_window_narrowed = true;
+                        }
+                    d_use_code_phase_mask = d_search_window.code_phase_valid;
+                    d_search_window_narrowed = d_search_window_narrowed or d_use_code_phase_mask;
+                }
+        }
+
+    if (center == d_doppler_center and window == d_doppler_window)
+        {
+            return;
+        }
+    DLOG(INFO) << "Channel " << d_channel << ": searching " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
+               << " in " << num_bins << " Doppler bins around " << center << " Hz";
+    d_doppler_center = center;
+    d_doppler_window = window;
+    d_num_doppler_bins = num_bins;
+    update_grid_doppler_wipeoffs();
+    if (d_dump)
+        {
+            uint32_t effective_fft_size = (acq_parameters.bit_transition_flag ? (d_fft_size / 2) : d_fft_size);
+            grid_ = arma::fmat(effective_fft_size, d_num_doppler_bins, arma::fill::zeros);
+        }
+}
+
+
+void pcps_acquisition::update_code_phase_mask(uint64_t samp_count, int32_t effective_fft_size)
+{
+    // The predicted code delay refers to a given input sample, so its
+    // position in this snapshot depends on the snapshot sample stamp
+    double fs = static_cast<double>(acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in);
+    auto code_samples = static_cast<double>(acq_parameters.samples_per_code);
+    double elapsed_s = (static_cast<double>(samp_count) - static_cast<double>(d_search_window.reference_sample_stamp)) / fs;
+    double center = std::fmod(d_search_window.code_phase_s_at(elapsed_s) * fs + static_cast<double>(d_search_window.reference_sample_stamp) - static_cast<double>(samp_count), code_samples);
+    if (center < 0.0)
+        {
+            center += code_samples;
+        }
+    double half_window = d_search_window.code_phase_window_s_at(elapsed_s) * fs;
+    for (int32_t i = 0; i < effective_fft_size; i++)
+        {
+            double distance = std::abs(std::fmod(static_cast<double>(i), code_samples) - center);
+            distance = std::min(distance, code_samples - distance);
+            d_code_phase_mask[i] = (distance <= half_window ? 1.0 : 0.0);
+        }
+}
+
+
+std::string pcps_acquisition::grid_key() const
+{
+    // Identifies the input stream (RF chain and signal) and the Doppler grid: blocks with the same key
+    // produce the same input spectra for the same snapshot
+    std::string key = std::to_string(d_rf_channel) + "_" + std::string(d_gnss_synchro->Signal, 2);
+    key += "_" + std::to_string(d_fft_bin_hz) + "_" + std::to_string(d_fft_size);
+    key += "_" + std::to_string(d_doppler_center) + "_" + std::to_string(d_doppler_window) + "_" + std::to_string(d_doppler_step);
+    key += "_" + std::to_string(d_old_freq) + (d_fft_doppler_shift ? "_f" : "_t");
+    return key;
+}
+
+
+std::string pcps_acquisition::wipeoff_key() const
+{
+    // Everything the wipeoff table depends on. Step-two grids are centred on
+    // a channel-specific Doppler and are kept private.
+    int64_t fs = acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in;
+    return std::to_string(fs) + "_" + std::to_string(d_fft_size) + "_" + std::to_string(d_doppler_center) + "_" +
+           std::to_string(d_doppler_window) + "_" + std::to_string(d_doppler_step) + "_" + std::to_string(d_old_freq);
+}
+
+
+void pcps_acquisition::compute_input_spectra(const gr_complex* in, Acq_Input_Spectra& spectra)
+{
+    if (d_fft_doppler_shift)
+        {
+            memcpy(d_fft_if->get_inbuf(), in, d_fft_size * sizeof(gr_complex));
+            d_fft_if->execute();
+            memcpy(spectra.spectrum(0), d_fft_if->get_outbuf(), d_fft_size * sizeof(gr_complex));
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
-            int32_t doppler = -static_cast<int32_t>(acq_parameters.doppler_max) + d_doppler_step * doppler_index;
-            update_local_carrier(d_grid_doppler_wipeoffs[doppler_index], d_fft_size, d_old_freq + doppler);
+            volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs->row(doppler_index), d_fft_size);
+            d_fft_if->execute();
+            memcpy(spectra.spectrum(doppler_index), d_fft_if->get_outbuf(), d_fft_size * sizeof(gr_complex));
         }
 }
 
 
+void pcps_acquisition::update_doppler_bin_shifts()
+{
+    // A Doppler wipeoff by f = k * fs / N before the FFT is equivalent to a
+    // circular shift of k bins of the FFT output, so the grid can be computed
+    // from a single input FFT if every frequency of the grid is a whole number of bins
+    d_fft_doppler_shift = false;
+    if (!acq_parameters.fft_doppler_shift)
+        {
+            return;
+        }
+    if (!is_multiple_of_fft_bin(static_cast<double>(d_doppler_step)) or
+        !is_multiple_of_fft_bin(static_cast<double>(d_doppler_window)) or
+        !is_multiple_of_fft_bin(static_cast<double>(d_doppler_center)) or
+        !is_multiple_of_fft_bin(static_cast<double>(d_old_freq)))
+        {
+            LOG(INFO) << "Doppler grid is not aligned with the FFT bins (" << d_fft_bin_hz
+                      << " Hz), using time-domain Doppler wipeoff";
+            return;
+        }
+    d_doppler_bin_shifts.resize(d_num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            auto shift = static_cast<int64_t>(std::round(static_cast<double>(d_old_freq + grid_doppler(doppler_index)) / d_fft_bin_hz));
+            shift %= static_cast<int64_t>(d_fft_size);
+            if (shift < 0)
+                {
+                    shift += d_fft_size;
+                }
+            d_doppler_bin_shifts[doppler_index] = static_cast<uint32_t>(shift);
+        }
+    d_fft_doppler_shift = true;
+}
+
+
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
@@ -382,6 +885,7 @@ void pcps_acquisition::set_state(int32_t state)
 {
     gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
     d_state = state;
+    d_ring_cond.notify_one();
     if (d_state == 1)
         {
             d_gnss_synchro->Acq_delay_samples = 0.0;
@@ -392,6 +896,8 @@ void pcps_acquisition::set_state(int32_t state)
             d_input_power = 0.0;
             d_test_statistics = 0.0;
             d_active = true;
+            d_ring_resync = true;
+            update_search_window();
         }
     else if (d_state == 0)
         {
@@ -417,6 +923,7 @@ void pcps_acquisition::send_positive_acquisition()
                << ", magnitude " << d_mag
                << ", input signal power " << d_input_power;
     d_positive_acq = 1;
+    d_failed_window_prn = 0U;
     this->message_port_pub(pmt::mp("events"), pmt::from_long(1));
 }
 
@@ -435,13 +942,23 @@ void pcps_acquisition::send_negative_acquisition()
                << ", magnitude " << d_mag
                << ", input signal power " << d_input_power;
     d_positive_acq = 0;
+    if (d_search_window_narrowed)
+        {
+            // Do not trust this window again for this satellite
+            d_failed_window_system = d_gnss_synchro->System;
+            d_failed_window_prn = d_gnss_synchro->PRN;
+            d_failed_window_time_s = d_search_window.reference_time_s;
+        }
     this->message_port_pub(pmt::mp("events"), pmt::from_long(2));
 }
 
 
-void pcps_acquisition::dump_results(int32_t effective_fft_size)
+void pcps_acquisition::dump_results()
 {
+    // Only copy the results here: the file is written by the dump writer
+    // thread, so the compression does not delay the next search
     d_dump_number++;
+    std::shared_ptr<Acq_Dump_Record> record = std::make_shared<Acq_Dump_Record>();
     std::string filename = d_dump_filename;
     filename.append("_");
     filename.append(1, d_gnss_synchro->System);
@@ -455,8 +972,35 @@ void pcps_acquisition::dump_results(int32_t effective_fft_size)
     filename.append("_sat_");
     filename.append(std::to_string(d_gnss_synchro->PRN));
     filename.append(".mat");
+    record->filename = filename;
+    record->grid = grid_;
+    record->two_steps = acq_parameters.make_2_steps;
+    if (record->two_steps)
+        {
+            record->narrow_grid = narrow_grid_;
+        }
+    record->doppler_max = d_doppler_window;
+    record->doppler_center = d_doppler_center;
+    record->doppler_step = d_doppler_step;
+    record->positive_acq = d_positive_acq;
+    record->acq_doppler_hz = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
+    record->acq_delay_samples = static_cast<float>(d_gnss_synchro->Acq_delay_samples);
+    record->test_statistic = d_test_statistics;
+    record->threshold = d_threshold;
+    record->input_power = d_input_power * (d_fixed_point_wipeoff ? d_grid_scale : 1.0F);
+    record->sample_counter = d_sample_counter;
+    record->prn = d_gnss_synchro->PRN;
+    record->num_dwells = d_num_noncoherent_integrations_counter;
+    record->doppler_step_narrow = acq_parameters.doppler_step2;
+    record->doppler_grid_narrow_min = d_doppler_center_step_two - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0)) * acq_parameters.doppler_step2;
+
+    d_dump_writer->push([record]() { pcps_acquisition::write_dump_file(*record); });
+}
 
-    mat_t* matfp = Mat_CreateVer(filename.c_str(), nullptr, MAT_FT_MAT73);
+
+void pcps_acquisition::write_dump_file(const Acq_Dump_Record& record)
+{
+    mat_t* matfp = Mat_CreateVer(record.filename.c_str(), nullptr, MAT_FT_MAT73);
     if (matfp == nullptr)
         {
             std::cout << "Unable to create or open Acquisition dump file" << std::endl;
@@ -464,75 +1008,77 @@ void pcps_acquisition::dump_results(int32_t effective_fft_size)
         }
     else
         {
-            size_t dims[2] = {static_cast<size_t>(effective_fft_size), static_cast<size_t>(d_num_doppler_bins)};
-            matvar_t* matvar = Mat_VarCreate("acq_grid", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims, grid_.memptr(), 0);
+            // matio takes non-const pointers, but it does not modify the data
+            size_t dims[2] = {static_cast<size_t>(record.grid.n_rows), static_cast<size_t>(record.grid.n_cols)};
+            matvar_t* matvar = Mat_VarCreate("acq_grid", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims, const_cast<float*>(record.grid.memptr()), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
             dims[0] = static_cast<size_t>(1);
             dims[1] = static_cast<size_t>(1);
-            matvar = Mat_VarCreate("doppler_max", MAT_C_UINT32, MAT_T_UINT32, 1, dims, &acq_parameters.doppler_max, 0);
+            matvar = Mat_VarCreate("doppler_max", MAT_C_UINT32, MAT_T_UINT32, 1, dims, const_cast<uint32_t*>(&record.doppler_max), 0);
+            Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
+            Mat_VarFree(matvar);
+
+            matvar = Mat_VarCreate("doppler_center", MAT_C_INT32, MAT_T_INT32, 1, dims, const_cast<int32_t*>(&record.doppler_center), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("doppler_step", MAT_C_UINT32, MAT_T_UINT32, 1, dims, &d_doppler_step, 0);
+            matvar = Mat_VarCreate("doppler_step", MAT_C_UINT32, MAT_T_UINT32, 1, dims, const_cast<uint32_t*>(&record.doppler_step), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("d_positive_acq", MAT_C_INT32, MAT_T_INT32, 1, dims, &d_positive_acq, 0);
+            matvar = Mat_VarCreate("d_positive_acq", MAT_C_INT32, MAT_T_INT32, 1, dims, const_cast<int32_t*>(&record.positive_acq), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            auto aux = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
-            matvar = Mat_VarCreate("acq_doppler_hz", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &aux, 0);
+            matvar = Mat_VarCreate("acq_doppler_hz", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.acq_doppler_hz), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            aux = static_cast<float>(d_gnss_synchro->Acq_delay_samples);
-            matvar = Mat_VarCreate("acq_delay_samples", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &aux, 0);
+            matvar = Mat_VarCreate("acq_delay_samples", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.acq_delay_samples), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("test_statistic", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &d_test_statistics, 0);
+            matvar = Mat_VarCreate("test_statistic", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.test_statistic), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("threshold", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &d_threshold, 0);
+            matvar = Mat_VarCreate("threshold", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.threshold), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("input_power", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &d_input_power, 0);
+            matvar = Mat_VarCreate("input_power", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.input_power), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("sample_counter", MAT_C_UINT64, MAT_T_UINT64, 1, dims, &d_sample_counter, 0);
+            matvar = Mat_VarCreate("sample_counter", MAT_C_UINT64, MAT_T_UINT64, 1, dims, const_cast<uint64_t*>(&record.sample_counter), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("PRN", MAT_C_UINT32, MAT_T_UINT32, 1, dims, &d_gnss_synchro->PRN, 0);
+            matvar = Mat_VarCreate("PRN", MAT_C_UINT32, MAT_T_UINT32, 1, dims, const_cast<uint32_t*>(&record.prn), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            matvar = Mat_VarCreate("num_dwells", MAT_C_UINT32, MAT_T_UINT32, 1, dims, &d_num_noncoherent_integrations_counter, 0);
+            matvar = Mat_VarCreate("num_dwells", MAT_C_UINT32, MAT_T_UINT32, 1, dims, const_cast<uint32_t*>(&record.num_dwells), 0);
             Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
             Mat_VarFree(matvar);
 
-            if (acq_parameters.make_2_steps)
+            if (record.two_steps)
                 {
-                    dims[0] = static_cast<size_t>(effective_fft_size);
-                    dims[1] = static_cast<size_t>(d_num_doppler_bins_step2);
-                    matvar = Mat_VarCreate("acq_grid_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims, narrow_grid_.memptr(), 0);
+                    dims[0] = static_cast<size_t>(record.narrow_grid.n_rows);
+                    dims[1] = static_cast<size_t>(record.narrow_grid.n_cols);
+                    matvar = Mat_VarCreate("acq_grid_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 2, dims, const_cast<float*>(record.narrow_grid.memptr()), 0);
                     Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
                     Mat_VarFree(matvar);
 
                     dims[0] = static_cast<size_t>(1);
                     dims[1] = static_cast<size_t>(1);
-                    matvar = Mat_VarCreate("doppler_step_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &acq_parameters.doppler_step2, 0);
+                    matvar = Mat_VarCreate("doppler_step_narrow", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.doppler_step_narrow), 0);
                     Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
                     Mat_VarFree(matvar);
 
-                    aux = d_doppler_center_step_two - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0)) * acq_parameters.doppler_step2;
-                    matvar = Mat_VarCreate("doppler_grid_narrow_min", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, &aux, 0);
+                    matvar = Mat_VarCreate("doppler_grid_narrow_min", MAT_C_SINGLE, MAT_T_SINGLE, 1, dims, const_cast<float*>(&record.doppler_grid_narrow_min), 0);
                     Mat_VarWrite(matfp, matvar, MAT_COMPRESSION_ZLIB);  // or MAT_COMPRESSION_NONE
                     Mat_VarFree(matvar);
                 }
@@ -561,6 +1107,8 @@ float pcps_acquisition::max_to_input_power_statistic(uint32_t& indext, int32_t&
                     index_time = tmp_intex_t;
                 }
         }
+    d_peak_index_doppler = index_doppler;
+    d_peak_index_time = index_time;
     indext = index_time;
     if (!d_step_two)
         {
@@ -583,20 +1131,35 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     // The second peak is chosen not closer than 1 chip to the highest peak
 
     float firstPeak = 0.0;
+    float secondPeak = 0.0;
     uint32_t index_doppler = 0U;
     uint32_t tmp_intex_t = 0U;
     uint32_t index_time = 0U;
 
-    // Find the correlation peak and the carrier frequency
-    for (uint32_t i = 0; i < num_doppler_bins; i++)
+    if (d_streaming_peaks)
         {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i], d_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > firstPeak)
+            // Already tracked while the grid was computed
+            firstPeak = d_first_peak;
+            secondPeak = d_second_peak;
+            index_doppler = d_peak_index_doppler;
+            index_time = d_peak_index_time;
+        }
+    else
+        {
+            // Find the correlation peak and the carrier frequency
+            for (uint32_t i = 0; i < num_doppler_bins; i++)
                 {
-                    firstPeak = d_magnitude_grid[i][tmp_intex_t];
-                    index_doppler = i;
-                    index_time = tmp_intex_t;
+                    volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i], d_fft_size);
+                    if (d_magnitude_grid[i][tmp_intex_t] > firstPeak)
+                        {
+                            firstPeak = d_magnitude_grid[i][tmp_intex_t];
+                            index_doppler = i;
+                            index_time = tmp_intex_t;
+                        }
                 }
+            secondPeak = second_peak(d_magnitude_grid[index_doppler], index_time, d_tmp_buffer);
+            d_peak_index_doppler = index_doppler;
+            d_peak_index_time = index_time;
         }
     indext = index_time;
 
@@ -609,6 +1172,13 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
             doppler = static_cast<int32_t>(d_doppler_center_step_two + (static_cast<float>(index_doppler) - static_cast<float>(floor(d_num_doppler_bins_step2 / 2.0))) * acq_parameters.doppler_step2);
         }
 
+    // Compute the test statistics and compare to the threshold
+    return firstPeak / secondPeak;
+}
+
+
+float pcps_acquisition::second_peak(const float* magnitude, uint32_t index_time, float* tmp_buffer)
+{
     // Find 1 chip wide code phase exclude range around the peak
     int32_t excludeRangeIndex1 = index_time - d_samplesPerChip;
     int32_t excludeRangeIndex2 = index_time + d_samplesPerChip;
@@ -624,21 +1194,349 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
         }
 
     int32_t idx = excludeRangeIndex1;
-    memcpy(d_tmp_buffer, d_magnitude_grid[index_doppler], d_fft_size);
+    memcpy(tmp_buffer, magnitude, d_fft_size * sizeof(float));
     do
         {
-            d_tmp_buffer[idx] = 0.0;
+            tmp_buffer[idx] = 0.0;
             idx++;
             if (idx == static_cast<int32_t>(d_fft_size)) idx = 0;
         }
     while (idx != excludeRangeIndex2);
 
     // Find the second highest correlation peak in the same freq. bin ---
-    volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_tmp_buffer, d_fft_size);
-    float secondPeak = d_tmp_buffer[tmp_intex_t];
+    uint32_t tmp_intex_t = 0U;
+    volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, tmp_buffer, d_fft_size);
+    return tmp_buffer[tmp_intex_t];
+}
 
-    // Compute the test statistics and compare to the threshold
-    return firstPeak / secondPeak;
+
+void pcps_acquisition::track_peaks(Acq_Doppler_Worker& worker, const float* magnitude, uint32_t doppler_index)
+{
+    // Keep the highest peak seen so far in the grid, and the second peak of
+    // its Doppler bin. The second peak only needs to be searched for when the
+    // row takes the lead, since it is not used otherwise.
+    uint32_t index_time = 0U;
+    volk_gnsssdr_32f_index_max_32u(&index_time, magnitude, d_fft_size);
+    if (magnitude[index_time] > worker.first_peak)
+        {
+            worker.first_peak = magnitude[index_time];
+            worker.second_peak = second_peak(magnitude, index_time, worker.tmp_buffer);
+            worker.peak_index_doppler = doppler_index;
+            worker.peak_index_time = index_time;
+        }
+}
+
+
+void pcps_acquisition::refine_peak(const gr_complex* in, int32_t effective_fft_size, double& delay_samples, double& doppler_hz)
+{
+    const float* peak_row = d_magnitude_grid[d_peak_index_doppler];
+    const double center = std::sqrt(static_cast<double>(peak_row[d_peak_index_time]));
+    const double grid_delay = delay_samples;
+    const double grid_doppler_hz = doppler_hz;
+
+    // Doppler, from the same code delay in the two adjacent rows
+    double doppler_offset = 0.0;
+    if (d_peak_index_doppler > 0 and d_peak_index_doppler + 1 < d_num_doppler_bins)
+        {
+            double left = std::sqrt(static_cast<double>(d_magnitude_grid[d_peak_index_doppler - 1][d_peak_index_time]));
+            double right = std::sqrt(static_cast<double>(d_magnitude_grid[d_peak_index_doppler + 1][d_peak_index_time]));
+            if (d_peak_interpolation == Acq_Peak_Interpolator::Method::Sinc)
+                {
+                    double fs = static_cast<double>(acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in);
+                    double bin_width = static_cast<double>(d_doppler_step) * static_cast<double>(d_consumed_samples) / fs;
+                    doppler_offset = Acq_Peak_Interpolator::sinc_offset(left, center, right, bin_width);
+                }
+            else
+                {
+                    doppler_offset = Acq_Peak_Interpolator::parabolic_offset(left * left, center * center, right * right);
+                }
+        }
+
+    // Code delay, from the two adjacent samples of the peak row. The row is
+    // circular unless the bit transition padding is in use.
+    double delay_offset = 0.0;
+    int32_t index_time = static_cast<int32_t>(d_peak_index_time);
+    bool at_edge = (index_time == 0 or index_time + 1 >= effective_fft_size);
+    if (!acq_parameters.bit_transition_flag or !at_edge)
+        {
+            double left = std::sqrt(static_cast<double>(peak_row[(index_time + effective_fft_size - 1) % effective_fft_size]));
+            double right = std::sqrt(static_cast<double>(peak_row[(index_time + 1) % effective_fft_size]));
+            if (d_peak_interpolation == Acq_Peak_Interpolator::Method::Sinc)
+                {
+                    delay_offset = Acq_Peak_Interpolator::triangle_offset(left, center, right, static_cast<double>(d_samplesPerChip));
+                }
+            else
+                {
+                    delay_offset = Acq_Peak_Interpolator::parabolic_offset(left * left, center * center, right * right);
+                }
+        }
+
+    delay_samples = grid_delay + delay_offset;
+    doppler_hz = grid_doppler_hz + doppler_offset * static_cast<double>(d_doppler_step);
+
+    // Keep the grid point if a direct correlation does not confirm the refinement
+    if (d_code_replica != nullptr and (delay_offset != 0.0 or doppler_offset != 0.0))
+        {
+            float refined_power = correlation_power(in, delay_samples, doppler_hz);
+            float grid_power = correlation_power(in, grid_delay, grid_doppler_hz);
+            if (refined_power < grid_power)
+                {
+                    DLOG(INFO) << "Interpolated peak discarded for satellite " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
+                               << ": " << refined_power << " < " << grid_power;
+                    delay_samples = grid_delay;
+                    doppler_hz = grid_doppler_hz;
+                }
+        }
+}
+
+
+float pcps_acquisition::correlation_power(const gr_complex* in, double delay_samples, double doppler_hz)
+{
+    // Single time-domain correlation with the local code shifted by a
+    // fractional delay, linearly interpolated, after the carrier wipe-off
+    double fs = static_cast<double>(acq_parameters.use_automatic_resampler ? acq_parameters.resampled_fs : acq_parameters.fs_in);
+    double phase_step_rad = -2.0 * M_PI * (static_cast<double>(d_old_freq) + doppler_hz) / fs;
+    std::complex<double> phasor(1.0, 0.0);
+    const std::complex<double> phasor_step(std::cos(phase_step_rad), std::sin(phase_step_rad));
+
+    const double n = static_cast<double>(d_fft_size);
+    double lag = delay_samples + (acq_parameters.bit_transition_flag ? n / 2.0 : 0.0);
+    double position = std::fmod(-lag, n);
+    if (position < 0.0)
+        {
+            position += n;
+        }
+    std::complex<double> correlation(0.0, 0.0);
+    for (uint32_t k = 0; k < d_fft_size; k++)
+        {
+            auto first = static_cast<uint32_t>(position);
+            double weight = position - static_cast<double>(first);
+            uint32_t second = (first + 1 == d_fft_size) ? 0U : first + 1;
+            std::complex<double> code = (1.0 - weight) * std::complex<double>(d_code_replica[first]) + weight * std::complex<double>(d_code_replica[second]);
+            correlation += std::complex<double>(in[k]) * phasor * std::conj(code);
+            phasor *= phasor_step;
+            position += 1.0;
+            if (position >= n)
+                {
+                    position -= n;
+                }
+        }
+    return static_cast<float>(std::norm(correlation));
+}
+
+
+void pcps_acquisition::search_doppler_grid(const gr_complex* in, const gr_complex* input_spectrum, const Acq_Input_Spectra* shared_spectra, uint32_t num_doppler_bins, int32_t effective_fft_size)
+{
+    // Split the Doppler bins in contiguous slices, one per worker. Each bin
+    // only writes its own row of the grid, so no synchronization is needed
+    // until the peak records are merged.
+    auto num_workers = static_cast<uint32_t>(std::min(static_cast<size_t>(num_doppler_bins), d_doppler_workers.size()));
+    num_workers = std::max(num_workers, 1U);
+    uint32_t bins_per_worker = (num_doppler_bins + num_workers - 1) / num_workers;
+    for (auto& worker : d_doppler_workers)
+        {
+            worker.first_peak = 0.0;
+            worker.second_peak = 0.0;
+            worker.peak_index_doppler = 0U;
+            worker.peak_index_time = 0U;
+        }
+
+    if (num_workers == 1)
+        {
+            search_doppler_bins(d_doppler_workers[0], in, input_spectrum, shared_spectra, 0, num_doppler_bins, effective_fft_size);
+        }
+    else
+        {
+            // The slices run on the shared acquisition pool, so no thread is
+            // created per dwell. Each slice has its own scratch buffers.
+            Acq_Worker_Pool::instance().run_tasks(num_workers, [&](uint32_t w) {
+                uint32_t first_bin = std::min(w * bins_per_worker, num_doppler_bins);
+                uint32_t last_bin = std::min(first_bin + bins_per_worker, num_doppler_bins);
+                search_doppler_bins(d_doppler_workers[w], in, input_spectrum, shared_spectra, first_bin, last_bin, effective_fft_size);
+            });
+        }
+
+    // Merge the peak records. Slices are in ascending Doppler order, so the
+    // strict comparison keeps the same cell as a serial search on ties.
+    d_first_peak = 0.0;
+    d_second_peak = 0.0;
+    d_peak_index_doppler = 0U;
+    d_peak_index_time = 0U;
+    for (uint32_t w = 0; w < num_workers; w++)
+        {
+            if (d_doppler_workers[w].first_peak > d_first_peak)
+                {
+                    d_first_peak = d_doppler_workers[w].first_peak;
+                    d_second_peak = d_doppler_workers[w].second_peak;
+                    d_peak_index_doppler = d_doppler_workers[w].peak_index_doppler;
+                    d_peak_index_time = d_doppler_workers[w].peak_index_time;
+                }
+        }
+}
+
+
+void pcps_acquisition::correlate_code(Acq_Doppler_Worker& worker, const gr_complex* spectrum, uint32_t shift, const gr_complex* fft_codes)
+{
+    // Multiply the carrier wiped--off, Fourier transformed incoming signal with
+    // the local FFT'd code reference, reading the input spectrum from bin
+    // shift onwards, and compute the inverse FFT
+    volk_32fc_x2_multiply_32fc(worker.ifft->get_inbuf(), spectrum + shift, fft_codes, d_fft_size - shift);
+    if (shift > 0)
+        {
+            volk_32fc_x2_multiply_32fc(worker.ifft->get_inbuf() + d_fft_size - shift, spectrum, fft_codes + d_fft_size - shift, shift);
+        }
+    worker.ifft->execute();
+}
+
+
+void pcps_acquisition::search_doppler_bins(Acq_Doppler_Worker& worker, const gr_complex* in, const gr_complex* input_spectrum, const Acq_Input_Spectra* shared_spectra, uint32_t first_bin, uint32_t last_bin, int32_t effective_fft_size)
+{
+    for (uint32_t doppler_index = first_bin; doppler_index < last_bin; doppler_index++)
+        {
+            // Carrier wiped--off, Fourier transformed incoming signal, circularly shifted by shift bins
+            const gr_complex* spectrum = worker.fft_if->get_outbuf();
+            uint32_t shift = 0U;
+            if (d_step_two)
+                {
+                    volk_32fc_x2_multiply_32fc(worker.fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs_step_two[doppler_index], d_fft_size);
+
+                    // Perform the FFT-based convolution  (parallel time search)
+                    // Compute the FFT of the carrier wiped--off incoming signal
+                    worker.fft_if->execute();
+                }
+            else if (d_fft_doppler_shift)
+                {
+                    // Remove Doppler by circularly shifting the input spectrum
+                    spectrum = input_spectrum;
+                    shift = d_doppler_bin_shifts[doppler_index];
+                }
+            else if (d_fixed_point_wipeoff)
+                {
+                    // Remove Doppler in 16-bit integers, rotating the input on the fly
+                    // instead of reading a wipeoff table, and load the FFT input
+                    lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+                    volk_gnsssdr_16ic_s32fc_x2_rotator_16ic(worker.wipeoff_sc, d_input_signal_sc, d_wipeoff_phase_steps[doppler_index], &phase, d_fft_size);
+                    volk_gnsssdr_16ic_convert_32fc(worker.fft_if->get_inbuf(), worker.wipeoff_sc, d_fft_size);
+
+                    // Perform the FFT-based convolution  (parallel time search)
+                    worker.fft_if->execute();
+                }
+            else if (shared_spectra)
+                {
+                    // The shared carrier wiped--off, Fourier transformed incoming signal
+                    spectrum = shared_spectra->spectrum(doppler_index);
+                }
+            else
+                {
+                    // Remove Doppler
+                    volk_32fc_x2_multiply_32fc(worker.fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs->row(doppler_index), d_fft_size);
+
+                    // Perform the FFT-based convolution  (parallel time search)
+                    // Compute the FFT of the carrier wiped--off incoming signal
+                    worker.fft_if->execute();
+                }
+
+            // Correlate with the local code
+            correlate_code(worker, spectrum, shift, d_fft_codes);
+
+            // Compute squared magnitude (and accumulate in case of non-coherent integration)
+            size_t offset = (acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+            float* magnitude = (d_streaming_peaks ? worker.magnitude : d_magnitude_grid[doppler_index]);
+            if (d_streaming_peaks or d_num_noncoherent_integrations_counter == 1)
+                {
+                    volk_32fc_magnitude_squared_32f(magnitude, worker.ifft->get_outbuf() + offset, effective_fft_size);
+                }
+            else
+                {
+                    volk_32fc_magnitude_squared_32f(worker.tmp_buffer, worker.ifft->get_outbuf() + offset, effective_fft_size);
+                    if (d_dwell_scale != 1.0F)
+                        {
+                            volk_32f_s32f_multiply_32f(worker.tmp_buffer, worker.tmp_buffer, d_dwell_scale, effective_fft_size);
+                        }
+                    volk_32f_x2_add_32f(magnitude, magnitude, worker.tmp_buffer, effective_fft_size);
+                }
+            if (d_fft_codes_pilot != nullptr)
+                {
+                    // Same input spectrum against the pilot code, added noncoherently
+                    correlate_code(worker, spectrum, shift, d_fft_codes_pilot);
+                    volk_32fc_magnitude_squared_32f(worker.tmp_buffer, worker.ifft->get_outbuf() + offset, effective_fft_size);
+                    if (d_dwell_scale != 1.0F)
+                        {
+                            volk_32f_s32f_multiply_32f(worker.tmp_buffer, worker.tmp_buffer, d_dwell_scale, effective_fft_size);
+                        }
+                    volk_32f_x2_add_32f(magnitude, magnitude, worker.tmp_buffer, effective_fft_size);
+                }
+            if (d_use_code_phase_mask)
+                {
+                    // Discard the code delays outside the predicted window
+                    volk_32f_x2_multiply_32f(magnitude, magnitude, d_code_phase_mask, effective_fft_size);
+                }
+            if (d_streaming_peaks)
+                {
+                    track_peaks(worker, magnitude, doppler_index);
+                }
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    arma::fmat& dump_grid = d_step_two ? narrow_grid_ : grid_;
+                    memcpy(dump_grid.colptr(doppler_index), d_magnitude_grid[doppler_index], sizeof(float) * effective_fft_size);
+                    if (d_fixed_point_wipeoff)
+                        {
+                            dump_grid.col(doppler_index) *= d_grid_scale;
+                        }
+                }
+        }
+}
+
+
+void pcps_acquisition::load_fixed_point_input()
+{
+    // Block floating point: the whole snapshot is scaled by the power of two
+    // that brings its peak to [2^12, 2^13), so that the rounding of the
+    // rotated samples stays negligible even for few-bit front ends, and the
+    // rotation (up to sqrt(2) times the peak) cannot overflow
+    int32_t peak = 0;
+    for (uint32_t i = 0; i < d_consumed_samples; i++)
+        {
+            peak = std::max(peak, std::max(std::abs(static_cast<int32_t>(lv_creal(d_data_buffer_sc[i]))), std::abs(static_cast<int32_t>(lv_cimag(d_data_buffer_sc[i])))));
+        }
+    d_input_shift = (peak > 0 ? 12 - std::ilogb(static_cast<double>(peak)) : 0);
+    for (uint32_t i = 0; i < d_consumed_samples; i++)
+        {
+            auto re = static_cast<int32_t>(lv_creal(d_data_buffer_sc[i]));
+            auto im = static_cast<int32_t>(lv_cimag(d_data_buffer_sc[i]));
+            if (d_input_shift >= 0)
+                {
+                    re *= (1 << d_input_shift);
+                    im *= (1 << d_input_shift);
+                }
+            else
+                {
+                    re >>= -d_input_shift;
+                    im >>= -d_input_shift;
+                }
+            d_input_signal_sc[i] = lv_cmake(static_cast<int16_t>(re), static_cast<int16_t>(im));
+        }
+    // Each dwell has its own input scaling, but the grid accumulates them in
+    // the scale of the first one, so the next dwells are rescaled before being added
+    float dwell_scale = std::ldexp(1.0F, -2 * d_input_shift);
+    if (d_num_noncoherent_integrations_counter == 0)
+        {
+            d_grid_scale = dwell_scale;
+        }
+    d_dwell_scale = dwell_scale / d_grid_scale;
+    d_input_signal_converted = false;
+}
+
+
+void pcps_acquisition::convert_input_signal()
+{
+    // Float copy of the scaled snapshot, for the few steps that need it
+    if (!d_input_signal_converted)
+        {
+            volk_gnsssdr_16ic_convert_32fc(d_input_signal, d_input_signal_sc, d_fft_size);
+            d_input_signal_converted = true;
+        }
 }
 
 
@@ -650,16 +1548,23 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     int32_t doppler = 0;
     uint32_t indext = 0U;
     int32_t effective_fft_size = (acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
-    if (d_cshort)
+    if (d_fixed_point_wipeoff)
         {
-            volk_gnsssdr_16ic_convert_32fc(d_data_buffer, d_data_buffer_sc, d_consumed_samples);
+            load_fixed_point_input();
         }
-    memcpy(d_input_signal, d_data_buffer, d_consumed_samples * sizeof(gr_complex));
-    if (d_fft_size > d_consumed_samples)
+    else
         {
-            for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+            if (d_cshort)
                 {
-                    d_input_signal[i] = gr_complex(0.0, 0.0);
+                    volk_gnsssdr_16ic_convert_32fc(d_data_buffer, d_data_buffer_sc, d_consumed_samples);
+                }
+            memcpy(d_input_signal, d_data_buffer, d_consumed_samples * sizeof(gr_complex));
+            if (d_fft_size > d_consumed_samples)
+                {
+                    for (uint32_t i = d_consumed_samples; i < d_fft_size; i++)
+                        {
+                            d_input_signal[i] = gr_complex(0.0, 0.0);
+                        }
                 }
         }
     const gr_complex* in = d_input_signal;  // Get the input samples pointer
@@ -671,113 +1576,92 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     DLOG(INFO) << "Channel: " << d_channel
                << " , doing acquisition of satellite: " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN
                << " ,sample stamp: " << samp_count << ", threshold: "
-               << d_threshold << ", doppler_max: " << acq_parameters.doppler_max
+               << d_threshold << ", doppler_center: " << d_doppler_center << ", doppler_max: " << d_doppler_window
                << ", doppler_step: " << d_doppler_step
                << ", use_CFAR_algorithm_flag: " << (d_use_CFAR_algorithm_flag ? "true" : "false");
 
+    if (d_use_code_phase_mask)
+        {
+            update_code_phase_mask(samp_count, effective_fft_size);
+        }
+
     lk.unlock();
 
     if (d_use_CFAR_algorithm_flag or acq_parameters.bit_transition_flag)
         {
             // Compute the input signal power estimation
+            convert_input_signal();
             volk_32fc_magnitude_squared_32f(d_tmp_buffer, in, d_fft_size);
             volk_32f_accumulator_s32f(&d_input_power, d_tmp_buffer, d_fft_size);
             d_input_power /= static_cast<float>(d_fft_size);
+            if (d_fixed_point_wipeoff)
+                {
+                    // In the scale of the grid, that is, of the first dwell
+                    d_input_power *= d_dwell_scale;
+                }
         }
 
     // Doppler frequency grid loop
     if (!d_step_two)
         {
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+            Acq_Shared_Engine::Spectra_sptr shared_spectra;
+            if (acq_parameters.share_input_spectra)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index], d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
+                    // The Doppler-wiped input spectra only depend on the snapshot and on the grid,
+                    // so they are computed once and reused by every channel searching this signal
+                    shared_spectra = Acq_Shared_Engine::instance().get_spectra(grid_key(), samp_count,
+                        d_fft_doppler_shift ? 1 : d_num_doppler_bins, d_fft_size,
+                        [this, in](Acq_Input_Spectra& spectra) { compute_input_spectra(in, spectra); });
+                }
+            else if (d_fft_doppler_shift)
+                {
+                    // Single FFT of the input signal, shared by all the Doppler bins
+                    memcpy(d_fft_if->get_inbuf(), in, d_fft_size * sizeof(gr_complex));
                     d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes, d_fft_size);
-
-                    // Compute the inverse FFT
-                    d_ifft->execute();
-
-                    // Compute squared magnitude (and accumulate in case of non-coherent integration)
-                    size_t offset = (acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
-                        {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index], d_ifft->get_outbuf() + offset, effective_fft_size);
-                        }
-                    else
-                        {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer, d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index], d_magnitude_grid[doppler_index], d_tmp_buffer, effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
-                        {
-                            memcpy(grid_.colptr(doppler_index), d_magnitude_grid[doppler_index], sizeof(float) * effective_fft_size);
-                        }
                 }
+            const gr_complex* input_spectrum = shared_spectra ? shared_spectra->spectrum(0) : d_fft_if->get_outbuf();
+            search_doppler_grid(in, input_spectrum, shared_spectra.get(), d_num_doppler_bins, effective_fft_size);
 
             // Compute the test statistic
             if (d_use_CFAR_algorithm_flag)
                 {
-                    d_test_statistics = max_to_input_power_statistic(indext, doppler, d_input_power, d_num_doppler_bins, acq_parameters.doppler_max, d_doppler_step);
+                    d_test_statistics = max_to_input_power_statistic(indext, doppler, d_input_power, d_num_doppler_bins, -grid_doppler(0), d_doppler_step);
                 }
             else
                 {
-                    d_test_statistics = first_vs_second_peak_statistic(indext, doppler, d_num_doppler_bins, acq_parameters.doppler_max, d_doppler_step);
+                    d_test_statistics = first_vs_second_peak_statistic(indext, doppler, d_num_doppler_bins, -grid_doppler(0), d_doppler_step);
+                }
+            double delay_samples = static_cast<double>(indext);
+            double doppler_hz = static_cast<double>(doppler);
+            if (d_peak_interpolation != Acq_Peak_Interpolator::Method::None)
+                {
+                    convert_input_signal();
+                    refine_peak(in, effective_fft_size, delay_samples, doppler_hz);
+                }
+            delay_samples = std::fmod(delay_samples, static_cast<double>(acq_parameters.samples_per_code));
+            if (delay_samples < 0.0)
+                {
+                    delay_samples += static_cast<double>(acq_parameters.samples_per_code);
                 }
             if (acq_parameters.use_automatic_resampler)
                 {
                     //take into account the acquisition resampler ratio
-                    d_gnss_synchro->Acq_delay_samples = static_cast<double>(std::fmod(static_cast<float>(indext), acq_parameters.samples_per_code)) * acq_parameters.resampler_ratio;
+                    d_gnss_synchro->Acq_delay_samples = delay_samples * acq_parameters.resampler_ratio;
                     d_gnss_synchro->Acq_delay_samples -= static_cast<double>(acq_parameters.resampler_latency_samples);  //account the resampler filter latency
-                    d_gnss_synchro->Acq_doppler_hz = static_cast<double>(doppler);
+                    d_gnss_synchro->Acq_doppler_hz = doppler_hz;
                     d_gnss_synchro->Acq_samplestamp_samples = rint(static_cast<double>(samp_count) * acq_parameters.resampler_ratio);
                 }
             else
                 {
-                    d_gnss_synchro->Acq_delay_samples = static_cast<double>(std::fmod(static_cast<float>(indext), acq_parameters.samples_per_code));
-                    d_gnss_synchro->Acq_doppler_hz = static_cast<double>(doppler);
+                    d_gnss_synchro->Acq_delay_samples = delay_samples;
+                    d_gnss_synchro->Acq_doppler_hz = doppler_hz;
                     d_gnss_synchro->Acq_samplestamp_samples = samp_count;
                 }
         }
     else
         {
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
-                {
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs_step_two[doppler_index], d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal
-                    // with the local FFT'd code reference using SIMD operations with VOLK library
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes, d_fft_size);
-
-                    // compute the inverse FFT
-                    d_ifft->execute();
-
-                    size_t offset = (acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
-                        {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index], d_ifft->get_outbuf() + offset, effective_fft_size);
-                        }
-                    else
-                        {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer, d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index], d_magnitude_grid[doppler_index], d_tmp_buffer, effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
-                        {
-                            memcpy(narrow_grid_.colptr(doppler_index), d_magnitude_grid[doppler_index], sizeof(float) * effective_fft_size);
-                        }
-                }
+            convert_input_signal();
+            search_doppler_grid(in, nullptr, nullptr, d_num_doppler_bins_step2, effective_fft_size);
             // Compute the test statistic
             if (d_use_CFAR_algorithm_flag)
                 {
@@ -807,6 +1691,7 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         }
 
     lk.lock();
+    bool dismissed = false;
     if (!acq_parameters.bit_transition_flag)
         {
             if (d_test_statistics > d_threshold)
@@ -838,9 +1723,17 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
                 {
                     d_buffer_count = 0;
                     d_state = 1;
+                    // Give up before max_dwells if the accumulated statistic is already too weak
+                    if (acq_parameters.sequential_detection and d_num_noncoherent_integrations_counter < acq_parameters.max_dwells and
+                        d_sequential_test.decide(d_test_statistics, d_threshold, d_num_noncoherent_integrations_counter) == Acq_Sequential_Test::Decision::Negative)
+                        {
+                            DLOG(INFO) << "Satellite " << d_gnss_synchro->System << " " << d_gnss_synchro->PRN << " dismissed after "
+                                       << d_num_noncoherent_integrations_counter << " of " << acq_parameters.max_dwells << " dwells";
+                            dismissed = true;
+                        }
                 }
 
-            if (d_num_noncoherent_integrations_counter == acq_parameters.max_dwells)
+            if (dismissed or d_num_noncoherent_integrations_counter == acq_parameters.max_dwells)
                 {
                     if (d_state != 0) send_negative_acquisition();
                     d_state = 0;
@@ -883,30 +1776,156 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         }
     d_worker_active = false;
 
-    if ((d_num_noncoherent_integrations_counter == acq_parameters.max_dwells) or (d_positive_acq == 1))
+    if (dismissed or (d_num_noncoherent_integrations_counter == acq_parameters.max_dwells) or (d_positive_acq == 1))
         {
             // Record results to file if required
             if (d_dump and d_channel == d_dump_channel)
                 {
-                    pcps_acquisition::dump_results(effective_fft_size);
+                    pcps_acquisition::dump_results();
                 }
             d_num_noncoherent_integrations_counter = 0U;
             d_positive_acq = 0;
             // Reset grid
-            for (uint32_t i = 0; i < d_num_doppler_bins; i++)
+            if (!d_streaming_peaks)
                 {
-                    for (uint32_t k = 0; k < d_fft_size; k++)
+                    for (uint32_t i = 0; i < d_num_doppler_bins; i++)
+                        {
+                            for (uint32_t k = 0; k < d_fft_size; k++)
+                                {
+                                    d_magnitude_grid[i][k] = 0.0;
+                                }
+                        }
+                }
+        }
+}
+
+void pcps_acquisition::restart_acquisition()
+{
+    // Restart acquisition variables
+    d_gnss_synchro->Acq_delay_samples = 0.0;
+    d_gnss_synchro->Acq_doppler_hz = 0.0;
+    d_gnss_synchro->Acq_samplestamp_samples = 0ULL;
+    d_gnss_synchro->Acq_doppler_step = 0U;
+    d_mag = 0.0;
+    d_input_power = 0.0;
+    d_test_statistics = 0.0;
+    d_state = 1;
+    d_buffer_count = 0U;
+    d_ring_resync = true;
+    if (!d_step_two)
+        {
+            update_search_window();
+        }
+}
+
+
+void pcps_acquisition::start_step_two()
+{
+    d_doppler_center_step_two = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
+    update_grid_doppler_wipeoffs_step2();
+    d_state = 0;
+    d_active = true;
+}
+
+
+void pcps_acquisition::ring_loop()
+{
+    // Same state machine as general_work, but the snapshots are copied from
+    // the sample ring only while the block is active. An idle block just
+    // sleeps here, and does not touch the samples at all.
+    gr::thread::scoped_lock lk(d_setlock);
+    while (!d_ring_stop)
+        {
+            if (!d_active)
+                {
+                    if (d_step_two)
+                        {
+                            start_step_two();
+                        }
+                    else
+                        {
+                            d_ring_cond.wait(lk);
+                        }
+                    continue;
+                }
+            if (d_state == 0)
+                {
+                    restart_acquisition();
+                    continue;
+                }
+            if (d_ring_resync)
+                {
+                    // Start with the samples arriving now, like a block connected to the stream
+                    d_ring_next_sample = d_sample_ring->sample_counter();
+                    if (acq_parameters.share_input_spectra)
+                        {
+                            // Keep the snapshots aligned, so the input spectra can be shared
+                            uint64_t misalignment = d_ring_next_sample % static_cast<uint64_t>(d_consumed_samples);
+                            if (misalignment != 0)
+                                {
+                                    d_ring_next_sample += static_cast<uint64_t>(d_consumed_samples) - misalignment;
+                                }
+                        }
+                    d_ring_resync = false;
+                }
+
+            uint64_t start = d_ring_next_sample;
+            void* buffer = (d_cshort ? static_cast<void*>(d_data_buffer_sc) : static_cast<void*>(d_data_buffer));
+            lk.unlock();
+            Acq_Sample_Ring::Read_Status status = d_sample_ring->read(start, d_consumed_samples, buffer, std::chrono::milliseconds(100));
+            lk.lock();
+            if (status == Acq_Sample_Ring::Read_Status::Closed)
+                {
+                    // End of the stream: wait for stop()
+                    if (!d_ring_stop)
                         {
-                            d_magnitude_grid[i][k] = 0.0;
+                            d_ring_cond.wait(lk);
                         }
+                    continue;
+                }
+            if (status == Acq_Sample_Ring::Read_Status::Timeout or !d_active or d_state != 1 or d_ring_resync)
+                {
+                    continue;  // no samples yet, or the channel restarted the search meanwhile
                 }
+            d_ring_next_sample = start + d_consumed_samples;
+            d_sample_counter = d_ring_next_sample;
+            uint64_t samp_count = d_sample_counter;
+            lk.unlock();
+            acquisition_core(samp_count);
+            lk.lock();
         }
 }
 
+
 // Called by gnuradio to enable drivers, etc for i/o devices.
 bool pcps_acquisition::start()
 {
     d_sample_counter = 0ULL;
+    if (d_sample_ring and !d_ring_thread.joinable())
+        {
+            d_ring_stop = false;
+            d_ring_resync = true;
+            d_ring_thread = std::thread(&pcps_acquisition::ring_loop, this);
+        }
+    return true;
+}
+
+
+bool pcps_acquisition::stop()
+{
+    if (d_ring_thread.joinable())
+        {
+            gr::thread::scoped_lock lock(d_setlock);
+            d_ring_stop = true;
+            lock.unlock();
+            d_ring_cond.notify_all();
+            d_ring_thread.join();
+        }
+    // Make sure the dump files are complete when the flowgraph is done
+    if (d_dump_writer)
+        {
+            d_dump_writer->flush();
+        }
     return true;
 }
 
@@ -934,10 +1953,7 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 }
             if (d_step_two)
                 {
-                    d_doppler_center_step_two = static_cast<float>(d_gnss_synchro->Acq_doppler_hz);
-                    update_grid_doppler_wipeoffs_step2();
-                    d_state = 0;
-                    d_active = true;
+                    start_step_two();
                 }
             return 0;
         }
@@ -946,16 +1962,7 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
         {
         case 0:
             {
-                // Restart acquisition variables
-                d_gnss_synchro->Acq_delay_samples = 0.0;
-                d_gnss_synchro->Acq_doppler_hz = 0.0;
-                d_gnss_synchro->Acq_samplestamp_samples = 0ULL;
-                d_gnss_synchro->Acq_doppler_step = 0U;
-                d_mag = 0.0;
-                d_input_power = 0.0;
-                d_test_statistics = 0.0;
-                d_state = 1;
-                d_buffer_count = 0U;
+                restart_acquisition();
                 if (!acq_parameters.blocking_on_standby)
                     {
                         d_sample_counter += static_cast<uint64_t>(ninput_items[0]);  // sample counter
@@ -965,6 +1972,19 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
             }
         case 1:
             {
+                if (acq_parameters.share_input_spectra and (d_buffer_count == 0))
+                    {
+                        // Align the snapshot to a multiple of its length, so all the channels
+                        // searching this signal use the same snapshots and can share their spectra
+                        uint64_t misalignment = d_sample_counter % static_cast<uint64_t>(d_consumed_samples);
+                        if (misalignment != 0)
+                            {
+                                auto skip = static_cast<int32_t>(std::min(static_cast<uint64_t>(d_consumed_samples) - misalignment, static_cast<uint64_t>(ninput_items[0])));
+                                d_sample_counter += static_cast<uint64_t>(skip);
+                                consume_each(skip);
+                                break;
+                            }
+                    }
                 uint32_t buff_increment;
                 if (d_cshort)
                     {
@@ -1013,7 +2033,21 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                     }
                 else
                     {
-                        gr::thread::thread d_worker(&pcps_acquisition::acquisition_core, this, d_sample_counter);
+                        // Hand the dwell to the shared worker pool. The job keeps a reference
+                        // to this block so it cannot be destroyed while the job is pending.
+                        gr::basic_block_sptr self = shared_from_this();
+                        uint64_t samp_count = d_sample_counter;
+                        if (!Acq_Worker_Pool::instance().submit([self, this, samp_count] { acquisition_core(samp_count); }))
+                            {
+                                // Queue full: drop the snapshot and take a new one for this
+                                // dwell, so that the input buffer shared with the other
+                                // channels is not held back while the pool is busy
+                                d_state = 1;
+                                d_buffer_count = 0U;
+                                d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
+                                consume_each(ninput_items[0]);
+                                break;
+                            }
                         d_worker_active = true;
                     }
                 consume_each(0);
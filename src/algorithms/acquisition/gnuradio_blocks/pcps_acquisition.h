@@ -52,17 +52,73 @@
 #ifndef GNSS_SDR_PCPS_ACQUISITION_H_
 #define GNSS_SDR_PCPS_ACQUISITION_H_
 
+#include "acq_code_spectra_cache.h"
 #include "acq_conf.h"
+#include "acq_dump_writer.h"
+#include "acq_peak_interpolator.h"
+#include "acq_sample_ring.h"
+#include "acq_search_window.h"
+#include "acq_sequential_test.h"
+#include "acq_shared_engine.h"
+#include "acq_wipeoff_store.h"
+#include "gnss_sdr_fft.h"
 #include "gnss_synchro.h"
 #include <armadillo>
 #include <gnuradio/block.h>
-#include <gnuradio/fft/fft.h>
 #include <volk/volk.h>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 
 class pcps_acquisition;
 
+/*!
+ * \brief FFT plans, scratch buffers and peak record used to search a
+ * subset of the Doppler bins of the acquisition grid.
+ */
+class Acq_Doppler_Worker
+{
+public:
+    Gnss_Fft* fft_if;
+    Gnss_Fft* ifft;
+    float* magnitude;  // scratch magnitude row
+    float* tmp_buffer;
+    lv_16sc_t* wipeoff_sc;  // carrier wiped-off input, only with the fixed-point wipeoff
+    float first_peak;
+    float second_peak;
+    uint32_t peak_index_doppler;
+    uint32_t peak_index_time;
+};
+
+/*!
+ * \brief Copy of the results of a search, written to a dump file by the
+ * background writer while the block goes on with the next one.
+ */
+class Acq_Dump_Record
+{
+public:
+    std::string filename;
+    arma::fmat grid;
+    arma::fmat narrow_grid;
+    bool two_steps;
+    uint32_t doppler_max;
+    int32_t doppler_center;
+    uint32_t doppler_step;
+    int32_t positive_acq;
+    float acq_doppler_hz;
+    float acq_delay_samples;
+    float test_statistic;
+    float threshold;
+    float input_power;
+    uint64_t sample_counter;
+    uint32_t prn;
+    uint32_t num_dwells;
+    float doppler_step_narrow;
+    float doppler_grid_narrow_min;
+};
+
 typedef boost::shared_ptr<pcps_acquisition> pcps_acquisition_sptr;
 
 pcps_acquisition_sptr
@@ -85,7 +141,21 @@ private:
     void update_local_carrier(gr_complex* carrier_vector, int32_t correlator_length_samples, float freq);
     void update_grid_doppler_wipeoffs();
     void update_grid_doppler_wipeoffs_step2();
+    void update_doppler_bin_shifts();
+    void prepare_fdma_local_code();
+    void fill_code_fft_input(const std::complex<float>* code);
+    Acq_Code_Spectra_Cache::Spectrum_sptr get_code_spectrum(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+    void compute_input_spectra(const gr_complex* in, Acq_Input_Spectra& spectra);
+    void load_fixed_point_input();
+    void convert_input_signal();
+    std::string grid_key() const;
+    std::string wipeoff_key() const;
+    bool is_multiple_of_fft_bin(double freq_hz) const;
     bool is_fdma();
+    double carrier_frequency_hz() const;
+    int32_t grid_doppler(uint32_t doppler_index) const;
+    void update_search_window();
+    void update_code_phase_mask(uint64_t samp_count, int32_t effective_fft_size);
 
     void acquisition_core(uint64_t samp_count);
 
@@ -93,12 +163,25 @@ private:
 
     void send_positive_acquisition();
 
-    void dump_results(int32_t effective_fft_size);
+    void dump_results();
+    static void write_dump_file(const Acq_Dump_Record& record);
 
+    float second_peak(const float* magnitude, uint32_t index_time, float* tmp_buffer);
+    void track_peaks(Acq_Doppler_Worker& worker, const float* magnitude, uint32_t doppler_index);
+    void search_doppler_grid(const gr_complex* in, const gr_complex* input_spectrum, const Acq_Input_Spectra* shared_spectra, uint32_t num_doppler_bins, int32_t effective_fft_size);
+    void correlate_code(Acq_Doppler_Worker& worker, const gr_complex* spectrum, uint32_t shift, const gr_complex* fft_codes);
+    void search_doppler_bins(Acq_Doppler_Worker& worker, const gr_complex* in, const gr_complex* input_spectrum, const Acq_Input_Spectra* shared_spectra, uint32_t first_bin, uint32_t last_bin, int32_t effective_fft_size);
     float first_vs_second_peak_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
     float max_to_input_power_statistic(uint32_t& indext, int32_t& doppler, float input_power, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
+    void refine_peak(const gr_complex* in, int32_t effective_fft_size, double& delay_samples, double& doppler_hz);
+    float correlation_power(const gr_complex* in, double delay_samples, double doppler_hz);
 
     bool start();
+    bool stop();
+
+    void restart_acquisition();
+    void start_step_two();
+    void ring_loop();
 
 
     Acq_Conf acq_parameters;
@@ -107,33 +190,65 @@ private:
     bool d_cshort;
     bool d_step_two;
     bool d_use_CFAR_algorithm_flag;
+    bool d_fft_doppler_shift;
+    bool d_streaming_peaks;
     int32_t d_positive_acq;
     float d_threshold;
     float d_mag;
     float d_input_power;
     float d_test_statistics;
+    float d_first_peak;
+    float d_second_peak;
+    uint32_t d_peak_index_doppler;
+    uint32_t d_peak_index_time;
     float* d_magnitude;
-    float** d_magnitude_grid;
+    float** d_magnitude_grid;  // not allocated when d_streaming_peaks is set
+    Acq_Peak_Interpolator::Method d_peak_interpolation;
+    gr_complex* d_code_replica;  // code as laid out in the FFT buffer, only kept to check the refined peak
     float* d_tmp_buffer;
-    gr_complex* d_input_signal;
+    gr_complex* d_input_signal;  // only converted on demand with the fixed-point wipeoff
+    bool d_fixed_point_wipeoff;
+    bool d_input_signal_converted;
+    lv_16sc_t* d_input_signal_sc;  // input block-scaled by 2^d_input_shift, fixed-point wipeoff only
+    int32_t d_input_shift;
+    float d_grid_scale;                             // undoes the input scaling of the first dwell on the grid magnitudes
+    float d_dwell_scale;                            // brings the magnitudes of the current dwell to the scale of the first one
+    std::vector<gr_complex> d_wipeoff_phase_steps;  // carrier phase increment of each Doppler bin
     uint32_t d_samplesPerChip;
     int64_t d_old_freq;
     int32_t d_state;
     uint32_t d_channel;
+    int32_t d_rf_channel;
     uint32_t d_doppler_step;
     float d_doppler_center_step_two;
     uint32_t d_num_noncoherent_integrations_counter;
+    Acq_Sequential_Test d_sequential_test;
     uint32_t d_fft_size;
     uint32_t d_consumed_samples;
     uint32_t d_num_doppler_bins;
+    uint32_t d_full_num_doppler_bins;  // Doppler bins of the whole [-doppler_max, doppler_max] range
+    uint32_t d_magnitude_grid_rows;
+    int32_t d_doppler_center;   // center of the current search grid [Hz]
+    uint32_t d_doppler_window;  // half width of the current search grid [Hz]
+    Acq_Search_Window d_search_window;
+    bool d_search_window_narrowed;  // the current search uses d_search_window
+    char d_failed_window_system;    // satellite and window of the last negative narrowed search
+    uint32_t d_failed_window_prn;
+    double d_failed_window_time_s;
+    bool d_use_code_phase_mask;
+    float* d_code_phase_mask;  // 1 inside the predicted code phase window, 0 outside
     uint64_t d_sample_counter;
-    gr_complex** d_grid_doppler_wipeoffs;
+    double d_fft_bin_hz;
+    std::vector<uint32_t> d_doppler_bin_shifts;
+    Acq_Wipeoff_Store::Table_sptr d_grid_doppler_wipeoffs;  // shared among the blocks with the same grid
     gr_complex** d_grid_doppler_wipeoffs_step_two;
     gr_complex* d_fft_codes;
+    gr_complex* d_fft_codes_pilot;  // only when combining the data and pilot components
     gr_complex* d_data_buffer;
     lv_16sc_t* d_data_buffer_sc;
-    gr::fft::fft_complex* d_fft_if;
-    gr::fft::fft_complex* d_ifft;
+    Gnss_Fft* d_fft_if;
+    Gnss_Fft* d_ifft;
+    std::vector<Acq_Doppler_Worker> d_doppler_workers;  // the first one uses the plans and buffers above
     Gnss_Synchro* d_gnss_synchro;
     arma::fmat grid_;
     arma::fmat narrow_grid_;
@@ -143,6 +258,13 @@ private:
     uint32_t d_buffer_count;
     bool d_dump;
     std::string d_dump_filename;
+    std::unique_ptr<Acq_Dump_Writer> d_dump_writer;
+    std::shared_ptr<Acq_Sample_Ring> d_sample_ring;  // snapshots source when not connected to the stream
+    std::thread d_ring_thread;
+    gr::thread::condition_variable d_ring_cond;  // wakes up the ring thread when the block is activated
+    bool d_ring_stop;
+    bool d_ring_resync;  // the next snapshot starts at the most recent sample of the ring
+    uint64_t d_ring_next_sample;
 
 public:
     ~pcps_acquisition();
@@ -177,6 +299,29 @@ public:
       */
     void set_local_code(std::complex<float>* code);
 
+    /*!
+      * \brief Sets local code for PCPS acquisition algorithm, looking up its
+      * spectrum in the process-wide code spectra cache first.
+      * \param code_id - Identifier of the signal and code options.
+      * \param prn - PRN of the code.
+      * \param generate - Generates the code on a cache miss.
+      */
+    void set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
+    /*!
+      * \brief Sets the pilot code when the data and pilot components are
+      * combined (combine_data_pilot). The code set with set_local_code() is
+      * then the data one. Both correlations are computed from the same
+      * input spectrum and their squared magnitudes are added.
+      */
+    void set_pilot_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
+    /*!
+      * \brief Computes the spectrum of a code and stores it in the code
+      * spectra cache, without changing the code currently in use.
+      */
+    void warm_up_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
     /*!
       * \brief Starts acquisition algorithm, turning from standby mode to
       * active mode
@@ -186,6 +331,7 @@ public:
     {
         gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
         d_active = active;
+        d_ring_cond.notify_one();
     }
 
     /*!
@@ -205,6 +351,16 @@ public:
         d_channel = channel;
     }
 
+    /*!
+      * \brief Set the RF chain (signal conditioner) that feeds this channel.
+      * Only channels on the same RF chain share their input spectra.
+      */
+    inline void set_rf_channel(int32_t rf_channel)
+    {
+        gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+        d_rf_channel = rf_channel;
+    }
+
     /*!
       * \brief Set statistics threshold of PCPS algorithm.
       * \param threshold - Threshold for signal detection (check \ref Navitec2012,
@@ -239,6 +395,13 @@ public:
 
     void set_resampler_latency(uint32_t latency_samples);
 
+    /*!
+      * \brief Takes the snapshots from the sample ring \p ring_key instead
+      * of the input stream. Returns false if the block is not configured to
+      * use sample rings, in which case it must be connected to the stream.
+      */
+    bool set_sample_ring(const std::string& ring_key);
+
     /*!
       * \brief Parallel Code Phase Search Acquisition signal processing.
       */
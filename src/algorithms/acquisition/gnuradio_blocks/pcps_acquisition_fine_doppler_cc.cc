@@ -78,10 +78,10 @@ pcps_acquisition_fine_doppler_cc::pcps_acquisition_fine_doppler_cc(const Acq_Con
     d_10_ms_buffer = static_cast<gr_complex *>(volk_gnsssdr_malloc(50 * d_samples_per_ms * sizeof(gr_complex), volk_gnsssdr_get_alignment()));
 
     // Direct FFT
-    d_fft_if = new gr::fft::fft_complex(d_fft_size, true);
+    d_fft_if = new Gnss_Fft(d_fft_size, true);
 
     // Inverse FFT
-    d_ifft = new gr::fft::fft_complex(d_fft_size, false);
+    d_ifft = new Gnss_Fft(d_fft_size, false);
 
     // For dumping samples into a file
     d_dump = conf_.dump;
@@ -208,6 +208,24 @@ void pcps_acquisition_fine_doppler_cc::set_local_code(std::complex<float> *code)
 }
 
 
+void pcps_acquisition_fine_doppler_cc::set_local_code(const std::string &code_id, uint32_t prn, const Acq_Code_Generator &generate)
+{
+    Acq_Code_Key key;
+    key.block = "fine_doppler";
+    key.code_id = code_id;
+    key.prn = prn;
+    key.fs = d_fs_in;
+    key.fft_size = d_fft_size;
+    key.dwell_samples = d_fft_size;
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = Acq_Code_Spectra_Cache::instance().get(key, 0, [this, &generate, prn](Acq_Code_Spectrum &code_spectrum) {
+        memcpy(d_fft_if->get_inbuf(), generate(prn), sizeof(gr_complex) * d_fft_size);
+        d_fft_if->execute();
+        volk_32fc_conjugate_32fc(code_spectrum.spectrum(), d_fft_if->get_outbuf(), d_fft_size);
+    });
+    memcpy(d_fft_codes, spectrum->spectrum(), sizeof(gr_complex) * d_fft_size);
+}
+
+
 void pcps_acquisition_fine_doppler_cc::init()
 {
     d_gnss_synchro->Flag_valid_acquisition = false;
@@ -405,7 +423,7 @@ int pcps_acquisition_fine_doppler_cc::estimate_Doppler()
     int signal_samples = prn_replicas * d_fft_size;
     //int fft_size_extended = nextPowerOf2(signal_samples * zero_padding_factor);
     int fft_size_extended = signal_samples * zero_padding_factor;
-    auto *fft_operator = new gr::fft::fft_complex(fft_size_extended, true);
+    auto *fft_operator = new Gnss_Fft(fft_size_extended, true);
     //zero padding the entire vector
     std::fill_n(fft_operator->get_inbuf(), fft_size_extended, gr_complex(0.0, 0.0));
 
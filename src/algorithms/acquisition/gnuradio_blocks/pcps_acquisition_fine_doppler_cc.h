@@ -49,11 +49,12 @@
 #ifndef GNSS_SDR_PCPS_ACQUISITION_FINE_DOPPLER_CC_H_
 #define GNSS_SDR_PCPS_ACQUISITION_FINE_DOPPLER_CC_H_
 
+#include "acq_code_spectra_cache.h"
 #include "acq_conf.h"
+#include "gnss_sdr_fft.h"
 #include "gnss_synchro.h"
 #include <armadillo>
 #include <gnuradio/block.h>
-#include <gnuradio/fft/fft.h>
 #include <gnuradio/gr_complex.h>
 #include <fstream>
 #include <string>
@@ -107,8 +108,8 @@ private:
     float** d_grid_data;
     gr_complex** d_grid_doppler_wipeoffs;
 
-    gr::fft::fft_complex* d_fft_if;
-    gr::fft::fft_complex* d_ifft;
+    Gnss_Fft* d_fft_if;
+    Gnss_Fft* d_ifft;
     Gnss_Synchro* d_gnss_synchro;
     unsigned int d_code_phase;
     float d_doppler_freq;
@@ -163,6 +164,15 @@ public:
      */
     void set_local_code(std::complex<float>* code);
 
+    /*!
+     * \brief Sets local code for PCPS acquisition algorithm, looking up its
+     * spectrum in the process-wide code spectra cache first.
+     * \param code_id - Identifier of the signal and code options.
+     * \param prn - PRN of the code.
+     * \param generate - Generates the code on a cache miss.
+     */
+    void set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
     /*!
      * \brief Starts acquisition algorithm, turning from standby mode to
      * active mode
@@ -142,6 +142,28 @@ pcps_assisted_acquisition_cc::~pcps_assisted_acquisition_cc()
 void pcps_assisted_acquisition_cc::set_local_code(std::complex<float> *code)
 {
     memcpy(d_fft_if->get_inbuf(), code, sizeof(gr_complex) * d_fft_size);
+    d_fft_if->execute();  // We need the FFT of local code
+
+    //Conjugate the local code
+    volk_32fc_conjugate_32fc(d_fft_codes, d_fft_if->get_outbuf(), d_fft_size);
+}
+
+
+void pcps_assisted_acquisition_cc::set_local_code(const std::string &code_id, uint32_t prn, const Acq_Code_Generator &generate)
+{
+    Acq_Code_Key key;
+    key.block = "assisted";
+    key.code_id = code_id;
+    key.prn = prn;
+    key.fs = d_fs_in;
+    key.fft_size = d_fft_size;
+    key.dwell_samples = d_fft_size;
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = Acq_Code_Spectra_Cache::instance().get(key, 0, [this, &generate, prn](Acq_Code_Spectrum &code_spectrum) {
+        memcpy(d_fft_if->get_inbuf(), generate(prn), sizeof(gr_complex) * d_fft_size);
+        d_fft_if->execute();
+        volk_32fc_conjugate_32fc(code_spectrum.spectrum(), d_fft_if->get_outbuf(), d_fft_size);
+    });
+    memcpy(d_fft_codes, spectrum->spectrum(), sizeof(gr_complex) * d_fft_size);
 }
 
 
@@ -157,11 +179,8 @@ void pcps_assisted_acquisition_cc::init()
     d_gnss_synchro->Acq_samplestamp_samples = 0ULL;
     d_input_power = 0.0;
     d_state = 0;
-
-    d_fft_if->execute();  // We need the FFT of local code
-
-    //Conjugate the local code
-    volk_32fc_conjugate_32fc(d_fft_codes, d_fft_if->get_outbuf(), d_fft_size);
+    // The code spectrum is already in d_fft_codes: both set_local_code()
+    // overloads compute it, and the cached one leaves no code in the FFT input
 }
 
 
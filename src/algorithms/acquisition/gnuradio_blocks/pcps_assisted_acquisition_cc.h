@@ -48,6 +48,7 @@
 #ifndef GNSS_SDR_PCPS_ASSISTED_ACQUISITION_CC_H_
 #define GNSS_SDR_PCPS_ASSISTED_ACQUISITION_CC_H_
 
+#include "acq_code_spectra_cache.h"
 #include "gnss_synchro.h"
 #include <gnuradio/block.h>
 #include <gnuradio/fft/fft.h>
@@ -176,6 +177,15 @@ public:
      */
     void set_local_code(std::complex<float>* code);
 
+    /*!
+     * \brief Sets local code for PCPS acquisition algorithm, looking up its
+     * spectrum in the process-wide code spectra cache first.
+     * \param code_id - Identifier of the signal and code options.
+     * \param prn - PRN of the code.
+     * \param generate - Generates the code on a cache miss.
+     */
+    void set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
     /*!
      * \brief Starts acquisition algorithm, turning from standby mode to
      * active mode
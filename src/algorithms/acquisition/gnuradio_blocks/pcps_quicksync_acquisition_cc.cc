@@ -108,9 +108,9 @@ pcps_quicksync_acquisition_cc::pcps_quicksync_acquisition_cc(
     d_code = new gr_complex[d_samples_per_code]();
 
     // Direct FFT
-    d_fft_if = new gr::fft::fft_complex(d_fft_size, true);
+    d_fft_if = new Gnss_Fft(d_fft_size, true);
     // Inverse FFT
-    d_ifft = new gr::fft::fft_complex(d_fft_size, false);
+    d_ifft = new Gnss_Fft(d_fft_size, false);
 
     // For dumping samples into a file
     d_dump = dump;
@@ -193,6 +193,34 @@ void pcps_quicksync_acquisition_cc::set_local_code(std::complex<float>* code)
 }
 
 
+void pcps_quicksync_acquisition_cc::set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate)
+{
+    Acq_Code_Key key;
+    key.block = "quicksync_" + std::to_string(d_folding_factor);
+    key.code_id = code_id;
+    key.prn = prn;
+    key.fs = d_fs_in;
+    key.fft_size = d_fft_size;
+    key.dwell_samples = d_fft_size * d_folding_factor;
+    // The unfolded code is kept along with the spectrum for the final time-domain correlation
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = Acq_Code_Spectra_Cache::instance().get(key, d_samples_per_code, [this, &generate, prn](Acq_Code_Spectrum& code_spectrum) {
+        const gr_complex* code = generate(prn);
+        memcpy(code_spectrum.code(), code, sizeof(gr_complex) * d_samples_per_code);
+        memcpy(d_fft_if->get_inbuf(), d_code_folded, sizeof(gr_complex) * (d_fft_size));
+        for (uint32_t i = 0; i < d_folding_factor; i++)
+            {
+                std::transform((code + i * d_fft_size), (code + ((i + 1) * d_fft_size)),
+                    d_fft_if->get_inbuf(), d_fft_if->get_inbuf(),
+                    std::plus<gr_complex>());
+            }
+        d_fft_if->execute();
+        volk_32fc_conjugate_32fc(code_spectrum.spectrum(), d_fft_if->get_outbuf(), d_fft_size);
+    });
+    memcpy(d_code, spectrum->code(), sizeof(gr_complex) * d_samples_per_code);
+    memcpy(d_fft_codes, spectrum->spectrum(), sizeof(gr_complex) * d_fft_size);
+}
+
+
 void pcps_quicksync_acquisition_cc::init()
 {
     d_gnss_synchro->Flag_valid_acquisition = false;
@@ -51,9 +51,10 @@
 #ifndef GNSS_SDR_PCPS_QUICKSYNC_ACQUISITION_CC_H_
 #define GNSS_SDR_PCPS_QUICKSYNC_ACQUISITION_CC_H_
 
+#include "acq_code_spectra_cache.h"
+#include "gnss_sdr_fft.h"
 #include "gnss_synchro.h"
 #include <gnuradio/block.h>
-#include <gnuradio/fft/fft.h>
 #include <gnuradio/gr_complex.h>
 #include <algorithm>
 #include <cassert>
@@ -135,9 +136,9 @@ private:
     gr_complex** d_grid_doppler_wipeoffs;
     uint32_t d_num_doppler_bins;
     gr_complex* d_fft_codes;
-    gr::fft::fft_complex* d_fft_if;
-    gr::fft::fft_complex* d_fft_if2;
-    gr::fft::fft_complex* d_ifft;
+    Gnss_Fft* d_fft_if;
+    Gnss_Fft* d_fft_if2;
+    Gnss_Fft* d_ifft;
     Gnss_Synchro* d_gnss_synchro;
     uint32_t d_code_phase;
     float d_doppler_freq;
@@ -188,6 +189,15 @@ public:
      */
     void set_local_code(std::complex<float>* code);
 
+    /*!
+     * \brief Sets local code for PCPS acquisition algorithm, looking up its
+     * spectrum in the process-wide code spectra cache first.
+     * \param code_id - Identifier of the signal and code options.
+     * \param prn - PRN of the code.
+     * \param generate - Generates the code on a cache miss.
+     */
+    void set_local_code(const std::string& code_id, uint32_t prn, const Acq_Code_Generator& generate);
+
     /*!
      * \brief Starts acquisition algorithm, turning from standby mode to
      * active mode
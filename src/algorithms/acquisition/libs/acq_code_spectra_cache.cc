@@ -0,0 +1,148 @@
+/*!
+ * \file acq_code_spectra_cache.cc
+ * \brief Process-wide cache of the conjugated FFTs of the local codes used
+ * by the acquisition blocks.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_code_spectra_cache.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <tuple>
+
+
+Acq_Code_Key::Acq_Code_Key()
+{
+    prn = 0U;
+    fs = 0LL;
+    fft_size = 0U;
+    dwell_samples = 0U;
+}
+
+
+bool Acq_Code_Key::operator<(const Acq_Code_Key& other) const
+{
+    return std::tie(block, code_id, prn, fs, fft_size, dwell_samples) <
+           std::tie(other.block, other.code_id, other.prn, other.fs, other.fft_size, other.dwell_samples);
+}
+
+
+Acq_Code_Spectrum::Acq_Code_Spectrum(uint32_t fft_size, uint32_t code_size)
+{
+    d_fft_size = fft_size;
+    d_code_size = code_size;
+    d_spectrum = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(fft_size * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+    d_code = nullptr;
+    if (code_size > 0)
+        {
+            d_code = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(code_size * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+        }
+}
+
+
+Acq_Code_Spectrum::~Acq_Code_Spectrum()
+{
+    volk_gnsssdr_free(d_spectrum);
+    if (d_code != nullptr)
+        {
+            volk_gnsssdr_free(d_code);
+        }
+}
+
+
+Acq_Code_Spectra_Cache& Acq_Code_Spectra_Cache::instance()
+{
+    static Acq_Code_Spectra_Cache cache;
+    return cache;
+}
+
+
+Acq_Code_Spectra_Cache::Acq_Code_Spectra_Cache()
+{
+    d_hits = 0ULL;
+    d_misses = 0ULL;
+}
+
+
+Acq_Code_Spectra_Cache::Spectrum_sptr Acq_Code_Spectra_Cache::get(const Acq_Code_Key& key, uint32_t code_size, const Compute_function& compute)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    auto it = d_spectra.find(key);
+    if (it != d_spectra.end())
+        {
+            d_hits++;
+            return it->second;
+        }
+    d_misses++;
+    lock.unlock();
+
+    // Computed out of the lock: each block uses its own FFT plan, and two
+    // blocks racing for the same key just produce the same result twice
+    std::shared_ptr<Acq_Code_Spectrum> spectrum = std::make_shared<Acq_Code_Spectrum>(key.fft_size, code_size);
+    compute(*spectrum);
+
+    lock.lock();
+    return d_spectra.insert(std::make_pair(key, Spectrum_sptr(spectrum))).first->second;
+}
+
+
+Acq_Code_Spectra_Cache::Spectrum_sptr Acq_Code_Spectra_Cache::find(const Acq_Code_Key& key) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    auto it = d_spectra.find(key);
+    if (it != d_spectra.end())
+        {
+            return it->second;
+        }
+    return nullptr;
+}
+
+
+size_t Acq_Code_Spectra_Cache::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_spectra.size();
+}
+
+
+uint64_t Acq_Code_Spectra_Cache::hits() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_hits;
+}
+
+
+uint64_t Acq_Code_Spectra_Cache::misses() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_misses;
+}
+
+
+void Acq_Code_Spectra_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_spectra.clear();
+}
@@ -0,0 +1,172 @@
+/*!
+ * \file acq_code_spectra_cache.h
+ * \brief Process-wide cache of the conjugated FFTs of the local codes used
+ * by the acquisition blocks.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_CODE_SPECTRA_CACHE_H_
+#define GNSS_SDR_ACQ_CODE_SPECTRA_CACHE_H_
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+
+/*!
+ * \brief Generates the sampled local code of a given PRN, laid out as
+ * expected by the set_local_code(std::complex<float>*) method of the block.
+ * The returned buffer is owned by the caller of the cache (the adapter).
+ */
+using Acq_Code_Generator = std::function<const std::complex<float>*(uint32_t prn)>;
+
+
+/*!
+ * \brief Identifies a code spectrum. Two blocks with the same key compute
+ * exactly the same spectrum.
+ */
+class Acq_Code_Key
+{
+public:
+    std::string block;       // acquisition algorithm and code layout in the FFT buffer
+    std::string code_id;     // signal and code options (pilot, cboc, ...)
+    uint32_t prn;
+    int64_t fs;              // sampling rate of the code, in samples per second
+    uint32_t fft_size;
+    uint32_t dwell_samples;  // samples consumed per dwell
+
+    Acq_Code_Key();
+    bool operator<(const Acq_Code_Key& other) const;
+};
+
+
+/*!
+ * \brief Conjugated FFT of a local code, and optionally the time-domain
+ * code it comes from (for algorithms that also correlate in time).
+ */
+class Acq_Code_Spectrum
+{
+public:
+    Acq_Code_Spectrum(uint32_t fft_size, uint32_t code_size);
+    ~Acq_Code_Spectrum();
+
+    Acq_Code_Spectrum(const Acq_Code_Spectrum&) = delete;
+    Acq_Code_Spectrum& operator=(const Acq_Code_Spectrum&) = delete;
+
+    inline std::complex<float>* spectrum()
+    {
+        return d_spectrum;
+    }
+
+    inline const std::complex<float>* spectrum() const
+    {
+        return d_spectrum;
+    }
+
+    inline std::complex<float>* code()
+    {
+        return d_code;
+    }
+
+    inline const std::complex<float>* code() const
+    {
+        return d_code;
+    }
+
+    inline uint32_t fft_size() const
+    {
+        return d_fft_size;
+    }
+
+    inline uint32_t code_size() const
+    {
+        return d_code_size;
+    }
+
+private:
+    std::complex<float>* d_spectrum;
+    std::complex<float>* d_code;
+    uint32_t d_fft_size;
+    uint32_t d_code_size;
+};
+
+
+/*!
+ * \brief This class implements a lazily filled, process-wide cache of
+ * code spectra.
+ *
+ * The conjugated FFT of a local code only depends on the signal, the PRN,
+ * the sampling rate and the dwell length, so it is computed once and then
+ * shared, read-only, by every acquisition block and channel. Switching to a
+ * new PRN then costs a lookup instead of the code generation plus an FFT.
+ */
+class Acq_Code_Spectra_Cache
+{
+public:
+    using Spectrum_sptr = std::shared_ptr<const Acq_Code_Spectrum>;
+    using Compute_function = std::function<void(Acq_Code_Spectrum&)>;
+
+    static Acq_Code_Spectra_Cache& instance();
+
+    /*!
+     * \brief Returns the spectrum identified by \p key. On a miss, a new
+     * Acq_Code_Spectrum with room for \p code_size time-domain samples is
+     * filled by \p compute and stored.
+     */
+    Spectrum_sptr get(const Acq_Code_Key& key, uint32_t code_size, const Compute_function& compute);
+
+    /*!
+     * \brief Returns the spectrum identified by \p key, or nullptr if it
+     * has not been computed yet.
+     */
+    Spectrum_sptr find(const Acq_Code_Key& key) const;
+
+    size_t size() const;
+    uint64_t hits() const;
+    uint64_t misses() const;
+
+    /*!
+     * \brief Drops all the stored spectra. Blocks holding one keep it alive.
+     */
+    void clear();
+
+    Acq_Code_Spectra_Cache(const Acq_Code_Spectra_Cache&) = delete;
+    Acq_Code_Spectra_Cache& operator=(const Acq_Code_Spectra_Cache&) = delete;
+
+private:
+    Acq_Code_Spectra_Cache();
+
+    std::map<Acq_Code_Key, Spectrum_sptr> d_spectra;
+    uint64_t d_hits;
+    uint64_t d_misses;
+    mutable std::mutex d_mutex;
+};
+
+#endif
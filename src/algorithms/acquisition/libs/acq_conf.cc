@@ -49,8 +49,23 @@ Acq_Conf::Acq_Conf()
     dump = false;
     blocking = false;
     make_2_steps = false;
+    sequential_detection = false;
+    sequential_dismissal_ratio = 0.5;
+    peak_interpolation = "none";
+    peak_interpolation_check = false;
+    fft_doppler_shift = false;
+    share_input_spectra = false;
+    fixed_point_wipeoff = false;
+    combine_data_pilot = false;
+    warm_up_code_spectra = false;
+    doppler_workers = 1U;
+    use_search_windows = false;
+    use_sample_ring = false;
+    fdma_channelized = false;
     dump_filename = "";
     dump_channel = 0U;
+    dump_queue_size = 16U;
+    dump_queue_policy = "block";
     it_size = sizeof(char);
     blocking_on_standby = false;
     use_automatic_resampler = false;
@@ -54,14 +54,29 @@ public:
     bool use_CFAR_algorithm_flag;
     bool dump;
     bool blocking;
-    bool blocking_on_standby;  // enable it only for unit testing to avoid sample consume on idle status
+    bool blocking_on_standby;   // enable it only for unit testing to avoid sample consume on idle status
     bool make_2_steps;
+    bool sequential_detection;         // decide after every dwell, and give up early on weak statistics
+    float sequential_dismissal_ratio;  // lower threshold of the sequential test at the first dwell, as a fraction of the threshold
+    std::string peak_interpolation;  // "none", "parabolic" or "sinc" refinement of the grid peak
+    bool peak_interpolation_check;   // confirm the refined peak with a direct correlation
+    bool fft_doppler_shift;     // remove the Doppler by circularly shifting a single input FFT
+    bool share_input_spectra;   // reuse the input spectra among all the channels of the same signal
+    bool fixed_point_wipeoff;   // keep cshort inputs in 16-bit integers up to the FFT
+    bool combine_data_pilot;    // add the data and pilot correlations noncoherently
+    bool warm_up_code_spectra;  // fill the code spectra cache for all the PRNs at startup
+    uint32_t doppler_workers;   // threads searching the Doppler bins of a dwell
+    bool use_search_windows;    // narrow the search around the predicted Doppler, if available
+    bool use_sample_ring;       // take the snapshots from a shared sample ring instead of the stream
+    bool fdma_channelized;      // the input is already the GLONASS sub-band of the satellite
     bool use_automatic_resampler;
     float resampler_ratio;
     int64_t resampled_fs;
     uint32_t resampler_latency_samples;
     std::string dump_filename;
     uint32_t dump_channel;
+    uint32_t dump_queue_size;       // dump files waiting to be written in the background
+    std::string dump_queue_policy;  // "block" or "drop" new dump files when the queue is full
     size_t it_size;
 
     Acq_Conf();
@@ -0,0 +1,146 @@
+/*!
+ * \file acq_decimator.cc
+ * \brief Polyphase low-pass decimator that brings the input of the
+ * acquisition blocks down to a rate set by the code chip rate
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_decimator.h"
+#include <volk/volk.h>
+#include <cmath>
+#include <stdexcept>
+
+
+Acq_Decimator::Acq_Decimator(uint32_t decimation, uint32_t taps_per_phase)
+{
+    if (decimation == 0 or taps_per_phase == 0 or taps_per_phase % 2 != 0)
+        {
+            throw std::invalid_argument("Acq_Decimator: the decimation must be positive and the taps per phase a positive even number");
+        }
+    d_decimation = decimation;
+    d_taps_per_phase = taps_per_phase;
+
+    // Windowed sinc prototype, symmetric around tap L / 2 so that its delay
+    // is a whole number of output samples. Tap 0 is left at zero.
+    const uint32_t length = d_decimation * d_taps_per_phase;
+    const double center = static_cast<double>(length / 2);
+    const double cutoff = 0.45 / static_cast<double>(d_decimation);  // cycles per sample
+    std::vector<double> prototype(length, 0.0);
+    double gain = 0.0;
+    for (uint32_t j = 1; j < length; j++)
+        {
+            double t = static_cast<double>(j) - center;
+            double sinc = (t == 0.0) ? 1.0 : std::sin(M_PI * 2.0 * cutoff * t) / (M_PI * 2.0 * cutoff * t);
+            double window = (length > 2) ? 0.54 - 0.46 * std::cos(2.0 * M_PI * static_cast<double>(j - 1) / static_cast<double>(length - 2)) : 1.0;
+            prototype[j] = sinc * window;
+            gain += prototype[j];
+        }
+    d_taps.resize(length);
+    for (uint32_t j = 0; j < length; j++)
+        {
+            d_taps[length - 1 - j] = static_cast<float>(prototype[j] / gain);
+        }
+    reset();
+}
+
+
+uint32_t Acq_Decimator::choose_decimation(int64_t fs, double chip_rate_hz, double samples_per_chip)
+{
+    if (fs <= 0 or chip_rate_hz <= 0.0 or samples_per_chip <= 0.0)
+        {
+            return 1U;
+        }
+    auto max_decimation = static_cast<int64_t>(std::floor(static_cast<double>(fs) / (chip_rate_hz * samples_per_chip)));
+    uint32_t fallback = 1U;
+    for (int64_t decimation = max_decimation; decimation > 1; decimation--)
+        {
+            if (fs % decimation != 0)
+                {
+                    continue;
+                }
+            if (fallback == 1U)
+                {
+                    fallback = static_cast<uint32_t>(decimation);
+                }
+            int64_t rate = fs / decimation;
+            if (rate % 1000 == 0 and is_smooth(static_cast<uint64_t>(rate / 1000)))
+                {
+                    return static_cast<uint32_t>(decimation);
+                }
+        }
+    return fallback;
+}
+
+
+bool Acq_Decimator::is_smooth(uint64_t n)
+{
+    if (n == 0)
+        {
+            return false;
+        }
+    for (uint64_t factor : {2ULL, 3ULL, 5ULL})
+        {
+            while (n % factor == 0)
+                {
+                    n /= factor;
+                }
+        }
+    return n == 1;
+}
+
+
+void Acq_Decimator::reset()
+{
+    d_buffer.assign(d_taps.size() - 1, std::complex<float>(0.0, 0.0));
+    d_sample_counter = 0ULL;
+    d_pending_skip = d_taps_per_phase / 2;  // the delay of the prototype, in output samples
+}
+
+
+uint32_t Acq_Decimator::filter(const std::complex<float>* in, uint32_t n_in, std::complex<float>* out)
+{
+    const uint32_t length = d_taps.size();
+    d_buffer.insert(d_buffer.end(), in, in + n_in);
+
+    uint32_t produced = 0;
+    uint32_t first = (d_decimation - static_cast<uint32_t>(d_sample_counter % d_decimation)) % d_decimation;
+    for (uint32_t i = first; i < n_in; i += d_decimation)
+        {
+            if (d_pending_skip > 0)
+                {
+                    d_pending_skip--;
+                    continue;
+                }
+            // The window ending at this sample starts at index i of the buffer
+            volk_32fc_32f_dot_prod_32fc(out + produced, d_buffer.data() + i, d_taps.data(), length);
+            produced++;
+        }
+
+    // Keep the last L - 1 samples as the history of the next call
+    d_buffer.erase(d_buffer.begin(), d_buffer.begin() + (d_buffer.size() - (length - 1)));
+    d_sample_counter += n_in;
+    return produced;
+}
@@ -0,0 +1,107 @@
+/*!
+ * \file acq_decimator.h
+ * \brief Polyphase low-pass decimator that brings the input of the
+ * acquisition blocks down to a rate set by the code chip rate
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_DECIMATOR_H_
+#define GNSS_SDR_ACQ_DECIMATOR_H_
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+
+/*!
+ * \brief This class implements a polyphase low-pass decimator for the
+ * acquisition input.
+ *
+ * Only the retained outputs are computed, each one as a single SIMD dot
+ * product of the D phases of the prototype filter with the last D x
+ * taps_per_phase input samples. The prototype is symmetric and its delay is
+ * compensated, so output sample n corresponds to input sample n * D, and
+ * the acquisition results can be stamped back to the input clock by just
+ * multiplying by D.
+ */
+class Acq_Decimator
+{
+public:
+    /*!
+     * \brief Builds the decimator. Throws std::invalid_argument if
+     * \p decimation is zero or \p taps_per_phase is not a positive even
+     * number.
+     */
+    Acq_Decimator(uint32_t decimation, uint32_t taps_per_phase = 16);
+
+    /*!
+     * \brief Largest decimation of \p fs that keeps at least
+     * \p samples_per_chip samples per chip of a code at \p chip_rate_hz.
+     * Among the decimations that divide \p fs, those with a smooth
+     * (2^a 3^b 5^c) number of samples per millisecond are preferred, so
+     * that the FFT of any dwell of a smooth number of milliseconds is fast.
+     * Returns 1 if \p fs is already too low to be decimated.
+     */
+    static uint32_t choose_decimation(int64_t fs, double chip_rate_hz, double samples_per_chip = 2.0);
+
+    /*!
+     * \brief True if \p n has no prime factor other than 2, 3 and 5
+     */
+    static bool is_smooth(uint64_t n);
+
+    /*!
+     * \brief Processes \p n_in input samples and writes the decimated ones
+     * to \p out. Returns the number of samples written, at most
+     * ceil(n_in / decimation()). The state is kept between calls, so the
+     * input can be fed in chunks of any size.
+     */
+    uint32_t filter(const std::complex<float>* in, uint32_t n_in, std::complex<float>* out);
+
+    /*!
+     * \brief Clears the filter state, as if no sample had been processed
+     */
+    void reset();
+
+    inline uint32_t decimation() const
+    {
+        return d_decimation;
+    }
+
+    inline const std::vector<float>& taps() const
+    {
+        return d_taps;
+    }
+
+private:
+    uint32_t d_decimation;
+    uint32_t d_taps_per_phase;
+    std::vector<float> d_taps;                  // prototype low-pass filter, time-reversed
+    std::vector<std::complex<float>> d_buffer;  // history plus the current chunk
+    uint64_t d_sample_counter;                  // input samples processed since the last reset
+    uint32_t d_pending_skip;                    // outputs still to drop to compensate the filter delay
+};
+
+#endif
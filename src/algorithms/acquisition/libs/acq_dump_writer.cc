@@ -0,0 +1,158 @@
+/*!
+ * \file acq_dump_writer.cc
+ * \brief Background writer of acquisition dump files, fed through a
+ * bounded queue.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_dump_writer.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <exception>
+
+
+using google::LogMessage;
+
+
+Acq_Dump_Writer::Acq_Dump_Writer(uint32_t queue_size, Full_Queue_Policy policy)
+{
+    d_queue_size = std::max(queue_size, 1U);
+    d_policy = policy;
+    d_stop = false;
+    d_busy = false;
+    d_written = 0ULL;
+    d_dropped = 0ULL;
+    d_thread = std::thread(&Acq_Dump_Writer::writer_loop, this);
+}
+
+
+Acq_Dump_Writer::~Acq_Dump_Writer()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_stop = true;
+    lock.unlock();
+    d_not_empty.notify_all();
+    if (d_thread.joinable())
+        {
+            d_thread.join();
+        }
+    if (d_dropped > 0)
+        {
+            LOG(WARNING) << "Acquisition dump writer: " << d_written << " files written, "
+                         << d_dropped << " dropped because the queue was full";
+        }
+}
+
+
+bool Acq_Dump_Writer::push(const std::function<void()>& task)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (d_queue.size() >= d_queue_size)
+        {
+            if (d_policy == Full_Queue_Policy::Drop)
+                {
+                    if (d_dropped++ == 0)
+                        {
+                            LOG(WARNING) << "Acquisition dump queue full, dropping dump files";
+                        }
+                    return false;
+                }
+            d_not_full.wait(lock, [this] { return d_queue.size() < d_queue_size; });
+        }
+    d_queue.push_back(task);
+    lock.unlock();
+    d_not_empty.notify_one();
+    return true;
+}
+
+
+void Acq_Dump_Writer::flush()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_not_full.wait(lock, [this] { return d_queue.empty() and !d_busy; });
+}
+
+
+uint64_t Acq_Dump_Writer::written() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_written;
+}
+
+
+uint64_t Acq_Dump_Writer::dropped() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_dropped;
+}
+
+
+Acq_Dump_Writer::Full_Queue_Policy Acq_Dump_Writer::policy_from_string(const std::string& policy)
+{
+    if (policy == "drop")
+        {
+            return Full_Queue_Policy::Drop;
+        }
+    if (policy != "block")
+        {
+            LOG(WARNING) << "Unknown acquisition dump queue policy " << policy << ", using block";
+        }
+    return Full_Queue_Policy::Block;
+}
+
+
+void Acq_Dump_Writer::writer_loop()
+{
+    while (true)
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_not_empty.wait(lock, [this] { return d_stop or !d_queue.empty(); });
+            if (d_queue.empty())
+                {
+                    return;  // d_stop is set and everything has been written
+                }
+            std::function<void()> task = std::move(d_queue.front());
+            d_queue.pop_front();
+            d_busy = true;
+            lock.unlock();
+            d_not_full.notify_all();
+
+            try
+                {
+                    task();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Exception writing an acquisition dump file: " << e.what();
+                }
+
+            lock.lock();
+            d_busy = false;
+            d_written++;
+            lock.unlock();
+            d_not_full.notify_all();
+        }
+}
@@ -0,0 +1,110 @@
+/*!
+ * \file acq_dump_writer.h
+ * \brief Background writer of acquisition dump files, fed through a
+ * bounded queue.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_DUMP_WRITER_H_
+#define GNSS_SDR_ACQ_DUMP_WRITER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+
+/*!
+ * \brief This class implements a background writer for the acquisition
+ * dump files.
+ *
+ * The acquisition block packs the results of a search into a task (which
+ * owns a copy of everything it writes) and pushes it here, so the file
+ * creation and the compression run in a separate thread instead of delaying
+ * the next search. The queue holds at most queue_size tasks. When it is
+ * full, the policy decides what happens to a new task:
+ *
+ *  - Block: push() waits until the writer frees a slot. No dump is lost,
+ *    but the acquisition is slowed down to the speed of the disk.
+ *  - Drop: push() discards the new task and returns immediately, so the
+ *    acquisition latency does not depend on the disk. Dropped tasks are
+ *    counted and reported.
+ *
+ * The destructor writes all the queued tasks before returning.
+ */
+class Acq_Dump_Writer
+{
+public:
+    enum class Full_Queue_Policy
+    {
+        Block,
+        Drop
+    };
+
+    Acq_Dump_Writer(uint32_t queue_size, Full_Queue_Policy policy);
+    ~Acq_Dump_Writer();
+
+    /*!
+     * \brief Queues a write task. Returns false if it was dropped.
+     */
+    bool push(const std::function<void()>& task);
+
+    /*!
+     * \brief Waits until all the queued tasks have been written.
+     */
+    void flush();
+
+    uint64_t written() const;
+    uint64_t dropped() const;
+
+    /*!
+     * \brief Parses "block" or "drop". Unknown values select Block.
+     */
+    static Full_Queue_Policy policy_from_string(const std::string& policy);
+
+    Acq_Dump_Writer(const Acq_Dump_Writer&) = delete;
+    Acq_Dump_Writer& operator=(const Acq_Dump_Writer&) = delete;
+
+private:
+    void writer_loop();
+
+    std::deque<std::function<void()>> d_queue;
+    uint32_t d_queue_size;
+    Full_Queue_Policy d_policy;
+    bool d_stop;
+    bool d_busy;
+    uint64_t d_written;
+    uint64_t d_dropped;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_not_empty;
+    std::condition_variable d_not_full;  // also signalled when the writer becomes idle
+    std::thread d_thread;
+};
+
+#endif
@@ -0,0 +1,151 @@
+/*!
+ * \file acq_peak_interpolator.cc
+ * \brief Sub-bin interpolation of the acquisition correlation peak
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+
+#include "acq_peak_interpolator.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+double normalized_sinc(double x)
+{
+    if (std::abs(x) < 1e-12)
+        {
+            return 1.0;
+        }
+    return std::sin(M_PI * x) / (M_PI * x);
+}
+
+
+bool is_peak(double left, double center, double right)
+{
+    return center > 0.0 and left <= center and right <= center;
+}
+}  // namespace
+
+
+Acq_Peak_Interpolator::Method Acq_Peak_Interpolator::method_from_string(const std::string& method)
+{
+    if (method == "parabolic")
+        {
+            return Method::Parabolic;
+        }
+    if (method == "sinc")
+        {
+            return Method::Sinc;
+        }
+    if (method != "none")
+        {
+            LOG(WARNING) << "Unknown acquisition peak interpolation " << method << ", using none";
+        }
+    return Method::None;
+}
+
+
+double Acq_Peak_Interpolator::parabolic_offset(double left, double center, double right)
+{
+    if (!is_peak(left, center, right))
+        {
+            return 0.0;
+        }
+    double curvature = left - 2.0 * center + right;
+    if (curvature >= 0.0)
+        {
+            return 0.0;  // flat
+        }
+    return std::max(-0.5, std::min(0.5, 0.5 * (left - right) / curvature));
+}
+
+
+double Acq_Peak_Interpolator::sinc_offset(double left, double center, double right, double bin_width)
+{
+    if (!is_peak(left, center, right))
+        {
+            return 0.0;
+        }
+    if (bin_width <= 0.0 or bin_width >= 1.0)
+        {
+            return parabolic_offset(left, center, right);
+        }
+
+    // The peak lies on the side of the larger neighbour. The ratio between
+    // that neighbour and the center grows with the offset, so it is inverted
+    // by bisection.
+    double sign = (right >= left) ? 1.0 : -1.0;
+    double ratio = std::max(left, right) / center;
+    auto model_ratio = [bin_width](double offset) {
+        return std::abs(normalized_sinc((1.0 - offset) * bin_width) / normalized_sinc(offset * bin_width));
+    };
+    if (ratio <= model_ratio(0.0))
+        {
+            return 0.0;
+        }
+    if (ratio >= model_ratio(0.5))
+        {
+            return 0.5 * sign;
+        }
+    double low = 0.0;
+    double high = 0.5;
+    for (int i = 0; i < 40; i++)
+        {
+            double mid = 0.5 * (low + high);
+            if (model_ratio(mid) < ratio)
+                {
+                    low = mid;
+                }
+            else
+                {
+                    high = mid;
+                }
+        }
+    return 0.5 * (low + high) * sign;
+}
+
+
+double Acq_Peak_Interpolator::triangle_offset(double left, double center, double right, double half_width)
+{
+    if (!is_peak(left, center, right))
+        {
+            return 0.0;
+        }
+    if (half_width < 1.0)
+        {
+            return parabolic_offset(left, center, right);
+        }
+
+    // With the peak at offset d towards the larger neighbour, the triangle
+    // gives neighbour / center = (W - 1 + d) / (W - d)
+    double sign = (right >= left) ? 1.0 : -1.0;
+    double ratio = std::max(left, right) / center;
+    double offset = (ratio * half_width - half_width + 1.0) / (1.0 + ratio);
+    return std::max(0.0, std::min(0.5, offset)) * sign;
+}
@@ -0,0 +1,81 @@
+/*!
+ * \file acq_peak_interpolator.h
+ * \brief Sub-bin interpolation of the acquisition correlation peak
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_PEAK_INTERPOLATOR_H_
+#define GNSS_SDR_ACQ_PEAK_INTERPOLATOR_H_
+
+#include <string>
+
+
+/*!
+ * \brief Estimates where the true correlation peak lies between the bins of
+ * the acquisition grid, from the value of the highest bin and of its two
+ * neighbours along the Doppler or the code delay axis.
+ *
+ * All the offsets are given in bins, in the [-0.5, 0.5] range, and are
+ * positive towards the \p right neighbour. A neighbour larger than the
+ * center, or a degenerate shape, gives a zero offset.
+ */
+class Acq_Peak_Interpolator
+{
+public:
+    enum class Method
+    {
+        None,
+        Parabolic,  // parabola through the three bins, for both axes
+        Sinc        // sinc shape in Doppler and triangular code correlation in delay
+    };
+
+    /*!
+     * \brief Parses "none", "parabolic" or "sinc". Unknown names give None.
+     */
+    static Method method_from_string(const std::string& method);
+
+    /*!
+     * \brief Vertex of the parabola through the three values
+     */
+    static double parabolic_offset(double left, double center, double right);
+
+    /*!
+     * \brief Offset of the main lobe of |sinc(f T)| through the three
+     * amplitudes, for bins \p bin_width / T apart (the Doppler step times
+     * the coherent integration time). Falls back to the parabolic fit if
+     * the bins are too wide for the neighbours to lie in the main lobe.
+     */
+    static double sinc_offset(double left, double center, double right, double bin_width);
+
+    /*!
+     * \brief Offset of a triangle of half-width \p half_width bins (the
+     * samples per chip of the code autocorrelation) through the three
+     * amplitudes. Falls back to the parabolic fit below one bin per chip.
+     */
+    static double triangle_offset(double left, double center, double right, double half_width);
+};
+
+#endif
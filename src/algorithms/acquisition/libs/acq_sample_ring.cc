@@ -0,0 +1,207 @@
+/*!
+ * \file acq_sample_ring.cc
+ * \brief Sample history shared by the acquisition blocks of one input
+ * stream, written once by a sink block and read on demand.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_sample_ring.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <cstring>
+
+
+using google::LogMessage;
+
+
+Acq_Sample_Ring::Acq_Sample_Ring(size_t item_size, uint64_t capacity)
+{
+    d_item_size = item_size;
+    d_capacity = std::max(capacity, static_cast<uint64_t>(1));
+    d_buffer.resize(d_capacity * d_item_size);
+    d_sample_counter = 0ULL;
+    d_skipped = 0ULL;
+    d_closed = false;
+}
+
+
+void Acq_Sample_Ring::write(const void* items, uint64_t num_items)
+{
+    const auto* in = static_cast<const char*>(items);
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (num_items > d_capacity)
+        {
+            // Only the last d_capacity items would survive
+            in += (num_items - d_capacity) * d_item_size;
+            d_sample_counter += num_items - d_capacity;
+            num_items = d_capacity;
+        }
+    uint64_t pos = d_sample_counter % d_capacity;
+    uint64_t first = std::min(num_items, d_capacity - pos);
+    memcpy(&d_buffer[pos * d_item_size], in, first * d_item_size);
+    if (first < num_items)
+        {
+            memcpy(&d_buffer[0], in + first * d_item_size, (num_items - first) * d_item_size);
+        }
+    d_sample_counter += num_items;
+    lock.unlock();
+    d_cond.notify_all();
+}
+
+
+void Acq_Sample_Ring::copy_out(uint64_t start, uint64_t num_items, char* out) const
+{
+    uint64_t pos = start % d_capacity;
+    uint64_t first = std::min(num_items, d_capacity - pos);
+    memcpy(out, &d_buffer[pos * d_item_size], first * d_item_size);
+    if (first < num_items)
+        {
+            memcpy(out + first * d_item_size, &d_buffer[0], (num_items - first) * d_item_size);
+        }
+}
+
+
+Acq_Sample_Ring::Read_Status Acq_Sample_Ring::read(uint64_t& start, uint64_t num_items, void* out, std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (num_items > d_capacity)
+        {
+            LOG(ERROR) << "Requested " << num_items << " samples from a sample ring of " << d_capacity;
+            return Read_Status::Closed;
+        }
+    if (!d_cond.wait_for(lock, timeout, [this, &start, num_items] { return d_closed or d_sample_counter >= start + num_items; }))
+        {
+            return Read_Status::Timeout;
+        }
+    if (d_closed)
+        {
+            return Read_Status::Closed;
+        }
+    uint64_t oldest = (d_sample_counter > d_capacity ? d_sample_counter - d_capacity : 0ULL);
+    if (start < oldest)
+        {
+            d_skipped += oldest - start;
+            start = oldest;
+        }
+    copy_out(start, num_items, static_cast<char*>(out));
+    return Read_Status::Ok;
+}
+
+
+void Acq_Sample_Ring::reserve(uint64_t capacity)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (capacity <= d_capacity)
+        {
+            return;
+        }
+    uint64_t stored = std::min(d_sample_counter, d_capacity);
+    std::vector<char> buffer(capacity * d_item_size);
+    uint64_t start = d_sample_counter - stored;
+    std::vector<char> samples(stored * d_item_size);
+    if (stored > 0)
+        {
+            copy_out(start, stored, samples.data());
+        }
+    d_buffer.swap(buffer);
+    d_capacity = capacity;
+    for (uint64_t i = 0; i < stored; i++)
+        {
+            memcpy(&d_buffer[((start + i) % d_capacity) * d_item_size], &samples[i * d_item_size], d_item_size);
+        }
+}
+
+
+void Acq_Sample_Ring::close()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_closed = true;
+    lock.unlock();
+    d_cond.notify_all();
+}
+
+
+void Acq_Sample_Ring::reopen()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_closed = false;
+}
+
+
+uint64_t Acq_Sample_Ring::sample_counter() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_sample_counter;
+}
+
+
+uint64_t Acq_Sample_Ring::skipped() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_skipped;
+}
+
+
+uint64_t Acq_Sample_Ring::capacity() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_capacity;
+}
+
+
+Acq_Sample_Ring_Registry& Acq_Sample_Ring_Registry::instance()
+{
+    static Acq_Sample_Ring_Registry registry;
+    return registry;
+}
+
+
+std::shared_ptr<Acq_Sample_Ring> Acq_Sample_Ring_Registry::get(const std::string& key, size_t item_size, uint64_t min_capacity)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    auto it = d_rings.find(key);
+    if (it == d_rings.end())
+        {
+            std::shared_ptr<Acq_Sample_Ring> ring = std::make_shared<Acq_Sample_Ring>(item_size, min_capacity);
+            d_rings.insert(std::make_pair(key, ring));
+            return ring;
+        }
+    if (it->second->item_size() != item_size)
+        {
+            LOG(ERROR) << "Sample ring " << key << " holds items of " << it->second->item_size()
+                       << " bytes, requested " << item_size;
+            return nullptr;
+        }
+    it->second->reserve(min_capacity);
+    return it->second;
+}
+
+
+void Acq_Sample_Ring_Registry::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_rings.clear();
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file acq_sample_ring.h
+ * \brief Sample history shared by the acquisition blocks of one input
+ * stream, written once by a sink block and read on demand.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SAMPLE_RING_H_
+#define GNSS_SDR_ACQ_SAMPLE_RING_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/*!
+ * \brief This class implements a circular buffer holding the most recent
+ * samples of a stream, each one identified by its sample stamp (the number
+ * of samples written before it).
+ *
+ * A single writer appends the samples as they arrive. Readers copy any
+ * range of samples still held in the buffer, waiting for the samples that
+ * have not arrived yet.
+ */
+class Acq_Sample_Ring
+{
+public:
+    enum class Read_Status
+    {
+        Ok,
+        Timeout,
+        Closed
+    };
+
+    Acq_Sample_Ring(size_t item_size, uint64_t capacity);
+
+    /*!
+     * \brief Appends \p num_items items to the ring
+     */
+    void write(const void* items, uint64_t num_items);
+
+    /*!
+     * \brief Copies \p num_items items, starting at the sample stamp \p start,
+     * into \p out, waiting up to \p timeout for them to arrive. If the
+     * first samples have already been overwritten, \p start is moved
+     * forward to the oldest sample still available.
+     */
+    Read_Status read(uint64_t& start, uint64_t num_items, void* out, std::chrono::milliseconds timeout);
+
+    /*!
+     * \brief Grows the ring to hold at least \p capacity items, keeping the
+     * stored samples
+     */
+    void reserve(uint64_t capacity);
+
+    /*!
+     * \brief Wakes up all the readers and makes any further read fail
+     */
+    void close();
+
+    /*!
+     * \brief Allows reading again after close(), e.g. when the flowgraph is restarted
+     */
+    void reopen();
+
+    uint64_t sample_counter() const;  //!< Stamp of the next sample to be written
+    uint64_t skipped() const;         //!< Samples requested by readers after they were overwritten
+
+    inline size_t item_size() const
+    {
+        return d_item_size;
+    }
+
+    uint64_t capacity() const;
+
+    Acq_Sample_Ring(const Acq_Sample_Ring&) = delete;
+    Acq_Sample_Ring& operator=(const Acq_Sample_Ring&) = delete;
+
+private:
+    void copy_out(uint64_t start, uint64_t num_items, char* out) const;
+
+    std::vector<char> d_buffer;
+    size_t d_item_size;
+    uint64_t d_capacity;
+    uint64_t d_sample_counter;
+    uint64_t d_skipped;
+    bool d_closed;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cond;
+};
+
+
+/*!
+ * \brief Process-wide registry of sample rings, indexed by the name of the
+ * stream they hold. The flowgraph creates one sink per ring, and each
+ * acquisition block reading from it asks for the capacity it needs.
+ */
+class Acq_Sample_Ring_Registry
+{
+public:
+    static Acq_Sample_Ring_Registry& instance();
+
+    /*!
+     * \brief Returns the ring \p key, created or grown to hold at least
+     * \p min_capacity items. Returns nullptr if the ring exists with
+     * another item size.
+     */
+    std::shared_ptr<Acq_Sample_Ring> get(const std::string& key, size_t item_size, uint64_t min_capacity);
+
+    void clear();
+
+    Acq_Sample_Ring_Registry(const Acq_Sample_Ring_Registry&) = delete;
+    Acq_Sample_Ring_Registry& operator=(const Acq_Sample_Ring_Registry&) = delete;
+
+private:
+    Acq_Sample_Ring_Registry() = default;
+
+    std::map<std::string, std::shared_ptr<Acq_Sample_Ring>> d_rings;
+    std::mutex d_mutex;
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*!
+ * \file acq_search_window.cc
+ * \brief Predicted Doppler and code phase search windows used to narrow
+ * the acquisition grid of each satellite.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_search_window.h"
+#include "MATH_CONSTANTS.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+
+Acq_Search_Window::Acq_Search_Window()
+{
+    range_rate_m_s = 0.0;
+    range_rate_uncertainty_m_s = 0.0;
+    code_phase_valid = false;
+    code_phase_s = 0.0;
+    code_phase_window_s = 0.0;
+    reference_sample_stamp = 0ULL;
+    reference_time_s = now_s();
+    uncertainty_growth_m_s2 = 0.0;
+    max_age_s = 0.0;
+}
+
+
+double Acq_Search_Window::now_s()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+double Acq_Search_Window::age_s() const
+{
+    return std::max(now_s() - reference_time_s, 0.0);
+}
+
+
+bool Acq_Search_Window::expired(double age_s) const
+{
+    return max_age_s > 0.0 and age_s > max_age_s;
+}
+
+
+double Acq_Search_Window::range_rate_uncertainty_m_s_at(double age_s) const
+{
+    return range_rate_uncertainty_m_s + uncertainty_growth_m_s2 * age_s;
+}
+
+
+double Acq_Search_Window::doppler_hz(double carrier_hz) const
+{
+    // An approaching satellite (negative range rate) has a positive Doppler
+    return -range_rate_m_s * carrier_hz / SPEED_OF_LIGHT;
+}
+
+
+double Acq_Search_Window::doppler_uncertainty_hz(double carrier_hz, double age_s) const
+{
+    return range_rate_uncertainty_m_s_at(age_s) * carrier_hz / SPEED_OF_LIGHT;
+}
+
+
+double Acq_Search_Window::code_phase_s_at(double elapsed_s) const
+{
+    // The code delay follows the range
+    return code_phase_s + range_rate_m_s * elapsed_s / SPEED_OF_LIGHT;
+}
+
+
+double Acq_Search_Window::code_phase_window_s_at(double elapsed_s) const
+{
+    // and drifts from the prediction by the accumulated range rate error
+    elapsed_s = std::abs(elapsed_s);
+    return code_phase_window_s + range_rate_uncertainty_m_s_at(elapsed_s) * elapsed_s / SPEED_OF_LIGHT;
+}
+
+
+Acq_Search_Window_Store& Acq_Search_Window_Store::instance()
+{
+    static Acq_Search_Window_Store store;
+    return store;
+}
+
+
+void Acq_Search_Window_Store::set(char system, uint32_t prn, const Acq_Search_Window& window)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_windows[std::make_pair(system, prn)] = window;
+}
+
+
+bool Acq_Search_Window_Store::find(char system, uint32_t prn, Acq_Search_Window& window) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    auto it = d_windows.find(std::make_pair(system, prn));
+    if (it == d_windows.end())
+        {
+            return false;
+        }
+    window = it->second;
+    return true;
+}
+
+
+void Acq_Search_Window_Store::erase(char system, uint32_t prn)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_windows.erase(std::make_pair(system, prn));
+}
+
+
+void Acq_Search_Window_Store::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_windows.clear();
+}
+
+
+size_t Acq_Search_Window_Store::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_windows.size();
+}
@@ -0,0 +1,144 @@
+/*!
+ * \file acq_search_window.h
+ * \brief Predicted Doppler and code phase search windows used to narrow
+ * the acquisition grid of each satellite.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SEARCH_WINDOW_H_
+#define GNSS_SDR_ACQ_SEARCH_WINDOW_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+
+/*!
+ * \brief Search window of one satellite. The Doppler is given as a range
+ * rate, so the same window applies to all the signals of the satellite:
+ * each acquisition block scales it by its own carrier frequency.
+ *
+ * The range rate is predicted for reference_time_s. The window is widened
+ * by uncertainty_growth_m_s2 for every second elapsed since then, and it is
+ * no longer used past max_age_s.
+ */
+class Acq_Search_Window
+{
+public:
+    double range_rate_m_s;              // predicted range rate, receiver clock drift included [m/s]
+    double range_rate_uncertainty_m_s;  // half width of the range rate window [m/s]
+    bool code_phase_valid;              // the code phase window is only known with fine time assistance
+    double code_phase_s;                // predicted code delay at reference_sample_stamp, modulo the code period [s]
+    double code_phase_window_s;         // half width of the code delay window [s]
+    uint64_t reference_sample_stamp;    // acquisition input sample the code delay refers to
+    double reference_time_s;            // steady clock time the range rate refers to [s]
+    double uncertainty_growth_m_s2;     // widening of the range rate window with its age [m/s^2]
+    double max_age_s;                   // age past which the window is ignored, 0 for no limit [s]
+
+    Acq_Search_Window();
+
+    /*!
+     * \brief Current time of the clock of reference_time_s [s]
+     */
+    static double now_s();
+
+    /*!
+     * \brief Time elapsed since reference_time_s [s]
+     */
+    double age_s() const;
+
+    /*!
+     * \brief True if the window is too old to narrow the search
+     */
+    bool expired(double age_s) const;
+
+    /*!
+     * \brief Half width of the range rate window at the given age [m/s]
+     */
+    double range_rate_uncertainty_m_s_at(double age_s) const;
+
+    /*!
+     * \brief Predicted Doppler of a carrier of frequency \p carrier_hz [Hz]
+     */
+    double doppler_hz(double carrier_hz) const;
+
+    /*!
+     * \brief Doppler uncertainty of a carrier of frequency \p carrier_hz,
+     * \p age_s seconds after reference_time_s [Hz]
+     */
+    double doppler_uncertainty_hz(double carrier_hz, double age_s = 0.0) const;
+
+    /*!
+     * \brief Predicted code delay \p elapsed_s seconds after the
+     * reference sample, not wrapped to the code period [s]
+     */
+    double code_phase_s_at(double elapsed_s) const;
+
+    /*!
+     * \brief Half width of the code delay window \p elapsed_s seconds
+     * after the reference sample [s]
+     */
+    double code_phase_window_s_at(double elapsed_s) const;
+};
+
+
+/*!
+ * \brief This class implements a process-wide store of search windows,
+ * indexed by system ('G', 'E', ...) and PRN.
+ *
+ * The control thread fills it from the stored ephemeris and almanac, the
+ * reference or last computed position and the receiver clock drift, and the
+ * acquisition blocks read it every time they start searching a satellite.
+ */
+class Acq_Search_Window_Store
+{
+public:
+    static Acq_Search_Window_Store& instance();
+
+    void set(char system, uint32_t prn, const Acq_Search_Window& window);
+
+    /*!
+     * \brief Copies the window of the given satellite into \p window.
+     * Returns false if there is none.
+     */
+    bool find(char system, uint32_t prn, Acq_Search_Window& window) const;
+
+    void erase(char system, uint32_t prn);
+    void clear();
+    size_t size() const;
+
+    Acq_Search_Window_Store(const Acq_Search_Window_Store&) = delete;
+    Acq_Search_Window_Store& operator=(const Acq_Search_Window_Store&) = delete;
+
+private:
+    Acq_Search_Window_Store() = default;
+
+    std::map<std::pair<char, uint32_t>, Acq_Search_Window> d_windows;
+    mutable std::mutex d_mutex;
+};
+
+#endif
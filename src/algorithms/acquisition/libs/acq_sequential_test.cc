@@ -0,0 +1,77 @@
+/*!
+ * \file acq_sequential_test.cc
+ * \brief Truncated sequential test on the noncoherently accumulated
+ * acquisition statistic
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_sequential_test.h"
+#include <algorithm>
+
+
+Acq_Sequential_Test::Acq_Sequential_Test()
+{
+    d_dismissal_ratio = 0.0;
+    d_max_dwells = 1U;
+    d_accumulated_statistic = false;
+}
+
+
+Acq_Sequential_Test::Acq_Sequential_Test(float dismissal_ratio, uint32_t max_dwells, bool accumulated_statistic)
+{
+    d_dismissal_ratio = std::min(std::max(dismissal_ratio, 0.0F), 1.0F);
+    d_max_dwells = std::max(max_dwells, 1U);
+    d_accumulated_statistic = accumulated_statistic;
+}
+
+
+float Acq_Sequential_Test::dismissal_threshold(float threshold, uint32_t dwell) const
+{
+    if (d_max_dwells == 1U or dwell >= d_max_dwells)
+        {
+            return threshold;
+        }
+    dwell = std::max(dwell, 1U);
+    float progress = static_cast<float>(dwell - 1U) / static_cast<float>(d_max_dwells - 1U);
+    float ratio = d_dismissal_ratio + (1.0F - d_dismissal_ratio) * progress;
+    float expected_share = d_accumulated_statistic ? static_cast<float>(dwell) / static_cast<float>(d_max_dwells) : 1.0F;
+    return ratio * expected_share * threshold;
+}
+
+
+Acq_Sequential_Test::Decision Acq_Sequential_Test::decide(float statistic, float threshold, uint32_t dwell) const
+{
+    if (statistic > threshold)
+        {
+            return Decision::Positive;
+        }
+    if (dwell >= d_max_dwells or statistic < dismissal_threshold(threshold, dwell))
+        {
+            return Decision::Negative;
+        }
+    return Decision::Continue;
+}
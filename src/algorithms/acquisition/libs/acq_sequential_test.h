@@ -0,0 +1,94 @@
+/*!
+ * \file acq_sequential_test.h
+ * \brief Truncated sequential test on the noncoherently accumulated
+ * acquisition statistic
+ *
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SEQUENTIAL_TEST_H_
+#define GNSS_SDR_ACQ_SEQUENTIAL_TEST_H_
+
+#include <cstdint>
+
+
+/*!
+ * \brief This class implements a truncated sequential test on the
+ * acquisition statistic accumulated over up to max_dwells noncoherent
+ * dwells.
+ *
+ * After every dwell the statistic is compared with two thresholds. Above
+ * the detection threshold the satellite is declared present, as the block
+ * already does. Below the dismissal threshold the search is abandoned
+ * without waiting for the remaining dwells. The dismissal threshold is a
+ * fraction of the detection threshold, the dismissal ratio at the first
+ * dwell rising linearly to 1 at the last one, so the continuation region
+ * narrows as evidence builds up and the last dwell is the usual
+ * single-threshold decision. A statistic that grows with the number of
+ * accumulated dwells is compared with the share of the threshold it should
+ * have reached at that dwell. The false alarm rate is still set by the
+ * detection threshold alone.
+ */
+class Acq_Sequential_Test
+{
+public:
+    enum class Decision
+    {
+        Continue,
+        Positive,
+        Negative
+    };
+
+    Acq_Sequential_Test();
+
+    /*!
+     * \param dismissal_ratio - Dismissal threshold at the first dwell, as a
+     * fraction (0 ... 1) of the detection threshold. The lower, the weaker
+     * the statistics that are given more dwells.
+     * \param max_dwells - Maximum number of dwells.
+     * \param accumulated_statistic - The statistic grows linearly with the
+     * number of accumulated dwells.
+     */
+    Acq_Sequential_Test(float dismissal_ratio, uint32_t max_dwells, bool accumulated_statistic);
+
+    /*!
+     * \brief Decision after \p dwell (1 ... max_dwells) accumulated dwells
+     * with the given \p statistic, for a detection \p threshold
+     */
+    Decision decide(float statistic, float threshold, uint32_t dwell) const;
+
+    /*!
+     * \brief Dismissal threshold in force after \p dwell dwells
+     */
+    float dismissal_threshold(float threshold, uint32_t dwell) const;
+
+private:
+    float d_dismissal_ratio;
+    uint32_t d_max_dwells;
+    bool d_accumulated_statistic;
+};
+
+#endif
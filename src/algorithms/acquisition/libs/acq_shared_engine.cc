@@ -0,0 +1,132 @@
+/*!
+ * \file acq_shared_engine.cc
+ * \brief Process-wide store of Doppler-wiped input spectra, shared by all
+ * the acquisition blocks searching the same signal over the same snapshot.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_shared_engine.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <exception>
+
+
+Acq_Input_Spectra::Acq_Input_Spectra(uint32_t num_spectra, uint32_t fft_size)
+{
+    d_fft_size = fft_size;
+    d_spectra.resize(num_spectra);
+    for (uint32_t i = 0; i < num_spectra; i++)
+        {
+            d_spectra[i] = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(fft_size * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+        }
+}
+
+
+Acq_Input_Spectra::~Acq_Input_Spectra()
+{
+    for (auto* s : d_spectra)
+        {
+            volk_gnsssdr_free(s);
+        }
+}
+
+
+Acq_Shared_Engine& Acq_Shared_Engine::instance()
+{
+    static Acq_Shared_Engine engine;
+    return engine;
+}
+
+
+Acq_Shared_Engine::Acq_Shared_Engine()
+{
+    d_reused = 0ULL;
+    d_computed = 0ULL;
+}
+
+
+Acq_Shared_Engine::Spectra_sptr Acq_Shared_Engine::get_spectra(const std::string& grid_key,
+    uint64_t sample_stamp,
+    uint32_t num_spectra,
+    uint32_t fft_size,
+    const Compute_function& compute)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    std::deque<Acq_Snapshot>& snapshots = d_snapshots[grid_key];
+    for (const auto& snapshot : snapshots)
+        {
+            if (snapshot.sample_stamp == sample_stamp)
+                {
+                    d_reused++;
+                    std::shared_future<Spectra_sptr> spectra = snapshot.spectra;
+                    lock.unlock();
+                    return spectra.get();  // waits if still being computed by another block
+                }
+        }
+
+    // First request for this snapshot: publish a placeholder and compute it out of the lock
+    std::promise<Spectra_sptr> promise;
+    snapshots.push_back(Acq_Snapshot{sample_stamp, promise.get_future().share()});
+    while (snapshots.size() > max_snapshots_per_grid)
+        {
+            snapshots.pop_front();  // blocks still using it keep their own reference
+        }
+    d_computed++;
+    lock.unlock();
+
+    try
+        {
+            std::shared_ptr<Acq_Input_Spectra> spectra = std::make_shared<Acq_Input_Spectra>(num_spectra, fft_size);
+            compute(*spectra);
+            promise.set_value(spectra);
+            return spectra;
+        }
+    catch (...)
+        {
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+}
+
+
+uint64_t Acq_Shared_Engine::reused_count() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_reused;
+}
+
+
+uint64_t Acq_Shared_Engine::computed_count() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_computed;
+}
+
+
+void Acq_Shared_Engine::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_snapshots.clear();
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file acq_shared_engine.h
+ * \brief Process-wide store of Doppler-wiped input spectra, shared by all
+ * the acquisition blocks searching the same signal over the same snapshot.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_SHARED_ENGINE_H_
+#define GNSS_SDR_ACQ_SHARED_ENGINE_H_
+
+#include <complex>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/*!
+ * \brief Set of input spectra of one snapshot, one per Doppler bin (or a
+ * single one if the Doppler is removed in the frequency domain).
+ */
+class Acq_Input_Spectra
+{
+public:
+    Acq_Input_Spectra(uint32_t num_spectra, uint32_t fft_size);
+    ~Acq_Input_Spectra();
+
+    Acq_Input_Spectra(const Acq_Input_Spectra&) = delete;
+    Acq_Input_Spectra& operator=(const Acq_Input_Spectra&) = delete;
+
+    inline std::complex<float>* spectrum(uint32_t index)
+    {
+        return d_spectra[index];
+    }
+
+    inline const std::complex<float>* spectrum(uint32_t index) const
+    {
+        return d_spectra[index];
+    }
+
+    inline uint32_t size() const
+    {
+        return static_cast<uint32_t>(d_spectra.size());
+    }
+
+    inline uint32_t fft_size() const
+    {
+        return d_fft_size;
+    }
+
+private:
+    std::vector<std::complex<float>*> d_spectra;
+    uint32_t d_fft_size;
+};
+
+
+/*!
+ * \brief This class implements a centralized store of input spectra for
+ * the acquisition blocks.
+ *
+ * All the channels searching the same signal see the same input stream, and
+ * their Doppler wipeoff and forward FFTs only depend on the snapshot and on
+ * the Doppler grid, not on the PRN. The first block that processes a given
+ * snapshot computes its spectra; every other block asking for the same
+ * (grid, snapshot) pair reuses them, and only performs the PRN-dependent
+ * code multiplication and inverse FFTs. Concurrent requests for a snapshot
+ * under computation wait for it instead of duplicating the work.
+ */
+class Acq_Shared_Engine
+{
+public:
+    using Spectra_sptr = std::shared_ptr<const Acq_Input_Spectra>;
+    using Compute_function = std::function<void(Acq_Input_Spectra&)>;
+
+    static Acq_Shared_Engine& instance();
+
+    /*!
+     * \brief Returns the spectra of the snapshot identified by \p grid_key
+     * and \p sample_stamp. If they are not available yet, they are computed
+     * by calling \p compute over a new Acq_Input_Spectra object.
+     */
+    Spectra_sptr get_spectra(const std::string& grid_key,
+        uint64_t sample_stamp,
+        uint32_t num_spectra,
+        uint32_t fft_size,
+        const Compute_function& compute);
+
+    /*!
+     * \brief Number of requests served from an already computed snapshot.
+     */
+    uint64_t reused_count() const;
+
+    /*!
+     * \brief Number of snapshots whose spectra had to be computed.
+     */
+    uint64_t computed_count() const;
+
+    /*!
+     * \brief Drops all the stored snapshots.
+     */
+    void clear();
+
+    Acq_Shared_Engine(const Acq_Shared_Engine&) = delete;
+    Acq_Shared_Engine& operator=(const Acq_Shared_Engine&) = delete;
+
+private:
+    Acq_Shared_Engine();
+
+    struct Acq_Snapshot
+    {
+        uint64_t sample_stamp;
+        std::shared_future<Spectra_sptr> spectra;
+    };
+
+    static const uint32_t max_snapshots_per_grid = 2;
+
+    std::map<std::string, std::deque<Acq_Snapshot>> d_snapshots;
+    uint64_t d_reused;
+    uint64_t d_computed;
+    mutable std::mutex d_mutex;
+};
+
+#endif
@@ -0,0 +1,105 @@
+/*!
+ * \file acq_wipeoff_store.cc
+ * \brief Reference-counted store of the Doppler wipeoff tables shared by the
+ * acquisition blocks with identical search grids.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_wipeoff_store.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+
+
+Acq_Doppler_Wipeoffs::Acq_Doppler_Wipeoffs(uint32_t num_bins, uint32_t fft_size)
+{
+    d_fft_size = fft_size;
+    d_rows.resize(num_bins);
+    for (uint32_t i = 0; i < num_bins; i++)
+        {
+            d_rows[i] = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(fft_size * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+        }
+}
+
+
+Acq_Doppler_Wipeoffs::~Acq_Doppler_Wipeoffs()
+{
+    for (auto* r : d_rows)
+        {
+            volk_gnsssdr_free(r);
+        }
+}
+
+
+Acq_Wipeoff_Store& Acq_Wipeoff_Store::instance()
+{
+    static Acq_Wipeoff_Store store;
+    return store;
+}
+
+
+Acq_Wipeoff_Store::Table_sptr Acq_Wipeoff_Store::get(const std::string& grid_key, uint32_t num_bins, uint32_t fft_size, const Fill_function& fill)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    Table_sptr table = d_tables[grid_key].lock();
+    if (table != nullptr)
+        {
+            return table;
+        }
+
+    // Drop the entries of the grids nobody uses anymore
+    for (auto it = d_tables.begin(); it != d_tables.end();)
+        {
+            if (it->second.expired() and it->first != grid_key)
+                {
+                    it = d_tables.erase(it);
+                }
+            else
+                {
+                    ++it;
+                }
+        }
+
+    // Filled under the lock, so that blocks asking for the same grid at the
+    // same time do not allocate one copy each
+    std::shared_ptr<Acq_Doppler_Wipeoffs> new_table = std::make_shared<Acq_Doppler_Wipeoffs>(num_bins, fft_size);
+    fill(*new_table);
+    d_tables[grid_key] = new_table;
+    return new_table;
+}
+
+
+size_t Acq_Wipeoff_Store::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    size_t in_use = 0;
+    for (const auto& entry : d_tables)
+        {
+            if (!entry.second.expired())
+                {
+                    in_use++;
+                }
+        }
+    return in_use;
+}
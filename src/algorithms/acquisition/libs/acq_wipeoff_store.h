@@ -0,0 +1,124 @@
+/*!
+ * \file acq_wipeoff_store.h
+ * \brief Reference-counted store of the Doppler wipeoff tables shared by the
+ * acquisition blocks with identical search grids.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_WIPEOFF_STORE_H_
+#define GNSS_SDR_ACQ_WIPEOFF_STORE_H_
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+/*!
+ * \brief Doppler wipeoff table: one local carrier of fft_size samples per
+ * Doppler bin of the search grid.
+ */
+class Acq_Doppler_Wipeoffs
+{
+public:
+    Acq_Doppler_Wipeoffs(uint32_t num_bins, uint32_t fft_size);
+    ~Acq_Doppler_Wipeoffs();
+
+    Acq_Doppler_Wipeoffs(const Acq_Doppler_Wipeoffs&) = delete;
+    Acq_Doppler_Wipeoffs& operator=(const Acq_Doppler_Wipeoffs&) = delete;
+
+    inline std::complex<float>* row(uint32_t doppler_index)
+    {
+        return d_rows[doppler_index];
+    }
+
+    inline const std::complex<float>* row(uint32_t doppler_index) const
+    {
+        return d_rows[doppler_index];
+    }
+
+    inline uint32_t num_bins() const
+    {
+        return static_cast<uint32_t>(d_rows.size());
+    }
+
+    inline uint32_t fft_size() const
+    {
+        return d_fft_size;
+    }
+
+private:
+    std::vector<std::complex<float>*> d_rows;
+    uint32_t d_fft_size;
+};
+
+
+/*!
+ * \brief This class implements a store of Doppler wipeoff tables shared by
+ * all the acquisition blocks.
+ *
+ * The wipeoff table of a search grid only depends on the sampling rate, the
+ * FFT size, the maximum Doppler, the Doppler step and the grid center, so
+ * all the channels with the same grid use a single read-only copy. The
+ * store only keeps weak references: a table is released as soon as the last
+ * block using it moves to another grid or is destroyed, and a new one is
+ * generated only when a grid parameter changes.
+ */
+class Acq_Wipeoff_Store
+{
+public:
+    using Table_sptr = std::shared_ptr<const Acq_Doppler_Wipeoffs>;
+    using Fill_function = std::function<void(Acq_Doppler_Wipeoffs&)>;
+
+    static Acq_Wipeoff_Store& instance();
+
+    /*!
+     * \brief Returns the table identified by \p grid_key. If no block holds
+     * it, a new table of \p num_bins x \p fft_size samples is filled by
+     * calling \p fill.
+     */
+    Table_sptr get(const std::string& grid_key, uint32_t num_bins, uint32_t fft_size, const Fill_function& fill);
+
+    /*!
+     * \brief Number of tables currently in use.
+     */
+    size_t size() const;
+
+    Acq_Wipeoff_Store(const Acq_Wipeoff_Store&) = delete;
+    Acq_Wipeoff_Store& operator=(const Acq_Wipeoff_Store&) = delete;
+
+private:
+    Acq_Wipeoff_Store() = default;
+
+    std::map<std::string, std::weak_ptr<const Acq_Doppler_Wipeoffs>> d_tables;
+    mutable std::mutex d_mutex;
+};
+
+#endif
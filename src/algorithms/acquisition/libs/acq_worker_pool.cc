@@ -0,0 +1,244 @@
+/*!
+ * \file acq_worker_pool.cc
+ * \brief Bounded pool of worker threads shared by all the non-blocking
+ * acquisition blocks of the receiver.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_worker_pool.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <exception>
+
+
+using google::LogMessage;
+
+uint32_t Acq_Worker_Pool::s_num_threads = 0U;
+uint32_t Acq_Worker_Pool::s_max_queue_depth = 0U;
+
+
+Acq_Worker_Pool_Stats::Acq_Worker_Pool_Stats()
+{
+    jobs_submitted = 0ULL;
+    jobs_rejected = 0ULL;
+    jobs_completed = 0ULL;
+    total_wait_us = 0ULL;
+    total_run_us = 0ULL;
+    max_run_us = 0ULL;
+    max_queue_depth = 0U;
+    num_threads = 0U;
+    queue_depth_limit = 0U;
+}
+
+
+void Acq_Worker_Pool::configure(uint32_t num_threads, uint32_t max_queue_depth)
+{
+    s_num_threads = num_threads;
+    s_max_queue_depth = max_queue_depth;
+}
+
+
+Acq_Worker_Pool& Acq_Worker_Pool::instance()
+{
+    // Thread-safe initialization (C++11 magic statics)
+    static Acq_Worker_Pool pool(s_num_threads, s_max_queue_depth);
+    return pool;
+}
+
+
+Acq_Worker_Pool::Acq_Worker_Pool(uint32_t num_threads, uint32_t max_queue_depth)
+{
+    if (num_threads == 0)
+        {
+            num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+        }
+    if (max_queue_depth == 0)
+        {
+            max_queue_depth = 4 * num_threads;
+        }
+    d_max_queue_depth = max_queue_depth;
+    d_stop = false;
+    d_stats.num_threads = num_threads;
+    d_stats.queue_depth_limit = max_queue_depth;
+    d_threads.reserve(num_threads);
+    for (uint32_t i = 0; i < num_threads; i++)
+        {
+            d_threads.emplace_back(&Acq_Worker_Pool::worker_loop, this);
+        }
+    LOG(INFO) << "Acquisition worker pool started with " << num_threads
+              << " threads and a queue depth of " << max_queue_depth << " jobs";
+}
+
+
+Acq_Worker_Pool::~Acq_Worker_Pool()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_stop = true;
+    lock.unlock();
+    d_cond.notify_all();
+    for (auto& t : d_threads)
+        {
+            if (t.joinable())
+                {
+                    t.join();
+                }
+        }
+    LOG(INFO) << "Acquisition worker pool: " << d_stats.jobs_completed << " jobs executed, "
+              << d_stats.jobs_rejected << " rejected, mean execution time "
+              << (d_stats.jobs_completed > 0 ? d_stats.total_run_us / d_stats.jobs_completed : 0) << " us, maximum "
+              << d_stats.max_run_us << " us, mean queue wait "
+              << (d_stats.jobs_completed > 0 ? d_stats.total_wait_us / d_stats.jobs_completed : 0) << " us";
+}
+
+
+bool Acq_Worker_Pool::submit(const std::function<void()>& job)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (d_stop or d_queue.size() >= d_max_queue_depth)
+        {
+            d_stats.jobs_rejected++;
+            return false;
+        }
+    d_queue.push_back(Acq_Job{job, std::chrono::steady_clock::now()});
+    d_stats.jobs_submitted++;
+    d_stats.max_queue_depth = std::max(d_stats.max_queue_depth, static_cast<uint32_t>(d_queue.size()));
+    lock.unlock();
+    d_cond.notify_one();
+    return true;
+}
+
+
+void Acq_Worker_Pool::run_tasks(uint32_t num_tasks, const std::function<void(uint32_t)>& task)
+{
+    // The state outlives this call in the jobs that start after all the tasks
+    // were claimed. Those jobs find no task left and never touch task.
+    struct Task_Batch
+    {
+        std::atomic<uint32_t> next;
+        uint32_t pending;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto batch = std::make_shared<Task_Batch>();
+    batch->next = 0U;
+    batch->pending = num_tasks;
+    const std::function<void(uint32_t)>* task_ptr = &task;
+    auto run = [batch, task_ptr, num_tasks]() {
+        uint32_t index;
+        while ((index = batch->next.fetch_add(1U)) < num_tasks)
+            {
+                (*task_ptr)(index);
+                std::lock_guard<std::mutex> lock(batch->mutex);
+                if (--batch->pending == 0U)
+                    {
+                        batch->done.notify_all();
+                    }
+            }
+    };
+
+    // The helpers have their own queue: they neither take the place of a
+    // dwell in the bounded job queue nor count in the job statistics
+    uint32_t helpers = std::min(num_tasks, num_threads() + 1U) - 1U;
+    std::unique_lock<std::mutex> pool_lock(d_mutex);
+    if (!d_stop)
+        {
+            for (uint32_t h = 0; h < helpers; h++)
+                {
+                    d_helper_queue.push_back(Acq_Helper_Job{batch.get(), run});
+                }
+        }
+    pool_lock.unlock();
+    d_cond.notify_all();
+    run();
+
+    // Every task is claimed: the helpers not started yet would find nothing to do
+    pool_lock.lock();
+    d_helper_queue.erase(std::remove_if(d_helper_queue.begin(), d_helper_queue.end(),
+                             [&batch](const Acq_Helper_Job& helper) { return helper.batch == batch.get(); }),
+        d_helper_queue.end());
+    pool_lock.unlock();
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->done.wait(lock, [&batch] { return batch->pending == 0U; });
+}
+
+
+Acq_Worker_Pool_Stats Acq_Worker_Pool::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_stats;
+}
+
+
+void Acq_Worker_Pool::worker_loop()
+{
+    while (true)
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_cond.wait(lock, [this] { return d_stop or !d_queue.empty() or !d_helper_queue.empty(); });
+            if (!d_helper_queue.empty())
+                {
+                    // Helpers first, they finish a job already running
+                    std::function<void()> helper = std::move(d_helper_queue.front().job);
+                    d_helper_queue.pop_front();
+                    lock.unlock();
+                    try
+                        {
+                            helper();
+                        }
+                    catch (const std::exception& e)
+                        {
+                            LOG(ERROR) << "Exception in acquisition worker: " << e.what();
+                        }
+                    continue;
+                }
+            if (d_queue.empty())
+                {
+                    return;  // d_stop is set and there is nothing left to do
+                }
+            Acq_Job current = std::move(d_queue.front());
+            d_queue.pop_front();
+            lock.unlock();
+
+            auto start = std::chrono::steady_clock::now();
+            try
+                {
+                    current.job();
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "Exception in acquisition worker: " << e.what();
+                }
+            auto end = std::chrono::steady_clock::now();
+
+            auto wait_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(start - current.queued_time).count());
+            auto run_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+            lock.lock();
+            d_stats.jobs_completed++;
+            d_stats.total_wait_us += wait_us;
+            d_stats.total_run_us += run_us;
+            d_stats.max_run_us = std::max(d_stats.max_run_us, run_us);
+        }
+}
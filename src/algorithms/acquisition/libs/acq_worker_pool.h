@@ -0,0 +1,154 @@
+/*!
+ * \file acq_worker_pool.h
+ * \brief Bounded pool of worker threads shared by all the non-blocking
+ * acquisition blocks of the receiver.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_WORKER_POOL_H_
+#define GNSS_SDR_ACQ_WORKER_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!
+ * \brief Timing and load counters of the acquisition worker pool
+ */
+class Acq_Worker_Pool_Stats
+{
+public:
+    uint64_t jobs_submitted;     //!< Jobs accepted in the queue
+    uint64_t jobs_rejected;      //!< Jobs refused because the queue was full
+    uint64_t jobs_completed;     //!< Jobs already executed
+    uint64_t total_wait_us;      //!< Accumulated time spent by jobs in the queue [us]
+    uint64_t total_run_us;       //!< Accumulated execution time of the jobs [us]
+    uint64_t max_run_us;         //!< Longest job execution time [us]
+    uint32_t max_queue_depth;    //!< Maximum number of queued jobs observed
+    uint32_t num_threads;        //!< Number of worker threads
+    uint32_t queue_depth_limit;  //!< Maximum number of queued jobs allowed
+
+    Acq_Worker_Pool_Stats();
+};
+
+
+/*!
+ * \brief This class implements a process-wide pool of worker threads for
+ * the acquisition blocks.
+ *
+ * Non-blocking acquisition blocks hand their acquisition_core() calls to this
+ * pool instead of spawning a new thread per dwell. The number of threads and
+ * the maximum number of pending jobs are fixed when the pool is first used,
+ * so the acquisition CPU load is bounded regardless of the number of channels.
+ * When the queue is full, submit() returns false: the acquisition blocks
+ * then drop the snapshot and take a new one, without holding their input.
+ */
+class Acq_Worker_Pool
+{
+public:
+    /*!
+     * \brief Sets the number of threads and the queue depth of the pool.
+     * It only has effect if called before the first call to instance().
+     * A value of 0 selects the default (number of hardware threads for
+     * num_threads, four jobs per thread for max_queue_depth).
+     */
+    static void configure(uint32_t num_threads, uint32_t max_queue_depth);
+
+    /*!
+     * \brief Returns the pool shared by all the acquisition blocks,
+     * creating it at the first call.
+     */
+    static Acq_Worker_Pool& instance();
+
+    ~Acq_Worker_Pool();
+
+    /*!
+     * \brief Queues a job for execution. Returns false if the queue is full.
+     */
+    bool submit(const std::function<void()>& job);
+
+    /*!
+     * \brief Runs task(0), ..., task(num_tasks - 1) on the pool and on the
+     * calling thread, and returns when all of them are done. The calling
+     * thread runs any task that no worker has started, so it does not wait
+     * for a free worker and can be called from a job of the pool itself.
+     * The workers are asked for help outside the job queue, so this never
+     * takes the place of a job nor shows in the pool statistics.
+     */
+    void run_tasks(uint32_t num_tasks, const std::function<void(uint32_t)>& task);
+
+    /*!
+     * \brief Returns a snapshot of the pool counters.
+     */
+    Acq_Worker_Pool_Stats get_stats() const;
+
+    inline uint32_t num_threads() const
+    {
+        return static_cast<uint32_t>(d_threads.size());
+    }
+
+    Acq_Worker_Pool(const Acq_Worker_Pool&) = delete;
+    Acq_Worker_Pool& operator=(const Acq_Worker_Pool&) = delete;
+
+private:
+    Acq_Worker_Pool(uint32_t num_threads, uint32_t max_queue_depth);
+
+    void worker_loop();
+
+    struct Acq_Job
+    {
+        std::function<void()> job;
+        std::chrono::steady_clock::time_point queued_time;
+    };
+
+    struct Acq_Helper_Job
+    {
+        const void* batch;  // run_tasks() call the helper works for
+        std::function<void()> job;
+    };
+
+    static uint32_t s_num_threads;
+    static uint32_t s_max_queue_depth;
+
+    std::vector<std::thread> d_threads;
+    std::deque<Acq_Job> d_queue;
+    std::deque<Acq_Helper_Job> d_helper_queue;  // helpers of the run_tasks() calls in progress
+    uint32_t d_max_queue_depth;
+    bool d_stop;
+    Acq_Worker_Pool_Stats d_stats;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_cond;
+};
+
+#endif
@@ -30,6 +30,7 @@
  */
 
 #include "channel.h"
+#include "GLONASS_L1_L2_CA.h"
 #include "configuration_interface.h"
 #include "gnss_sdr_flags.h"
 #include <glog/logging.h>
@@ -175,11 +176,26 @@ void Channel::set_signal(const Gnss_Signal& gnss_signal)
     gnss_synchro_.Signal[2] = 0;                                    // make sure that string length is only two characters
     gnss_synchro_.PRN = gnss_signal_.get_satellite().get_PRN();
     gnss_synchro_.System = gnss_signal_.get_satellite().get_system_short().c_str()[0];
+    if (fdma_selector_ and gnss_synchro_.System == 'R')
+        {
+            fdma_selector_->set_frequency_channel(GLONASS_PRN.at(gnss_synchro_.PRN));
+        }
     acq_->set_local_code();
     nav_->set_satellite(gnss_signal_.get_satellite());
 }
 
 
+void Channel::set_fdma_subband_selector(glonass_fdma_subband_selector_cc_sptr selector)
+{
+    std::lock_guard<std::mutex> lk(mx);
+    fdma_selector_ = std::move(selector);
+    if (fdma_selector_ and gnss_synchro_.System == 'R')
+        {
+            fdma_selector_->set_frequency_channel(GLONASS_PRN.at(gnss_synchro_.PRN));
+        }
+}
+
+
 void Channel::stop_channel()
 {
     std::lock_guard<std::mutex> lk(mx);
@@ -38,6 +38,7 @@
 #include "channel_fsm.h"
 #include "channel_interface.h"
 #include "channel_msg_receiver_cc.h"
+#include "glonass_fdma_subband_selector_cc.h"
 #include "gnss_synchro.h"
 #include <gnuradio/block.h>
 #include <gnuradio/msg_queue.h>
@@ -85,6 +86,8 @@ public:
     inline std::shared_ptr<AcquisitionInterface> acquisition() { return acq_; }
     inline std::shared_ptr<TrackingInterface> tracking() { return trk_; }
     inline std::shared_ptr<TelemetryDecoderInterface> telemetry() { return nav_; }
+    //! Makes set_signal() switch \p selector to the GLONASS sub-band of the new satellite
+    void set_fdma_subband_selector(glonass_fdma_subband_selector_cc_sptr selector);
     void msg_handler_events(pmt::pmt_t msg);
 
 private:
@@ -102,6 +105,7 @@ private:
     bool repeat_;
     std::shared_ptr<ChannelFsm> channel_fsm_;
     gr::msg_queue::sptr queue_;
+    glonass_fdma_subband_selector_cc_sptr fdma_selector_;
     std::mutex mx;
 };
 
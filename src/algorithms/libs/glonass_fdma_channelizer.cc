@@ -0,0 +1,171 @@
+/*!
+ * \file glonass_fdma_channelizer.cc
+ * \brief Polyphase filter bank that splits the GLONASS band into its FDMA
+ * sub-bands
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "glonass_fdma_channelizer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+
+const int32_t Glonass_Fdma_Channelizer::first_channel;
+const int32_t Glonass_Fdma_Channelizer::num_channels;
+const uint32_t Glonass_Fdma_Channelizer::oversampling;
+
+
+Glonass_Fdma_Channelizer::Glonass_Fdma_Channelizer(int64_t fs, double channel_spacing_hz, uint32_t taps_per_branch)
+{
+    if (fs <= 0 or channel_spacing_hz <= 0.0 or taps_per_branch == 0)
+        {
+            throw std::invalid_argument("Glonass_Fdma_Channelizer: invalid sampling rate or channel spacing");
+        }
+    double ratio = static_cast<double>(fs) / channel_spacing_hz;
+    auto branches = static_cast<uint32_t>(std::round(ratio));
+    if (std::abs(ratio - static_cast<double>(branches)) > 1e-6 or branches % oversampling != 0)
+        {
+            throw std::invalid_argument("Glonass_Fdma_Channelizer: the sampling rate (" + std::to_string(fs) +
+                                        " sps) must be an even multiple of the channel spacing (" + std::to_string(channel_spacing_hz) + " Hz)");
+        }
+    if (branches < static_cast<uint32_t>(num_channels))
+        {
+            throw std::invalid_argument("Glonass_Fdma_Channelizer: the sampling rate (" + std::to_string(fs) +
+                                        " sps) is too low to separate the " + std::to_string(num_channels) + " GLONASS frequency channels");
+        }
+
+    d_branches = branches;
+    d_decimation = branches / oversampling;
+    d_taps_per_branch = taps_per_branch;
+
+    // Windowed sinc prototype, symmetric around tap L / 2 so that its delay
+    // is a whole number of output samples. Tap 0 is left at zero.
+    const uint32_t length = d_branches * d_taps_per_branch;
+    const double center = static_cast<double>(length / 2);
+    const double cutoff = 0.9 / static_cast<double>(d_branches);  // cycles per sample
+    std::vector<double> prototype(length, 0.0);
+    double gain = 0.0;
+    for (uint32_t j = 1; j < length; j++)
+        {
+            double t = static_cast<double>(j) - center;
+            double sinc = (t == 0.0) ? 1.0 : std::sin(M_PI * 2.0 * cutoff * t) / (M_PI * 2.0 * cutoff * t);
+            double window = 0.54 - 0.46 * std::cos(2.0 * M_PI * static_cast<double>(j - 1) / static_cast<double>(length - 2));
+            prototype[j] = sinc * window;
+            gain += prototype[j];
+        }
+    d_taps.resize(length);
+    for (uint32_t j = 0; j < length; j++)
+        {
+            d_taps[length - 1 - j] = static_cast<float>(prototype[j] / gain);
+        }
+
+    // Branch combination for the selected channels only: row k holds
+    // exp(j 2 pi k m / M) in reversed branch order, and the commutator
+    // rotation exp(-j 2 pi k q D / M) only depends on q modulo the oversampling
+    d_twiddles.resize(num_channels * d_branches);
+    d_rotations.resize(num_channels * oversampling);
+    for (int32_t c = 0; c < num_channels; c++)
+        {
+            double k = static_cast<double>(c + first_channel);
+            for (uint32_t m = 0; m < d_branches; m++)
+                {
+                    double phase = 2.0 * M_PI * k * static_cast<double>(m) / static_cast<double>(d_branches);
+                    d_twiddles[c * d_branches + d_branches - 1 - m] = std::complex<float>(std::cos(phase), std::sin(phase));
+                }
+            for (uint32_t r = 0; r < oversampling; r++)
+                {
+                    double phase = -2.0 * M_PI * k * static_cast<double>(r) / static_cast<double>(oversampling);
+                    d_rotations[c * oversampling + r] = std::complex<float>(std::cos(phase), std::sin(phase));
+                }
+        }
+    d_branch_outputs.resize(d_branches);
+    reset();
+}
+
+
+int64_t Glonass_Fdma_Channelizer::output_rate(double channel_spacing_hz)
+{
+    return static_cast<int64_t>(std::round(channel_spacing_hz * static_cast<double>(oversampling)));
+}
+
+
+void Glonass_Fdma_Channelizer::reset()
+{
+    d_buffer.assign(d_taps.size() - 1, std::complex<float>(0.0, 0.0));
+    d_sample_counter = 0ULL;
+    d_pending_skip = d_taps_per_branch;  // the delay of the prototype, in output samples
+}
+
+
+uint32_t Glonass_Fdma_Channelizer::filter(const std::complex<float>* in, uint32_t n_in, std::complex<float>* const* out)
+{
+    const uint32_t length = d_taps.size();
+    d_buffer.insert(d_buffer.end(), in, in + n_in);
+
+    uint32_t produced = 0;
+    uint32_t first = (d_decimation - static_cast<uint32_t>(d_sample_counter % d_decimation)) % d_decimation;
+    for (uint32_t i = first; i < n_in; i += d_decimation)
+        {
+            if (d_pending_skip > 0)
+                {
+                    d_pending_skip--;
+                    continue;
+                }
+
+            // The window ending at this sample starts at index i of the buffer
+            const std::complex<float>* window = d_buffer.data() + i;
+            std::fill(d_branch_outputs.begin(), d_branch_outputs.end(), std::complex<float>(0.0, 0.0));
+            for (uint32_t p = 0; p < d_taps_per_branch; p++)
+                {
+                    const float* taps = d_taps.data() + p * d_branches;
+                    const std::complex<float>* samples = window + p * d_branches;
+                    for (uint32_t r = 0; r < d_branches; r++)
+                        {
+                            d_branch_outputs[r] += taps[r] * samples[r];
+                        }
+                }
+
+            auto phase = static_cast<uint32_t>(((d_sample_counter + i) / d_decimation) % oversampling);
+            for (int32_t c = 0; c < num_channels; c++)
+                {
+                    const std::complex<float>* twiddles = d_twiddles.data() + c * d_branches;
+                    std::complex<float> sum(0.0, 0.0);
+                    for (uint32_t r = 0; r < d_branches; r++)
+                        {
+                            sum += twiddles[r] * d_branch_outputs[r];
+                        }
+                    out[c][produced] = d_rotations[c * oversampling + phase] * sum;
+                }
+            produced++;
+        }
+
+    // Keep the last L - 1 samples as the history of the next call
+    d_buffer.erase(d_buffer.begin(), d_buffer.begin() + (d_buffer.size() - (length - 1)));
+    d_sample_counter += n_in;
+    return produced;
+}
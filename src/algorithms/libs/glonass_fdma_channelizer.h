@@ -0,0 +1,115 @@
+/*!
+ * \file glonass_fdma_channelizer.h
+ * \brief Polyphase filter bank that splits the GLONASS band into its FDMA
+ * sub-bands
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GLONASS_FDMA_CHANNELIZER_H_
+#define GNSS_SDR_GLONASS_FDMA_CHANNELIZER_H_
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+
+/*!
+ * \brief This class implements a 2x oversampled polyphase channelizer for
+ * the GLONASS FDMA signals.
+ *
+ * The input, sampled at fs, is split into M = fs / channel_spacing_hz
+ * branches, and the 14 sub-bands of the frequency channels k = -7 ... +6
+ * are brought to baseband, low-pass filtered and decimated by M / 2 in a
+ * single pass, so each output runs at twice the channel spacing. The
+ * prototype filter is symmetric and its delay is compensated, so output
+ * sample n corresponds to input sample n * decimation().
+ *
+ * Channel k of the output is the input mixed down by k * channel_spacing_hz,
+ * which is the same offset the acquisition and tracking blocks would apply
+ * to the wideband stream.
+ */
+class Glonass_Fdma_Channelizer
+{
+public:
+    static const int32_t first_channel = -7;
+    static const int32_t num_channels = 14;
+    static const uint32_t oversampling = 2;
+
+    /*!
+     * \brief Builds the channelizer. Throws std::invalid_argument if \p fs
+     * is not an even multiple of \p channel_spacing_hz, or if it is too low
+     * to hold the 14 sub-bands without aliasing.
+     */
+    Glonass_Fdma_Channelizer(int64_t fs, double channel_spacing_hz, uint32_t taps_per_branch = 16);
+
+    /*!
+     * \brief Sampling rate of each output, in samples per second
+     */
+    static int64_t output_rate(double channel_spacing_hz);
+
+    /*!
+     * \brief Processes \p n_in input samples and writes the resulting
+     * samples of every sub-band to out[k - first_channel]. Returns the
+     * number of samples written to each output, at most
+     * ceil(n_in / decimation()). The state is kept between calls, so the
+     * input can be fed in chunks of any size.
+     */
+    uint32_t filter(const std::complex<float>* in, uint32_t n_in, std::complex<float>* const* out);
+
+    /*!
+     * \brief Clears the filter state, as if no sample had been processed
+     */
+    void reset();
+
+    inline uint32_t branches() const
+    {
+        return d_branches;
+    }
+
+    inline uint32_t decimation() const
+    {
+        return d_decimation;
+    }
+
+    inline const std::vector<float>& taps() const
+    {
+        return d_taps;
+    }
+
+private:
+    uint32_t d_branches;          // M, number of polyphase branches
+    uint32_t d_decimation;        // M / oversampling
+    uint32_t d_taps_per_branch;
+    std::vector<float> d_taps;    // prototype low-pass filter, time-reversed
+    std::vector<std::complex<float>> d_twiddles;   // num_channels x M
+    std::vector<std::complex<float>> d_rotations;  // num_channels x oversampling
+    std::vector<std::complex<float>> d_buffer;     // history plus the current chunk
+    std::vector<std::complex<float>> d_branch_outputs;
+    uint64_t d_sample_counter;    // input samples processed since the last reset
+    uint32_t d_pending_skip;      // outputs still to drop to compensate the filter delay
+};
+
+#endif
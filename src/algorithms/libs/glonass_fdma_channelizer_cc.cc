@@ -0,0 +1,81 @@
+/*!
+ * \file glonass_fdma_channelizer_cc.cc
+ * \brief GNU Radio block that splits the GLONASS band into its 14 FDMA
+ * sub-bands
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "glonass_fdma_channelizer_cc.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <vector>
+
+
+glonass_fdma_channelizer_cc_sptr glonass_fdma_make_channelizer_cc(int64_t fs, double channel_spacing_hz)
+{
+    return glonass_fdma_channelizer_cc_sptr(new glonass_fdma_channelizer_cc(fs, channel_spacing_hz));
+}
+
+
+glonass_fdma_channelizer_cc::glonass_fdma_channelizer_cc(int64_t fs, double channel_spacing_hz) : gr::block("glonass_fdma_channelizer_cc",
+                                                                                                     gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                                                                                                     gr::io_signature::make(Glonass_Fdma_Channelizer::num_channels, Glonass_Fdma_Channelizer::num_channels, sizeof(gr_complex))),
+                                                                                                 d_channelizer(fs, channel_spacing_hz)
+{
+    set_relative_rate(1.0 / static_cast<double>(d_channelizer.decimation()));
+    LOG(INFO) << "GLONASS FDMA channelizer with " << d_channelizer.branches() << " branches, "
+              << d_channelizer.taps().size() << " taps and decimation factor of " << d_channelizer.decimation();
+}
+
+
+void glonass_fdma_channelizer_cc::forecast(int noutput_items, gr_vector_int &ninput_items_required)
+{
+    ninput_items_required[0] = noutput_items * static_cast<int>(d_channelizer.decimation());
+}
+
+
+int glonass_fdma_channelizer_cc::general_work(int noutput_items, gr_vector_int &ninput_items,
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    // Whole decimation periods only, so that every call produces at most
+    // one output sample per period consumed
+    const auto decimation = static_cast<int>(d_channelizer.decimation());
+    int periods = std::min(noutput_items, ninput_items[0] / decimation);
+    if (periods == 0)
+        {
+            return 0;
+        }
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    std::vector<gr_complex *> out(output_items.size());
+    for (size_t c = 0; c < output_items.size(); c++)
+        {
+            out[c] = reinterpret_cast<gr_complex *>(output_items[c]);
+        }
+    uint32_t produced = d_channelizer.filter(in, periods * decimation, out.data());
+    consume_each(periods * decimation);
+    return static_cast<int>(produced);
+}
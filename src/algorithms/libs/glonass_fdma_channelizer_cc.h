@@ -0,0 +1,67 @@
+/*!
+ * \file glonass_fdma_channelizer_cc.h
+ * \brief GNU Radio block that splits the GLONASS band into its 14 FDMA
+ * sub-bands
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GLONASS_FDMA_CHANNELIZER_CC_H_
+#define GNSS_SDR_GLONASS_FDMA_CHANNELIZER_CC_H_
+
+#include "glonass_fdma_channelizer.h"
+#include <boost/shared_ptr.hpp>
+#include <gnuradio/block.h>
+#include <cstdint>
+
+
+class glonass_fdma_channelizer_cc;
+
+typedef boost::shared_ptr<glonass_fdma_channelizer_cc> glonass_fdma_channelizer_cc_sptr;
+
+glonass_fdma_channelizer_cc_sptr glonass_fdma_make_channelizer_cc(int64_t fs, double channel_spacing_hz);
+
+/*!
+ * \brief Implementation of a GNU Radio block with one wideband input and
+ * one output per GLONASS frequency channel, from k = -7 (output 0) to
+ * k = +6 (output 13), each one decimated by
+ * Glonass_Fdma_Channelizer::decimation().
+ */
+class glonass_fdma_channelizer_cc : public gr::block
+{
+public:
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
+        gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
+
+private:
+    friend glonass_fdma_channelizer_cc_sptr glonass_fdma_make_channelizer_cc(int64_t fs, double channel_spacing_hz);
+    glonass_fdma_channelizer_cc(int64_t fs, double channel_spacing_hz);
+
+    Glonass_Fdma_Channelizer d_channelizer;
+};
+
+#endif
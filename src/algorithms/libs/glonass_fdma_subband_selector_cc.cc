@@ -0,0 +1,76 @@
+/*!
+ * \file glonass_fdma_subband_selector_cc.cc
+ * \brief GNU Radio block that forwards the GLONASS FDMA sub-band of the
+ * satellite assigned to a channel
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "glonass_fdma_subband_selector_cc.h"
+#include "glonass_fdma_channelizer.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <cstring>
+
+
+glonass_fdma_subband_selector_cc_sptr glonass_fdma_make_subband_selector_cc()
+{
+    return glonass_fdma_subband_selector_cc_sptr(new glonass_fdma_subband_selector_cc());
+}
+
+
+glonass_fdma_subband_selector_cc::glonass_fdma_subband_selector_cc() : gr::sync_block("glonass_fdma_subband_selector_cc",
+                                                                           gr::io_signature::make(Glonass_Fdma_Channelizer::num_channels, Glonass_Fdma_Channelizer::num_channels, sizeof(gr_complex)),
+                                                                           gr::io_signature::make(1, 1, sizeof(gr_complex))),
+                                                                       d_frequency_channel(0)
+{
+}
+
+
+void glonass_fdma_subband_selector_cc::set_frequency_channel(int32_t k)
+{
+    if (k < Glonass_Fdma_Channelizer::first_channel or k >= Glonass_Fdma_Channelizer::first_channel + Glonass_Fdma_Channelizer::num_channels)
+        {
+            LOG(WARNING) << "Invalid GLONASS frequency channel " << k;
+            return;
+        }
+    d_frequency_channel.store(k);
+}
+
+
+int32_t glonass_fdma_subband_selector_cc::frequency_channel() const
+{
+    return d_frequency_channel.load();
+}
+
+
+int glonass_fdma_subband_selector_cc::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    int32_t subband = d_frequency_channel.load() - Glonass_Fdma_Channelizer::first_channel;
+    memcpy(output_items[0], input_items[subband], noutput_items * sizeof(gr_complex));
+    return noutput_items;
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file glonass_fdma_subband_selector_cc.h
+ * \brief GNU Radio block that forwards the GLONASS FDMA sub-band of the
+ * satellite assigned to a channel
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GLONASS_FDMA_SUBBAND_SELECTOR_CC_H_
+#define GNSS_SDR_GLONASS_FDMA_SUBBAND_SELECTOR_CC_H_
+
+#include <boost/shared_ptr.hpp>
+#include <gnuradio/sync_block.h>
+#include <atomic>
+#include <cstdint>
+
+
+class glonass_fdma_subband_selector_cc;
+
+typedef boost::shared_ptr<glonass_fdma_subband_selector_cc> glonass_fdma_subband_selector_cc_sptr;
+
+glonass_fdma_subband_selector_cc_sptr glonass_fdma_make_subband_selector_cc();
+
+/*!
+ * \brief Implementation of a GNU Radio block that takes the 14 outputs of
+ * a glonass_fdma_channelizer_cc block and copies the one of the current
+ * frequency channel to its output.
+ *
+ * All the sub-bands are sample-aligned, so switching from one to another
+ * does not break the sample count seen by the acquisition and tracking
+ * blocks of the channel.
+ */
+class glonass_fdma_subband_selector_cc : public gr::sync_block
+{
+public:
+    /*!
+     * \brief Selects the sub-band of frequency channel \p k (-7 ... +6).
+     * It can be called from any thread while the flowgraph runs.
+     */
+    void set_frequency_channel(int32_t k);
+
+    int32_t frequency_channel() const;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend glonass_fdma_subband_selector_cc_sptr glonass_fdma_make_subband_selector_cc();
+    glonass_fdma_subband_selector_cc();
+
+    std::atomic<int32_t> d_frequency_channel;
+};
+
+#endif
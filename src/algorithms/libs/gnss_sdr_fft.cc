@@ -0,0 +1,171 @@
+/*!
+ * \file gnss_sdr_fft.cc
+ * \brief Complex FFT with FFTW plans shared among all the blocks of the
+ * receiver, and persistence of the FFTW wisdom.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft.h"
+#include <fftw3.h>
+#include <glog/logging.h>
+#include <gnuradio/fft/fft.h>
+#include <stdexcept>
+
+
+Gnss_Fft_Plan::Gnss_Fft_Plan(int32_t fft_size, bool forward)
+{
+    d_fft_size = fft_size;
+
+    // FFTW_MEASURE overwrites the arrays while planning, so temporary ones
+    // are used. They are allocated with fftwf_malloc, as the buffers of the
+    // Gnss_Fft objects, so that the plan can be executed over any of them.
+    auto* in = static_cast<fftwf_complex*>(fftwf_malloc(sizeof(fftwf_complex) * fft_size));
+    auto* out = static_cast<fftwf_complex*>(fftwf_malloc(sizeof(fftwf_complex) * fft_size));
+    {
+        gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+        d_plan = fftwf_plan_dft_1d(fft_size, in, out, forward ? FFTW_FORWARD : FFTW_BACKWARD, FFTW_MEASURE);
+    }
+    fftwf_free(in);
+    fftwf_free(out);
+    if (d_plan == nullptr)
+        {
+            throw std::runtime_error("Gnss_Fft_Plan: FFTW could not create a plan of size " + std::to_string(fft_size));
+        }
+}
+
+
+Gnss_Fft_Plan::~Gnss_Fft_Plan()
+{
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    fftwf_destroy_plan(static_cast<fftwf_plan>(d_plan));
+}
+
+
+void Gnss_Fft_Plan::execute(gr_complex* in, gr_complex* out) const
+{
+    // New-array execution is thread-safe
+    fftwf_execute_dft(static_cast<fftwf_plan>(d_plan), reinterpret_cast<fftwf_complex*>(in), reinterpret_cast<fftwf_complex*>(out));
+}
+
+
+Gnss_Fft_Plan_Registry& Gnss_Fft_Plan_Registry::instance()
+{
+    static Gnss_Fft_Plan_Registry registry;
+    return registry;
+}
+
+
+Gnss_Fft_Plan_Registry::Gnss_Fft_Plan_Registry()
+{
+    d_created = 0ULL;
+    d_reused = 0ULL;
+}
+
+
+Gnss_Fft_Plan_Registry::Plan_sptr Gnss_Fft_Plan_Registry::get(int32_t fft_size, bool forward)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    auto key = std::make_pair(fft_size, forward);
+    auto it = d_plans.find(key);
+    if (it != d_plans.end())
+        {
+            d_reused++;
+            return it->second;
+        }
+    Plan_sptr plan = std::make_shared<const Gnss_Fft_Plan>(fft_size, forward);
+    d_plans.insert(std::make_pair(key, plan));
+    d_created++;
+    return plan;
+}
+
+
+bool Gnss_Fft_Plan_Registry::load_wisdom(const std::string& filename)
+{
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    if (fftwf_import_wisdom_from_filename(filename.c_str()) == 0)
+        {
+            LOG(INFO) << "No FFTW wisdom could be loaded from " << filename;
+            return false;
+        }
+    LOG(INFO) << "FFTW wisdom loaded from " << filename;
+    return true;
+}
+
+
+bool Gnss_Fft_Plan_Registry::save_wisdom(const std::string& filename)
+{
+    gr::fft::planner::scoped_lock lock(gr::fft::planner::mutex());
+    if (fftwf_export_wisdom_to_filename(filename.c_str()) == 0)
+        {
+            LOG(WARNING) << "Could not save the FFTW wisdom to " << filename;
+            return false;
+        }
+    LOG(INFO) << "FFTW wisdom saved to " << filename;
+    return true;
+}
+
+
+size_t Gnss_Fft_Plan_Registry::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_plans.size();
+}
+
+
+uint64_t Gnss_Fft_Plan_Registry::created() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_created;
+}
+
+
+uint64_t Gnss_Fft_Plan_Registry::reused() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_reused;
+}
+
+
+Gnss_Fft::Gnss_Fft(int32_t fft_size, bool forward)
+{
+    d_fft_size = fft_size;
+    d_plan = Gnss_Fft_Plan_Registry::instance().get(fft_size, forward);
+    d_inbuf = static_cast<gr_complex*>(fftwf_malloc(sizeof(fftwf_complex) * fft_size));
+    d_outbuf = static_cast<gr_complex*>(fftwf_malloc(sizeof(fftwf_complex) * fft_size));
+}
+
+
+Gnss_Fft::~Gnss_Fft()
+{
+    fftwf_free(d_inbuf);
+    fftwf_free(d_outbuf);
+}
+
+
+void Gnss_Fft::execute()
+{
+    d_plan->execute(d_inbuf, d_outbuf);
+}
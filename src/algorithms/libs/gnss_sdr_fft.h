@@ -0,0 +1,169 @@
+/*!
+ * \file gnss_sdr_fft.h
+ * \brief Complex FFT with FFTW plans shared among all the blocks of the
+ * receiver, and persistence of the FFTW wisdom.
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SDR_FFT_H_
+#define GNSS_SDR_GNSS_SDR_FFT_H_
+
+#include <gnuradio/gr_complex.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+
+/*!
+ * \brief FFTW plan of a given size and direction. It is executed over the
+ * buffers of each Gnss_Fft object, so a single plan can be used by several
+ * threads at the same time.
+ */
+class Gnss_Fft_Plan
+{
+public:
+    Gnss_Fft_Plan(int32_t fft_size, bool forward);
+    ~Gnss_Fft_Plan();
+
+    Gnss_Fft_Plan(const Gnss_Fft_Plan&) = delete;
+    Gnss_Fft_Plan& operator=(const Gnss_Fft_Plan&) = delete;
+
+    void execute(gr_complex* in, gr_complex* out) const;
+
+    inline int32_t fft_size() const
+    {
+        return d_fft_size;
+    }
+
+private:
+    void* d_plan;  // fftwf_plan
+    int32_t d_fft_size;
+};
+
+
+/*!
+ * \brief This class implements a process-wide registry of FFTW plans.
+ *
+ * Creating a plan with FFTW_MEASURE is expensive, and a receiver with many
+ * channels asks for the same few sizes over and over again. Plans are
+ * created once per (size, direction) pair and kept for the lifetime of the
+ * process. Planning is serialized with the GNU Radio FFT planner, since the
+ * FFTW planner is not thread-safe.
+ *
+ * The registry also loads and saves the FFTW wisdom, so that the plans of a
+ * given machine only need to be measured the first time the receiver runs.
+ */
+class Gnss_Fft_Plan_Registry
+{
+public:
+    using Plan_sptr = std::shared_ptr<const Gnss_Fft_Plan>;
+
+    static Gnss_Fft_Plan_Registry& instance();
+
+    /*!
+     * \brief Returns the plan of size \p fft_size in the given direction,
+     * creating it on first use.
+     */
+    Plan_sptr get(int32_t fft_size, bool forward);
+
+    /*!
+     * \brief Imports the FFTW wisdom stored in \p filename. Returns false if
+     * the file does not exist or cannot be parsed.
+     */
+    bool load_wisdom(const std::string& filename);
+
+    /*!
+     * \brief Exports the accumulated FFTW wisdom to \p filename.
+     */
+    bool save_wisdom(const std::string& filename);
+
+    size_t size() const;
+    uint64_t created() const;
+    uint64_t reused() const;
+
+    Gnss_Fft_Plan_Registry(const Gnss_Fft_Plan_Registry&) = delete;
+    Gnss_Fft_Plan_Registry& operator=(const Gnss_Fft_Plan_Registry&) = delete;
+
+private:
+    Gnss_Fft_Plan_Registry();
+
+    std::map<std::pair<int32_t, bool>, Plan_sptr> d_plans;
+    uint64_t d_created;
+    uint64_t d_reused;
+    mutable std::mutex d_mutex;
+};
+
+
+/*!
+ * \brief Complex FFT with its own input and output buffers and a shared
+ * plan. It is a drop-in replacement of gr::fft::fft_complex for
+ * single-threaded transforms.
+ */
+class Gnss_Fft
+{
+public:
+    explicit Gnss_Fft(int32_t fft_size, bool forward = true);
+    ~Gnss_Fft();
+
+    Gnss_Fft(const Gnss_Fft&) = delete;
+    Gnss_Fft& operator=(const Gnss_Fft&) = delete;
+
+    inline gr_complex* get_inbuf() const
+    {
+        return d_inbuf;
+    }
+
+    inline gr_complex* get_outbuf() const
+    {
+        return d_outbuf;
+    }
+
+    inline int32_t inbuf_length() const
+    {
+        return d_fft_size;
+    }
+
+    inline int32_t outbuf_length() const
+    {
+        return d_fft_size;
+    }
+
+    /*!
+     * \brief Computes the FFT of the input buffer into the output buffer
+     */
+    void execute();
+
+private:
+    Gnss_Fft_Plan_Registry::Plan_sptr d_plan;
+    gr_complex* d_inbuf;
+    gr_complex* d_outbuf;
+    int32_t d_fft_size;
+};
+
+#endif
@@ -0,0 +1,104 @@
+/*!
+ * \file volk_gnsssdr_avx512_intrinsics.h
+ * \brief This file is intended to hold AVX-512 intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ *
+ * Copyright (C) 2010-2018 (see AUTHORS file for a list of contributors)
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H_
+#define INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H_
+#include <immintrin.h>
+
+static inline __m512
+_mm512_complexmul_ps(__m512 x, __m512 y)
+{
+    __m512 yl, yh, tmp;
+    yl = _mm512_moveldup_ps(y);             // Load yl with cr,cr,dr,dr ...
+    yh = _mm512_movehdup_ps(y);             // Load yh with ci,ci,di,di ...
+    tmp = _mm512_permute_ps(x, 0xB1);       // Re-arrange x to be ai,ar,bi,br ...
+    tmp = _mm512_mul_ps(tmp, yh);           // tmp = ai*ci,ar*ci,bi*di,br*di ...
+    return _mm512_fmaddsub_ps(x, yl, tmp);  // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di ...
+}
+
+static inline __m512 _mm512_complexnormalise_ps(__m512 z)
+{
+    __m512 tmp = _mm512_mul_ps(z, z);
+    tmp = _mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1));  // |z|^2 in both halves of each complex
+    return _mm512_div_ps(z, _mm512_sqrt_ps(tmp));
+}
+
+/* Sine and cosine of 16 floats at once, with the Cephes polynomials used by
+ * the SSE2 and AVX2 sincos kernels. Only AVX-512F instructions are used: the
+ * bitwise operations on floats are done in the integer domain. */
+static inline void _mm512_sincos_ps(__m512 x, __m512* sine, __m512* cosine)
+{
+    const __m512i sign_mask = _mm512_set1_epi32((int)0x80000000);
+    const __m512i inv_sign_mask = _mm512_set1_epi32(~0x80000000);
+    const __m512i pi32_1 = _mm512_set1_epi32(1);
+    const __m512i pi32_inv1 = _mm512_set1_epi32(~1);
+    const __m512i pi32_2 = _mm512_set1_epi32(2);
+    const __m512i pi32_4 = _mm512_set1_epi32(4);
+
+    __m512i xi, sign_bit_sin, sign_bit_cos, swap_sign_bit_sin, emm2;
+    __m512 y, y2, z;
+    __mmask16 poly_mask;
+
+    /* take the absolute value and extract the sign bit */
+    xi = _mm512_castps_si512(x);
+    sign_bit_sin = _mm512_and_epi32(xi, sign_mask);
+    x = _mm512_castsi512_ps(_mm512_and_epi32(xi, inv_sign_mask));
+
+    /* scale by 4/Pi and keep the integer part, j = (j + 1) & (~1) */
+    y = _mm512_mul_ps(x, _mm512_set1_ps(1.27323954473516f));
+    emm2 = _mm512_cvttps_epi32(y);
+    emm2 = _mm512_and_epi32(_mm512_add_epi32(emm2, pi32_1), pi32_inv1);
+    y = _mm512_cvtepi32_ps(emm2);
+
+    /* swap sign flag for the sine, and polynom selection mask */
+    swap_sign_bit_sin = _mm512_slli_epi32(_mm512_and_epi32(emm2, pi32_4), 29);
+    poly_mask = _mm512_cmpeq_epi32_mask(_mm512_and_epi32(emm2, pi32_2), _mm512_setzero_si512());
+    sign_bit_cos = _mm512_slli_epi32(_mm512_andnot_epi32(_mm512_sub_epi32(emm2, pi32_2), pi32_4), 29);
+    sign_bit_sin = _mm512_xor_epi32(sign_bit_sin, swap_sign_bit_sin);
+
+    /* extended precision modular arithmetic, x = ((x - y * DP1) - y * DP2) - y * DP3 */
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-0.78515625f), x);
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-2.4187564849853515625e-4f), x);
+    x = _mm512_fmadd_ps(y, _mm512_set1_ps(-3.77489497744594108e-8f), x);
+
+    /* first polynom (0 <= x <= Pi/4) */
+    z = _mm512_mul_ps(x, x);
+    y = _mm512_fmadd_ps(_mm512_set1_ps(2.443315711809948e-5f), z, _mm512_set1_ps(-1.388731625493765e-3f));
+    y = _mm512_fmadd_ps(y, z, _mm512_set1_ps(4.166664568298827e-2f));
+    y = _mm512_mul_ps(_mm512_mul_ps(y, z), z);
+    y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+    y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+
+    /* second polynom (-Pi/4 <= x <= 0) */
+    y2 = _mm512_fmadd_ps(_mm512_set1_ps(-1.9515295891e-4f), z, _mm512_set1_ps(8.3321608736e-3f));
+    y2 = _mm512_fmadd_ps(y2, z, _mm512_set1_ps(-1.6666654611e-1f));
+    y2 = _mm512_mul_ps(y2, z);
+    y2 = _mm512_fmadd_ps(y2, x, x);
+
+    /* select the correct result from the two polynoms and update the signs */
+    *sine = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_mask_blend_ps(poly_mask, y, y2)), sign_bit_sin));
+    *cosine = _mm512_castsi512_ps(_mm512_xor_epi32(_mm512_castps_si512(_mm512_mask_blend_ps(poly_mask, y2, y)), sign_bit_cos));
+}
+
+#endif /* INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H_ */
@@ -57,6 +57,120 @@
 #include <volk_gnsssdr/volk_gnsssdr_common.h>
 #include <inttypes.h>
 
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_index_max_32u_a_avx512f(uint32_t* target, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            uint32_t number = 0;
+            const uint32_t sixteenthPoints = num_points / 16;
+
+            float* inputPtr = (float*)src0;
+
+            // Integer indexes, so that they stay exact beyond 2^24 points
+            const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+            __m512i currentIndexes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+            float max = src0[0];
+            uint32_t index = 0;
+            __m512 maxValues = _mm512_set1_ps(max);
+            __m512i maxValuesIndex = _mm512_setzero_si512();
+            __mmask16 compareResults;
+            __m512 currentValues;
+
+            for (; number < sixteenthPoints; number++)
+                {
+                    currentValues = _mm512_load_ps(inputPtr);
+                    inputPtr += 16;
+                    compareResults = _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OQ);
+                    maxValuesIndex = _mm512_mask_mov_epi32(maxValuesIndex, compareResults, currentIndexes);
+                    maxValues = _mm512_mask_mov_ps(maxValues, compareResults, currentValues);
+                    currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+                }
+
+            // Largest value of the 16 lanes, keeping the lowest index on ties
+            if (sixteenthPoints > 0)
+                {
+                    max = _mm512_reduce_max_ps(maxValues);
+                    compareResults = _mm512_cmp_ps_mask(maxValues, _mm512_set1_ps(max), _CMP_EQ_OQ);
+                    index = (uint32_t)_mm512_mask_reduce_min_epi32(compareResults, maxValuesIndex);
+                }
+
+            number = sixteenthPoints * 16;
+            for (; number < num_points; number++)
+                {
+                    if (src0[number] > max)
+                        {
+                            index = number;
+                            max = src0[number];
+                        }
+                }
+            target[0] = index;
+        }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32f_index_max_32u_u_avx512f(uint32_t* target, const float* src0, uint32_t num_points)
+{
+    if (num_points > 0)
+        {
+            uint32_t number = 0;
+            const uint32_t sixteenthPoints = num_points / 16;
+
+            float* inputPtr = (float*)src0;
+
+            // Integer indexes, so that they stay exact beyond 2^24 points
+            const __m512i indexIncrementValues = _mm512_set1_epi32(16);
+            __m512i currentIndexes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+            float max = src0[0];
+            uint32_t index = 0;
+            __m512 maxValues = _mm512_set1_ps(max);
+            __m512i maxValuesIndex = _mm512_setzero_si512();
+            __mmask16 compareResults;
+            __m512 currentValues;
+
+            for (; number < sixteenthPoints; number++)
+                {
+                    currentValues = _mm512_loadu_ps(inputPtr);
+                    inputPtr += 16;
+                    compareResults = _mm512_cmp_ps_mask(currentValues, maxValues, _CMP_GT_OQ);
+                    maxValuesIndex = _mm512_mask_mov_epi32(maxValuesIndex, compareResults, currentIndexes);
+                    maxValues = _mm512_mask_mov_ps(maxValues, compareResults, currentValues);
+                    currentIndexes = _mm512_add_epi32(currentIndexes, indexIncrementValues);
+                }
+
+            // Largest value of the 16 lanes, keeping the lowest index on ties
+            if (sixteenthPoints > 0)
+                {
+                    max = _mm512_reduce_max_ps(maxValues);
+                    compareResults = _mm512_cmp_ps_mask(maxValues, _mm512_set1_ps(max), _CMP_EQ_OQ);
+                    index = (uint32_t)_mm512_mask_reduce_min_epi32(compareResults, maxValuesIndex);
+                }
+
+            number = sixteenthPoints * 16;
+            for (; number < num_points; number++)
+                {
+                    if (src0[number] > max)
+                        {
+                            index = number;
+                            max = src0[number];
+                        }
+                }
+            target[0] = index;
+        }
+}
+
+#endif /*LV_HAVE_AVX512F*/
+
+
 #ifdef LV_HAVE_AVX
 #include <immintrin.h>
 
@@ -589,6 +589,88 @@ static inline void volk_gnsssdr_32f_sincos_32fc_u_sse2(lv_32fc_t* out, const flo
 #endif /* LV_HAVE_SSE2  */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+/* Cephes-based evaluation, as in the AVX2 version of volk_gnsssdr_s32f_sincos_32fc */
+static inline void volk_gnsssdr_32f_sincos_32fc_a_avx512f(lv_32fc_t* out, const float* in, unsigned int num_points)
+{
+    lv_32fc_t* bPtr = out;
+    const float* aPtr = in;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512 aVal, sine, cosine;
+
+    /* interleave the cosines and sines into complex values */
+    const __m512i lo_idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    for (; number < sixteenthPoints; number++)
+        {
+            aVal = _mm512_load_ps(aPtr);
+            __VOLK_GNSSSDR_PREFETCH(aPtr + 32);
+            _mm512_sincos_ps(aVal, &sine, &cosine);
+
+            _mm512_store_ps((float*)bPtr, _mm512_permutex2var_ps(cosine, lo_idx, sine));
+            _mm512_store_ps((float*)(bPtr + 8), _mm512_permutex2var_ps(cosine, hi_idx, sine));
+            bPtr += 16;
+            aPtr += 16;
+        }
+    _mm256_zeroupper();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            float _in = *aPtr++;
+            *bPtr++ = lv_cmake(cosf(_in), sinf(_in));
+        }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+/* Cephes-based evaluation, as in the AVX2 version of volk_gnsssdr_s32f_sincos_32fc */
+static inline void volk_gnsssdr_32f_sincos_32fc_u_avx512f(lv_32fc_t* out, const float* in, unsigned int num_points)
+{
+    lv_32fc_t* bPtr = out;
+    const float* aPtr = in;
+
+    unsigned int number = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    __m512 aVal, sine, cosine;
+
+    /* interleave the cosines and sines into complex values */
+    const __m512i lo_idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    for (; number < sixteenthPoints; number++)
+        {
+            aVal = _mm512_loadu_ps(aPtr);
+            __VOLK_GNSSSDR_PREFETCH(aPtr + 32);
+            _mm512_sincos_ps(aVal, &sine, &cosine);
+
+            _mm512_storeu_ps((float*)bPtr, _mm512_permutex2var_ps(cosine, lo_idx, sine));
+            _mm512_storeu_ps((float*)(bPtr + 8), _mm512_permutex2var_ps(cosine, hi_idx, sine));
+            bPtr += 16;
+            aPtr += 16;
+        }
+    _mm256_zeroupper();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            float _in = *aPtr++;
+            *bPtr++ = lv_cmake(cosf(_in), sinf(_in));
+        }
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_GENERIC
 
 static inline void volk_gnsssdr_32f_sincos_32fc_generic(lv_32fc_t* out, const float* in, unsigned int num_points)
@@ -615,6 +615,166 @@ static inline void volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_u_avx(floa
         }
 }
 
+#endif
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_u_avx512f(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx512_iters = num_points / 16;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m512 sixteens = _mm512_set1_ps(16.0f);
+    const __m512 ones = _mm512_set1_ps(1.0f);
+    const __m512 rem_code_phase_chips_reg = _mm512_set1_ps(rem_code_phase_chips);
+    const __m512 code_phase_step_chips_reg = _mm512_set1_ps(code_phase_step_chips);
+    const __m512 code_phase_rate_step_chips_reg = _mm512_set1_ps(code_phase_rate_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m512i zeros = _mm512_setzero_si512();
+    const __m512i code_length_chips_reg = _mm512_set1_epi32((int)code_length_chips);
+    const __m512 code_length_chips_reg_f = _mm512_set1_ps((float)code_length_chips);
+    const __m512 n0 = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+
+    __m512i local_code_chip_index_reg, i;
+    __m512 aux, aux2, aux3, shifts_chips_reg, c, cTrunc, base, indexn, indexnn;
+    __mmask16 negatives;
+
+    shifts_chips_reg = _mm512_set1_ps((float)shifts_chips[0]);
+    aux2 = _mm512_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+    indexn = n0;
+    for (n = 0; n < avx512_iters; n++)
+        {
+            __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[0][16 * n + 15], 1, 0);
+            aux = _mm512_mul_ps(code_phase_step_chips_reg, indexn);
+            indexnn = _mm512_mul_ps(indexn, indexn);
+            aux3 = _mm512_mul_ps(code_phase_rate_step_chips_reg, indexnn);
+            aux = _mm512_add_ps(aux, aux3);
+            aux = _mm512_add_ps(aux, aux2);
+            // floor
+            aux = _mm512_floor_ps(aux);
+
+            // Correct negative shift
+            c = _mm512_div_ps(aux, code_length_chips_reg_f);
+            aux3 = _mm512_add_ps(c, ones);
+            i = _mm512_cvttps_epi32(aux3);
+            cTrunc = _mm512_cvtepi32_ps(i);
+            base = _mm512_mul_ps(cTrunc, code_length_chips_reg_f);
+            local_code_chip_index_reg = _mm512_cvttps_epi32(_mm512_sub_ps(aux, base));
+
+            negatives = _mm512_cmplt_epi32_mask(local_code_chip_index_reg, zeros);
+            local_code_chip_index_reg = _mm512_mask_add_epi32(local_code_chip_index_reg, negatives, local_code_chip_index_reg, code_length_chips_reg);
+
+            // gather the code samples
+            _mm512_storeu_ps(&_result[0][n * 16], _mm512_i32gather_ps(local_code_chip_index_reg, local_code, 4));
+            indexn = _mm512_add_ps(indexn, sixteens);
+        }
+
+    _mm256_zeroupper();
+
+    for (n = avx512_iters * 16; n < num_points; n++)
+        {
+            // resample code for first tap
+            local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + code_phase_rate_step_chips * (float)(n * n) + shifts_chips[0] - rem_code_phase_chips);
+            // Take into account that in multitap correlators, the shifts can be negative!
+            if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+            local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+            _result[0][n] = local_code[local_code_chip_index_];
+        }
+
+    // adjacent correlators
+    unsigned int shift_samples = 0;
+    for (current_correlator_tap = 1; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shift_samples += (int)round((shifts_chips[current_correlator_tap] - shifts_chips[current_correlator_tap - 1]) / code_phase_step_chips);
+            memcpy(&_result[current_correlator_tap][0], &_result[0][shift_samples], (num_points - shift_samples) * sizeof(float));
+            memcpy(&_result[current_correlator_tap][num_points - shift_samples], &_result[0][0], shift_samples * sizeof(float));
+        }
+}
+
+#endif
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_a_avx512f(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx512_iters = num_points / 16;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m512 sixteens = _mm512_set1_ps(16.0f);
+    const __m512 ones = _mm512_set1_ps(1.0f);
+    const __m512 rem_code_phase_chips_reg = _mm512_set1_ps(rem_code_phase_chips);
+    const __m512 code_phase_step_chips_reg = _mm512_set1_ps(code_phase_step_chips);
+    const __m512 code_phase_rate_step_chips_reg = _mm512_set1_ps(code_phase_rate_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m512i zeros = _mm512_setzero_si512();
+    const __m512i code_length_chips_reg = _mm512_set1_epi32((int)code_length_chips);
+    const __m512 code_length_chips_reg_f = _mm512_set1_ps((float)code_length_chips);
+    const __m512 n0 = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+
+    __m512i local_code_chip_index_reg, i;
+    __m512 aux, aux2, aux3, shifts_chips_reg, c, cTrunc, base, indexn, indexnn;
+    __mmask16 negatives;
+
+    shifts_chips_reg = _mm512_set1_ps((float)shifts_chips[0]);
+    aux2 = _mm512_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+    indexn = n0;
+    for (n = 0; n < avx512_iters; n++)
+        {
+            __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[0][16 * n + 15], 1, 0);
+            aux = _mm512_mul_ps(code_phase_step_chips_reg, indexn);
+            indexnn = _mm512_mul_ps(indexn, indexn);
+            aux3 = _mm512_mul_ps(code_phase_rate_step_chips_reg, indexnn);
+            aux = _mm512_add_ps(aux, aux3);
+            aux = _mm512_add_ps(aux, aux2);
+            // floor
+            aux = _mm512_floor_ps(aux);
+
+            // Correct negative shift
+            c = _mm512_div_ps(aux, code_length_chips_reg_f);
+            aux3 = _mm512_add_ps(c, ones);
+            i = _mm512_cvttps_epi32(aux3);
+            cTrunc = _mm512_cvtepi32_ps(i);
+            base = _mm512_mul_ps(cTrunc, code_length_chips_reg_f);
+            local_code_chip_index_reg = _mm512_cvttps_epi32(_mm512_sub_ps(aux, base));
+
+            negatives = _mm512_cmplt_epi32_mask(local_code_chip_index_reg, zeros);
+            local_code_chip_index_reg = _mm512_mask_add_epi32(local_code_chip_index_reg, negatives, local_code_chip_index_reg, code_length_chips_reg);
+
+            // gather the code samples
+            _mm512_store_ps(&_result[0][n * 16], _mm512_i32gather_ps(local_code_chip_index_reg, local_code, 4));
+            indexn = _mm512_add_ps(indexn, sixteens);
+        }
+
+    _mm256_zeroupper();
+
+    for (n = avx512_iters * 16; n < num_points; n++)
+        {
+            // resample code for first tap
+            local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + code_phase_rate_step_chips * (float)(n * n) + shifts_chips[0] - rem_code_phase_chips);
+            // Take into account that in multitap correlators, the shifts can be negative!
+            if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+            local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+            _result[0][n] = local_code[local_code_chip_index_];
+        }
+
+    // adjacent correlators
+    unsigned int shift_samples = 0;
+    for (current_correlator_tap = 1; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shift_samples += (int)round((shifts_chips[current_correlator_tap] - shifts_chips[current_correlator_tap - 1]) / code_phase_step_chips);
+            memcpy(&_result[current_correlator_tap][0], &_result[0][shift_samples], (num_points - shift_samples) * sizeof(float));
+            memcpy(&_result[current_correlator_tap][num_points - shift_samples], &_result[0][0], shift_samples * sizeof(float));
+        }
+}
+
 #endif
 //
 //
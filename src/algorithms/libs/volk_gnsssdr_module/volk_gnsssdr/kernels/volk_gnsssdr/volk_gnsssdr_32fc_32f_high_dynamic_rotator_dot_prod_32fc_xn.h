@@ -119,4 +119,1488 @@ static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_g
 
 #endif /*LV_HAVE_GENERIC*/
 
+
+#ifdef LV_HAVE_SSE3
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <pmmintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_u_sse3(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m128 a0Val, a1Val, xVal, b0Val, b1Val, tmp1, tmp2;
+    __m128 dotProdVal0[num_a_vectors];
+    __m128 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm_setzero_ps();
+            dotProdVal1[vec_ind] = _mm_setzero_ps();
+        }
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t step_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^4 * phase_inc_rate^(4 k + 6), which is fixed, times
+    // phase_inc_rate^(4 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^4
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^4
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^16
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^6
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m128 z0 = _mm_load_ps((float*)phase_vec);
+    __m128 z1 = _mm_load_ps((float*)(phase_vec + 2));
+    const __m128 s0 = _mm_load_ps((float*)step_vec);
+    const __m128 s1 = _mm_load_ps((float*)(step_vec + 2));
+    const __m128 s0l = _mm_moveldup_ps(s0), s0h = _mm_movehdup_ps(s0);
+    const __m128 s1l = _mm_moveldup_ps(s1), s1h = _mm_movehdup_ps(s1);
+    phase_vec[0] = step_rate;
+    phase_vec[1] = step_rate;
+    const __m128 ds = _mm_load_ps((float*)phase_vec);
+    __m128 q = _mm_setr_ps(1.0f, 0.0f, 1.0f, 0.0f);
+
+    for (; number < quarterPoints; number++)
+        {
+            a0Val = _mm_loadu_ps(aPtr);
+            a1Val = _mm_loadu_ps(aPtr + 4);
+
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+
+            z0 = _mm_addsub_ps(_mm_mul_ps(z0, s0l), _mm_mul_ps(_mm_shuffle_ps(z0, z0, 0xB1), s0h));
+            z1 = _mm_addsub_ps(_mm_mul_ps(z1, s1l), _mm_mul_ps(_mm_shuffle_ps(z1, z1, 0xB1), s1h));
+            z0 = _mm_complexmul_ps(z0, q);
+            z1 = _mm_complexmul_ps(z1, q);
+            q = _mm_complexmul_ps(q, ds);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3
+                    b0Val = _mm_unpacklo_ps(xVal, xVal);  // t0|t0|t1|t1
+                    b1Val = _mm_unpackhi_ps(xVal, xVal);  // t2|t2|t3|t3
+
+                    dotProdVal0[vec_ind] = _mm_add_ps(_mm_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm_add_ps(_mm_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+
+                    bPtr[vec_ind] += 4;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(q, q);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    q = _mm_div_ps(q, _mm_sqrt_ps(tmp1));
+                }
+
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[2];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 2; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = quarterPoints * 4;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_SSE3
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <pmmintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_a_sse3(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m128 a0Val, a1Val, xVal, b0Val, b1Val, tmp1, tmp2;
+    __m128 dotProdVal0[num_a_vectors];
+    __m128 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm_setzero_ps();
+            dotProdVal1[vec_ind] = _mm_setzero_ps();
+        }
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t step_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^4 * phase_inc_rate^(4 k + 6), which is fixed, times
+    // phase_inc_rate^(4 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^4
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^4
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^16
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^6
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m128 z0 = _mm_load_ps((float*)phase_vec);
+    __m128 z1 = _mm_load_ps((float*)(phase_vec + 2));
+    const __m128 s0 = _mm_load_ps((float*)step_vec);
+    const __m128 s1 = _mm_load_ps((float*)(step_vec + 2));
+    const __m128 s0l = _mm_moveldup_ps(s0), s0h = _mm_movehdup_ps(s0);
+    const __m128 s1l = _mm_moveldup_ps(s1), s1h = _mm_movehdup_ps(s1);
+    phase_vec[0] = step_rate;
+    phase_vec[1] = step_rate;
+    const __m128 ds = _mm_load_ps((float*)phase_vec);
+    __m128 q = _mm_setr_ps(1.0f, 0.0f, 1.0f, 0.0f);
+
+    for (; number < quarterPoints; number++)
+        {
+            a0Val = _mm_load_ps(aPtr);
+            a1Val = _mm_load_ps(aPtr + 4);
+
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+
+            z0 = _mm_addsub_ps(_mm_mul_ps(z0, s0l), _mm_mul_ps(_mm_shuffle_ps(z0, z0, 0xB1), s0h));
+            z1 = _mm_addsub_ps(_mm_mul_ps(z1, s1l), _mm_mul_ps(_mm_shuffle_ps(z1, z1, 0xB1), s1h));
+            z0 = _mm_complexmul_ps(z0, q);
+            z1 = _mm_complexmul_ps(z1, q);
+            q = _mm_complexmul_ps(q, ds);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3
+                    b0Val = _mm_unpacklo_ps(xVal, xVal);  // t0|t0|t1|t1
+                    b1Val = _mm_unpackhi_ps(xVal, xVal);  // t2|t2|t3|t3
+
+                    dotProdVal0[vec_ind] = _mm_add_ps(_mm_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm_add_ps(_mm_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+
+                    bPtr[vec_ind] += 4;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(q, q);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    q = _mm_div_ps(q, _mm_sqrt_ps(tmp1));
+                }
+
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[2];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 2; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = quarterPoints * 4;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_u_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val, x0Val, x1Val, yl, yh;
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[16];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^16 * phase_inc_rate^(16 k + 120), which is fixed, times
+    // phase_inc_rate^(16 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^16
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^16
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^256
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^120
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m256 z0 = _mm256_load_ps((float*)phase_vec);
+    __m256 z1 = _mm256_load_ps((float*)(phase_vec + 4));
+    __m256 z2 = _mm256_load_ps((float*)(phase_vec + 8));
+    __m256 z3 = _mm256_load_ps((float*)(phase_vec + 12));
+    const __m256 s0 = _mm256_load_ps((float*)step_vec);
+    const __m256 s1 = _mm256_load_ps((float*)(step_vec + 4));
+    const __m256 s2 = _mm256_load_ps((float*)(step_vec + 8));
+    const __m256 s3 = _mm256_load_ps((float*)(step_vec + 12));
+    const __m256 s0l = _mm256_moveldup_ps(s0), s0h = _mm256_movehdup_ps(s0);
+    const __m256 s1l = _mm256_moveldup_ps(s1), s1h = _mm256_movehdup_ps(s1);
+    const __m256 s2l = _mm256_moveldup_ps(s2), s2h = _mm256_movehdup_ps(s2);
+    const __m256 s3l = _mm256_moveldup_ps(s3), s3h = _mm256_movehdup_ps(s3);
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = step_rate;
+        }
+    const __m256 ds = _mm256_load_ps((float*)phase_vec);
+    const __m256 dsl = _mm256_moveldup_ps(ds);
+    const __m256 dsh = _mm256_movehdup_ps(ds);
+    __m256 q = _mm256_setr_ps(1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f);
+    __m256 ql, qh;
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+            a2Val = _mm256_loadu_ps(aPtr + 16);
+            a3Val = _mm256_loadu_ps(aPtr + 24);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm256_moveldup_ps(z0);
+            yh = _mm256_movehdup_ps(z0);
+            a0Val = _mm256_fmaddsub_ps(a0Val, yl, _mm256_mul_ps(_mm256_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z1);
+            yh = _mm256_movehdup_ps(z1);
+            a1Val = _mm256_fmaddsub_ps(a1Val, yl, _mm256_mul_ps(_mm256_permute_ps(a1Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z2);
+            yh = _mm256_movehdup_ps(z2);
+            a2Val = _mm256_fmaddsub_ps(a2Val, yl, _mm256_mul_ps(_mm256_permute_ps(a2Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z3);
+            yh = _mm256_movehdup_ps(z3);
+            a3Val = _mm256_fmaddsub_ps(a3Val, yl, _mm256_mul_ps(_mm256_permute_ps(a3Val, 0xB1), yh));
+
+            z0 = _mm256_fmaddsub_ps(z0, s0l, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), s0h));
+            z1 = _mm256_fmaddsub_ps(z1, s1l, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), s1h));
+            z2 = _mm256_fmaddsub_ps(z2, s2l, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), s2h));
+            z3 = _mm256_fmaddsub_ps(z3, s3l, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), s3h));
+            ql = _mm256_moveldup_ps(q);
+            qh = _mm256_movehdup_ps(q);
+            z0 = _mm256_fmaddsub_ps(z0, ql, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), qh));
+            z1 = _mm256_fmaddsub_ps(z1, ql, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), qh));
+            z2 = _mm256_fmaddsub_ps(z2, ql, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), qh));
+            z3 = _mm256_fmaddsub_ps(z3, ql, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), qh));
+
+            q = _mm256_fmaddsub_ps(q, dsl, _mm256_mul_ps(_mm256_permute_ps(q, 0xB1), dsh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                    z2 = _mm256_complexnormalise_ps(z2);
+                    z3 = _mm256_complexnormalise_ps(z3);
+                    q = _mm256_complexnormalise_ps(q);
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal2[vec_ind] = _mm256_add_ps(dotProdVal2[vec_ind], dotProdVal3[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = sixteenthPoints * 16;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_a_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val, x0Val, x1Val, yl, yh;
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[16];
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t step_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^16 * phase_inc_rate^(16 k + 120), which is fixed, times
+    // phase_inc_rate^(16 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^16
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^16
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^256
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^120
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m256 z0 = _mm256_load_ps((float*)phase_vec);
+    __m256 z1 = _mm256_load_ps((float*)(phase_vec + 4));
+    __m256 z2 = _mm256_load_ps((float*)(phase_vec + 8));
+    __m256 z3 = _mm256_load_ps((float*)(phase_vec + 12));
+    const __m256 s0 = _mm256_load_ps((float*)step_vec);
+    const __m256 s1 = _mm256_load_ps((float*)(step_vec + 4));
+    const __m256 s2 = _mm256_load_ps((float*)(step_vec + 8));
+    const __m256 s3 = _mm256_load_ps((float*)(step_vec + 12));
+    const __m256 s0l = _mm256_moveldup_ps(s0), s0h = _mm256_movehdup_ps(s0);
+    const __m256 s1l = _mm256_moveldup_ps(s1), s1h = _mm256_movehdup_ps(s1);
+    const __m256 s2l = _mm256_moveldup_ps(s2), s2h = _mm256_movehdup_ps(s2);
+    const __m256 s3l = _mm256_moveldup_ps(s3), s3h = _mm256_movehdup_ps(s3);
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = step_rate;
+        }
+    const __m256 ds = _mm256_load_ps((float*)phase_vec);
+    const __m256 dsl = _mm256_moveldup_ps(ds);
+    const __m256 dsh = _mm256_movehdup_ps(ds);
+    __m256 q = _mm256_setr_ps(1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f);
+    __m256 ql, qh;
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm256_load_ps(aPtr);
+            a1Val = _mm256_load_ps(aPtr + 8);
+            a2Val = _mm256_load_ps(aPtr + 16);
+            a3Val = _mm256_load_ps(aPtr + 24);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm256_moveldup_ps(z0);
+            yh = _mm256_movehdup_ps(z0);
+            a0Val = _mm256_fmaddsub_ps(a0Val, yl, _mm256_mul_ps(_mm256_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z1);
+            yh = _mm256_movehdup_ps(z1);
+            a1Val = _mm256_fmaddsub_ps(a1Val, yl, _mm256_mul_ps(_mm256_permute_ps(a1Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z2);
+            yh = _mm256_movehdup_ps(z2);
+            a2Val = _mm256_fmaddsub_ps(a2Val, yl, _mm256_mul_ps(_mm256_permute_ps(a2Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z3);
+            yh = _mm256_movehdup_ps(z3);
+            a3Val = _mm256_fmaddsub_ps(a3Val, yl, _mm256_mul_ps(_mm256_permute_ps(a3Val, 0xB1), yh));
+
+            z0 = _mm256_fmaddsub_ps(z0, s0l, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), s0h));
+            z1 = _mm256_fmaddsub_ps(z1, s1l, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), s1h));
+            z2 = _mm256_fmaddsub_ps(z2, s2l, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), s2h));
+            z3 = _mm256_fmaddsub_ps(z3, s3l, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), s3h));
+            ql = _mm256_moveldup_ps(q);
+            qh = _mm256_movehdup_ps(q);
+            z0 = _mm256_fmaddsub_ps(z0, ql, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), qh));
+            z1 = _mm256_fmaddsub_ps(z1, ql, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), qh));
+            z2 = _mm256_fmaddsub_ps(z2, ql, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), qh));
+            z3 = _mm256_fmaddsub_ps(z3, ql, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), qh));
+
+            q = _mm256_fmaddsub_ps(q, dsl, _mm256_mul_ps(_mm256_permute_ps(q, 0xB1), dsh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                    z2 = _mm256_complexnormalise_ps(z2);
+                    z3 = _mm256_complexnormalise_ps(z3);
+                    q = _mm256_complexnormalise_ps(q);
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal2[vec_ind] = _mm256_add_ps(dotProdVal2[vec_ind], dotProdVal3[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = sixteenthPoints * 16;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, xVal, yl, yh, tmp;
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^16 * phase_inc_rate^(16 k + 120), which is fixed, times
+    // phase_inc_rate^(16 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^16
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^16
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^256
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^120
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m512 z0 = _mm512_load_ps((float*)phase_vec);
+    __m512 z1 = _mm512_load_ps((float*)(phase_vec + 8));
+    const __m512 s0 = _mm512_load_ps((float*)step_vec);
+    const __m512 s1 = _mm512_load_ps((float*)(step_vec + 8));
+    const __m512 s0l = _mm512_moveldup_ps(s0), s0h = _mm512_movehdup_ps(s0);
+    const __m512 s1l = _mm512_moveldup_ps(s1), s1h = _mm512_movehdup_ps(s1);
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = step_rate;
+        }
+    const __m512 ds = _mm512_load_ps((float*)phase_vec);
+    const __m512 dsl = _mm512_moveldup_ps(ds);
+    const __m512 dsh = _mm512_movehdup_ps(ds);
+    __m512 q = _mm512_setr_ps(1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f);
+    __m512 ql, qh;
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_loadu_ps(aPtr);
+            a1Val = _mm512_loadu_ps(aPtr + 16);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm512_moveldup_ps(z0);
+            yh = _mm512_movehdup_ps(z0);
+            a0Val = _mm512_fmaddsub_ps(a0Val, yl, _mm512_mul_ps(_mm512_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm512_moveldup_ps(z1);
+            yh = _mm512_movehdup_ps(z1);
+            a1Val = _mm512_fmaddsub_ps(a1Val, yl, _mm512_mul_ps(_mm512_permute_ps(a1Val, 0xB1), yh));
+
+            z0 = _mm512_fmaddsub_ps(z0, s0l, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), s0h));
+            z1 = _mm512_fmaddsub_ps(z1, s1l, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), s1h));
+            ql = _mm512_moveldup_ps(q);
+            qh = _mm512_movehdup_ps(q);
+            z0 = _mm512_fmaddsub_ps(z0, ql, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), qh));
+            z1 = _mm512_fmaddsub_ps(z1, ql, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), qh));
+
+            q = _mm512_fmaddsub_ps(q, dsl, _mm512_mul_ps(_mm512_permute_ps(q, 0xB1), dsh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, xVal), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, xVal), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp = _mm512_mul_ps(z0, z0);
+                    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(z1, z1);
+                    z1 = _mm512_div_ps(z1, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(q, q);
+                    q = _mm512_div_ps(q, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp = _mm512_mul_ps(z0, z0);
+    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = sixteenthPoints * 16;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, xVal, yl, yh, tmp;
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t step_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // From the block starting at sample m to the next one, lane k advances by
+    // constant_rotation^16 * phase_inc_rate^(16 k + 120), which is fixed, times
+    // phase_inc_rate^(16 m), which is common to all the lanes. Keeping the part that
+    // changes apart makes its rounding errors as small as its angle.
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^16
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^16
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^256
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^120
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            step_vec[vec_ind] = block_rotation * lane_step;
+            lane_step *= lane_rate;
+        }
+
+    __m512 z0 = _mm512_load_ps((float*)phase_vec);
+    __m512 z1 = _mm512_load_ps((float*)(phase_vec + 8));
+    const __m512 s0 = _mm512_load_ps((float*)step_vec);
+    const __m512 s1 = _mm512_load_ps((float*)(step_vec + 8));
+    const __m512 s0l = _mm512_moveldup_ps(s0), s0h = _mm512_movehdup_ps(s0);
+    const __m512 s1l = _mm512_moveldup_ps(s1), s1h = _mm512_movehdup_ps(s1);
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = step_rate;
+        }
+    const __m512 ds = _mm512_load_ps((float*)phase_vec);
+    const __m512 dsl = _mm512_moveldup_ps(ds);
+    const __m512 dsh = _mm512_movehdup_ps(ds);
+    __m512 q = _mm512_setr_ps(1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f);
+    __m512 ql, qh;
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_load_ps(aPtr);
+            a1Val = _mm512_load_ps(aPtr + 16);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm512_moveldup_ps(z0);
+            yh = _mm512_movehdup_ps(z0);
+            a0Val = _mm512_fmaddsub_ps(a0Val, yl, _mm512_mul_ps(_mm512_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm512_moveldup_ps(z1);
+            yh = _mm512_movehdup_ps(z1);
+            a1Val = _mm512_fmaddsub_ps(a1Val, yl, _mm512_mul_ps(_mm512_permute_ps(a1Val, 0xB1), yh));
+
+            z0 = _mm512_fmaddsub_ps(z0, s0l, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), s0h));
+            z1 = _mm512_fmaddsub_ps(z1, s1l, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), s1h));
+            ql = _mm512_moveldup_ps(q);
+            qh = _mm512_movehdup_ps(q);
+            z0 = _mm512_fmaddsub_ps(z0, ql, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), qh));
+            z1 = _mm512_fmaddsub_ps(z1, ql, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), qh));
+
+            q = _mm512_fmaddsub_ps(q, dsl, _mm512_mul_ps(_mm512_permute_ps(q, 0xB1), dsh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, xVal), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, xVal), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators and the common step back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp = _mm512_mul_ps(z0, z0);
+                    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(z1, z1);
+                    z1 = _mm512_div_ps(z1, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(q, q);
+                    q = _mm512_div_ps(q, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp = _mm512_mul_ps(z0, z0);
+    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = sixteenthPoints * 16;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_NEONV7
+#include <arm_neon.h>
+static inline void volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_neon(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, const lv_32fc_t phase_inc_rate, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    float32x4x2_t a_val;
+    float32x4_t b_val, x_real, x_imag, tmp, mag, inv;
+    float32x4x2_t dotProdVal[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal[vec_ind].val[0] = vdupq_n_f32(0.0f);
+            dotProdVal[vec_ind].val[1] = vdupq_n_f32(0.0f);
+        }
+
+    // Phases of the first block, following the recurrence of the generic version
+#ifdef __cplusplus
+    lv_32fc_t half_phase_inc_rate = std::sqrt(phase_inc_rate);
+#else
+    lv_32fc_t half_phase_inc_rate = csqrtf(phase_inc_rate);
+#endif
+    lv_32fc_t constant_rotation = phase_inc * half_phase_inc_rate;
+    lv_32fc_t delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    __VOLK_ATTR_ALIGNED(16)
+    float32_t phase_real[4];
+    __VOLK_ATTR_ALIGNED(16)
+    float32_t phase_imag[4];
+    __VOLK_ATTR_ALIGNED(16)
+    float32_t step_real[4];
+    __VOLK_ATTR_ALIGNED(16)
+    float32_t step_imag[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_real[vec_ind] = lv_creal(_phase);
+            phase_imag[vec_ind] = lv_cimag(_phase);
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+        }
+
+    // Same lane steps as the SSE3 version: lane k advances by the fixed
+    // constant_rotation^4 * phase_inc_rate^(4 k + 6) and by the common
+    // phase_inc_rate^(4 m) from the block starting at sample m to the next one
+    lv_32fc_t block_rotation = constant_rotation;
+    lv_32fc_t lane_rate = phase_inc_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            block_rotation *= block_rotation;  // block_rotation = constant_rotation^4
+            lane_rate *= lane_rate;            // lane_rate = phase_inc_rate^4
+        }
+    lv_32fc_t step_rate = lane_rate;
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            step_rate *= step_rate;  // step_rate = phase_inc_rate^16
+        }
+#ifdef __cplusplus
+    block_rotation /= std::abs(block_rotation);
+    step_rate /= std::abs(step_rate);
+#else
+    block_rotation /= hypotf(lv_creal(block_rotation), lv_cimag(block_rotation));
+    step_rate /= hypotf(lv_creal(step_rate), lv_cimag(step_rate));
+#endif
+    lv_32fc_t lane_step = lv_cmake(1.0f, 0.0f);
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            lane_step *= delta_phase_rate;  // lane_step = phase_inc_rate^6
+            delta_phase_rate *= phase_inc_rate;
+        }
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            step_real[vec_ind] = lv_creal(block_rotation * lane_step);
+            step_imag[vec_ind] = lv_cimag(block_rotation * lane_step);
+            lane_step *= lane_rate;
+        }
+
+    float32x4_t z_real = vld1q_f32(phase_real);
+    float32x4_t z_imag = vld1q_f32(phase_imag);
+    const float32x4_t s_real = vld1q_f32(step_real);
+    const float32x4_t s_imag = vld1q_f32(step_imag);
+    const float32_t ds_real = lv_creal(step_rate);
+    const float32_t ds_imag = lv_cimag(step_rate);
+    float32x4_t q_real = vdupq_n_f32(1.0f);
+    float32x4_t q_imag = vdupq_n_f32(0.0f);
+
+    for (; number < quarterPoints; number++)
+        {
+            a_val = vld2q_f32(aPtr);  // real and imaginary parts of four samples
+            __VOLK_GNSSSDR_PREFETCH(aPtr + 16);
+
+            x_real = vmlsq_f32(vmulq_f32(a_val.val[0], z_real), a_val.val[1], z_imag);
+            x_imag = vmlaq_f32(vmulq_f32(a_val.val[0], z_imag), a_val.val[1], z_real);
+
+            tmp = vmlsq_f32(vmulq_f32(z_real, s_real), z_imag, s_imag);
+            z_imag = vmlaq_f32(vmulq_f32(z_real, s_imag), z_imag, s_real);
+            z_real = vmlsq_f32(vmulq_f32(tmp, q_real), z_imag, q_imag);
+            z_imag = vmlaq_f32(vmulq_f32(tmp, q_imag), z_imag, q_real);
+            tmp = vmlsq_n_f32(vmulq_n_f32(q_real, ds_real), q_imag, ds_imag);
+            q_imag = vmlaq_n_f32(vmulq_n_f32(q_real, ds_imag), q_imag, ds_real);
+            q_real = tmp;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    b_val = vld1q_f32(bPtr[vec_ind]);  // t0|t1|t2|t3
+
+                    dotProdVal[vec_ind].val[0] = vmlaq_f32(dotProdVal[vec_ind].val[0], x_real, b_val);
+                    dotProdVal[vec_ind].val[1] = vmlaq_f32(dotProdVal[vec_ind].val[1], x_imag, b_val);
+
+                    bPtr[vec_ind] += 4;
+                }
+
+            // Force the rotators and the common step back onto the unit circle.
+            // There is no vector division in ARMv7 NEON: the reciprocal square
+            // root estimate is refined with two Newton-Raphson steps.
+            if ((number % 64) == 0)
+                {
+                    mag = vmlaq_f32(vmulq_f32(z_real, z_real), z_imag, z_imag);
+                    inv = vrsqrteq_f32(mag);
+                    inv = vmulq_f32(inv, vrsqrtsq_f32(vmulq_f32(mag, inv), inv));
+                    inv = vmulq_f32(inv, vrsqrtsq_f32(vmulq_f32(mag, inv), inv));
+                    z_real = vmulq_f32(z_real, inv);
+                    z_imag = vmulq_f32(z_imag, inv);
+                    mag = vmlaq_f32(vmulq_f32(q_real, q_real), q_imag, q_imag);
+                    inv = vrsqrteq_f32(mag);
+                    inv = vmulq_f32(inv, vrsqrtsq_f32(vmulq_f32(mag, inv), inv));
+                    inv = vmulq_f32(inv, vrsqrtsq_f32(vmulq_f32(mag, inv), inv));
+                    q_real = vmulq_f32(q_real, inv);
+                    q_imag = vmulq_f32(q_imag, inv);
+                }
+
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            vst2q_f32((float32_t*)dotProductVector, dotProdVal[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    vst1q_f32(phase_real, z_real);
+    vst1q_f32(phase_imag, z_imag);
+    _phase = lv_cmake(phase_real[0], phase_imag[0]);
+#ifdef __cplusplus
+    _phase /= std::abs(_phase);
+#else
+    _phase /= hypotf(lv_creal(_phase), lv_cimag(_phase));
+#endif
+
+    // Phase rate at the first remaining sample: phase_inc_rate^number
+    number = quarterPoints * 4;
+    delta_phase_rate = lv_cmake(1.0f, 0.0f);
+    lv_32fc_t rate_power = phase_inc_rate;
+    for (i = number; i > 0; i >>= 1)
+        {
+            if (i & 1)
+                {
+                    delta_phase_rate *= rate_power;
+                }
+            rate_power *= rate_power;
+        }
+#ifdef __cplusplus
+    delta_phase_rate /= std::abs(delta_phase_rate);
+#else
+    delta_phase_rate /= hypotf(lv_creal(delta_phase_rate), lv_cimag(delta_phase_rate));
+#endif
+
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= (constant_rotation * delta_phase_rate);
+            delta_phase_rate *= phase_inc_rate;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_NEONV7 */
+
 #endif /* INCLUDED_volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_H */
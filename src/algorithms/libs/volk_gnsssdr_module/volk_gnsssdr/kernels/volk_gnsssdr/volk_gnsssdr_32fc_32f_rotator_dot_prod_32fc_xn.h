@@ -313,7 +313,7 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
     number = sixteenthPoints * 16;
     for (; number < num_points; number++)
         {
-            wo = (*aPtr++) * _phase;
+            wo = in_common[number] * _phase;
             _phase *= phase_inc;
 
             for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
@@ -477,7 +477,7 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
     number = sixteenthPoints * 16;
     for (; number < num_points; number++)
         {
-            wo = (*aPtr++) * _phase;
+            wo = in_common[number] * _phase;
             _phase *= phase_inc;
 
             for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
@@ -492,4 +492,869 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
 
 #endif /* LV_HAVE_AVX */
 
+
+#ifdef LV_HAVE_SSE3
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <pmmintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_sse3(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m128 a0Val, a1Val, xVal, b0Val, b1Val, tmp1, tmp2;
+    __m128 dotProdVal0[num_a_vectors];
+    __m128 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm_setzero_ps();
+            dotProdVal1[vec_ind] = _mm_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m128 z0, z1;
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm_load_ps((float*)phase_vec);
+    z1 = _mm_load_ps((float*)(phase_vec + 2));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^4;
+
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m128 dz_reg = _mm_load_ps((float*)phase_vec);
+
+    for (; number < quarterPoints; number++)
+        {
+            a0Val = _mm_loadu_ps(aPtr);
+            a1Val = _mm_loadu_ps(aPtr + 4);
+
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+
+            z0 = _mm_complexmul_ps(z0, dz_reg);
+            z1 = _mm_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3
+                    b0Val = _mm_unpacklo_ps(xVal, xVal);  // t0|t0|t1|t1
+                    b1Val = _mm_unpackhi_ps(xVal, xVal);  // t2|t2|t3|t3
+
+                    dotProdVal0[vec_ind] = _mm_add_ps(_mm_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm_add_ps(_mm_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+
+                    bPtr[vec_ind] += 4;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                }
+
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[2];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 2; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+
+#ifdef LV_HAVE_SSE3
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <pmmintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_sse3(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m128 a0Val, a1Val, xVal, b0Val, b1Val, tmp1, tmp2;
+    __m128 dotProdVal0[num_a_vectors];
+    __m128 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm_setzero_ps();
+            dotProdVal1[vec_ind] = _mm_setzero_ps();
+        }
+
+    // Set up the complex rotator
+    __m128 z0, z1;
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm_load_ps((float*)phase_vec);
+    z1 = _mm_load_ps((float*)(phase_vec + 2));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^4;
+
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m128 dz_reg = _mm_load_ps((float*)phase_vec);
+
+    for (; number < quarterPoints; number++)
+        {
+            a0Val = _mm_load_ps(aPtr);
+            a1Val = _mm_load_ps(aPtr + 4);
+
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+
+            z0 = _mm_complexmul_ps(z0, dz_reg);
+            z1 = _mm_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3
+                    b0Val = _mm_unpacklo_ps(xVal, xVal);  // t0|t0|t1|t1
+                    b1Val = _mm_unpackhi_ps(xVal, xVal);  // t2|t2|t3|t3
+
+                    dotProdVal0[vec_ind] = _mm_add_ps(_mm_mul_ps(a0Val, b0Val), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm_add_ps(_mm_mul_ps(a1Val, b1Val), dotProdVal1[vec_ind]);
+
+                    bPtr[vec_ind] += 4;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp1 = _mm_mul_ps(z0, z0);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+                    tmp1 = _mm_mul_ps(z1, z1);
+                    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+                    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+                    z1 = _mm_div_ps(z1, _mm_sqrt_ps(tmp1));
+                }
+
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[2];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 2; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp1 = _mm_mul_ps(z0, z0);
+    tmp2 = _mm_hadd_ps(tmp1, tmp1);
+    tmp1 = _mm_shuffle_ps(tmp2, tmp2, 0xD8);
+    z0 = _mm_div_ps(z0, _mm_sqrt_ps(tmp1));
+    _mm_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+
+    for (number = quarterPoints * 4; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val, x0Val, x1Val, yl, yh;
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Set up the complex rotator
+    __m256 z0, z1, z2, z3;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+    z2 = _mm256_load_ps((float*)(phase_vec + 8));
+    z3 = _mm256_load_ps((float*)(phase_vec + 12));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+    const __m256 dzl = _mm256_moveldup_ps(dz_reg);
+    const __m256 dzh = _mm256_movehdup_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+            a2Val = _mm256_loadu_ps(aPtr + 16);
+            a3Val = _mm256_loadu_ps(aPtr + 24);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm256_moveldup_ps(z0);
+            yh = _mm256_movehdup_ps(z0);
+            a0Val = _mm256_fmaddsub_ps(a0Val, yl, _mm256_mul_ps(_mm256_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z1);
+            yh = _mm256_movehdup_ps(z1);
+            a1Val = _mm256_fmaddsub_ps(a1Val, yl, _mm256_mul_ps(_mm256_permute_ps(a1Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z2);
+            yh = _mm256_movehdup_ps(z2);
+            a2Val = _mm256_fmaddsub_ps(a2Val, yl, _mm256_mul_ps(_mm256_permute_ps(a2Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z3);
+            yh = _mm256_movehdup_ps(z3);
+            a3Val = _mm256_fmaddsub_ps(a3Val, yl, _mm256_mul_ps(_mm256_permute_ps(a3Val, 0xB1), yh));
+
+            z0 = _mm256_fmaddsub_ps(z0, dzl, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), dzh));
+            z1 = _mm256_fmaddsub_ps(z1, dzl, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), dzh));
+            z2 = _mm256_fmaddsub_ps(z2, dzl, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), dzh));
+            z3 = _mm256_fmaddsub_ps(z3, dzl, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), dzh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                    z2 = _mm256_complexnormalise_ps(z2);
+                    z3 = _mm256_complexnormalise_ps(z3);
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal2[vec_ind] = _mm256_add_ps(dotProdVal2[vec_ind], dotProdVal3[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    for (number = sixteenthPoints * 16; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx2(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val, x0Val, x1Val, yl, yh;
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Set up the complex rotator
+    __m256 z0, z1, z2, z3;
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm256_load_ps((float*)phase_vec);
+    z1 = _mm256_load_ps((float*)(phase_vec + 4));
+    z2 = _mm256_load_ps((float*)(phase_vec + 8));
+    z3 = _mm256_load_ps((float*)(phase_vec + 12));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+    const __m256 dzl = _mm256_moveldup_ps(dz_reg);
+    const __m256 dzh = _mm256_movehdup_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm256_load_ps(aPtr);
+            a1Val = _mm256_load_ps(aPtr + 8);
+            a2Val = _mm256_load_ps(aPtr + 16);
+            a3Val = _mm256_load_ps(aPtr + 24);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm256_moveldup_ps(z0);
+            yh = _mm256_movehdup_ps(z0);
+            a0Val = _mm256_fmaddsub_ps(a0Val, yl, _mm256_mul_ps(_mm256_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z1);
+            yh = _mm256_movehdup_ps(z1);
+            a1Val = _mm256_fmaddsub_ps(a1Val, yl, _mm256_mul_ps(_mm256_permute_ps(a1Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z2);
+            yh = _mm256_movehdup_ps(z2);
+            a2Val = _mm256_fmaddsub_ps(a2Val, yl, _mm256_mul_ps(_mm256_permute_ps(a2Val, 0xB1), yh));
+            yl = _mm256_moveldup_ps(z3);
+            yh = _mm256_movehdup_ps(z3);
+            a3Val = _mm256_fmaddsub_ps(a3Val, yl, _mm256_mul_ps(_mm256_permute_ps(a3Val, 0xB1), yh));
+
+            z0 = _mm256_fmaddsub_ps(z0, dzl, _mm256_mul_ps(_mm256_permute_ps(z0, 0xB1), dzh));
+            z1 = _mm256_fmaddsub_ps(z1, dzl, _mm256_mul_ps(_mm256_permute_ps(z1, 0xB1), dzh));
+            z2 = _mm256_fmaddsub_ps(z2, dzl, _mm256_mul_ps(_mm256_permute_ps(z2, 0xB1), dzh));
+            z3 = _mm256_fmaddsub_ps(z3, dzl, _mm256_mul_ps(_mm256_permute_ps(z3, 0xB1), dzh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    z0 = _mm256_complexnormalise_ps(z0);
+                    z1 = _mm256_complexnormalise_ps(z1);
+                    z2 = _mm256_complexnormalise_ps(z2);
+                    z3 = _mm256_complexnormalise_ps(z3);
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal2[vec_ind] = _mm256_add_ps(dotProdVal2[vec_ind], dotProdVal3[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    z0 = _mm256_complexnormalise_ps(z0);
+    _mm256_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    for (number = sixteenthPoints * 16; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, xVal, yl, yh, tmp;
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Set up the complex rotator
+    __m512 z0, z1;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm512_load_ps((float*)phase_vec);
+    z1 = _mm512_load_ps((float*)(phase_vec + 8));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+    tmp = _mm512_mul_ps(dz_reg, dz_reg);
+    dz_reg = _mm512_div_ps(dz_reg, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    const __m512 dzl = _mm512_moveldup_ps(dz_reg);
+    const __m512 dzh = _mm512_movehdup_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_loadu_ps(aPtr);
+            a1Val = _mm512_loadu_ps(aPtr + 16);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm512_moveldup_ps(z0);
+            yh = _mm512_movehdup_ps(z0);
+            a0Val = _mm512_fmaddsub_ps(a0Val, yl, _mm512_mul_ps(_mm512_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm512_moveldup_ps(z1);
+            yh = _mm512_movehdup_ps(z1);
+            a1Val = _mm512_fmaddsub_ps(a1Val, yl, _mm512_mul_ps(_mm512_permute_ps(a1Val, 0xB1), yh));
+
+            z0 = _mm512_fmaddsub_ps(z0, dzl, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), dzh));
+            z1 = _mm512_fmaddsub_ps(z1, dzl, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), dzh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, xVal), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, xVal), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp = _mm512_mul_ps(z0, z0);
+                    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(z1, z1);
+                    z1 = _mm512_div_ps(z1, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp = _mm512_mul_ps(z0, z0);
+    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    for (number = sixteenthPoints * 16; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t _phase = (*phase);
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, xVal, yl, yh, tmp;
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicate each code sample into the real and imaginary slots of a complex
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Set up the complex rotator
+    __m512 z0, z1;
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            phase_vec[vec_ind] = _phase;
+            _phase *= phase_inc;
+        }
+
+    z0 = _mm512_load_ps((float*)phase_vec);
+    z1 = _mm512_load_ps((float*)(phase_vec + 8));
+
+    lv_32fc_t dz = phase_inc;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;
+    dz *= dz;  // dz = phase_inc^16;
+
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+
+    __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+    tmp = _mm512_mul_ps(dz_reg, dz_reg);
+    dz_reg = _mm512_div_ps(dz_reg, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    const __m512 dzl = _mm512_moveldup_ps(dz_reg);
+    const __m512 dzh = _mm512_movehdup_ps(dz_reg);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            a0Val = _mm512_load_ps(aPtr);
+            a1Val = _mm512_load_ps(aPtr + 16);
+
+            // Complex products x * z = fmaddsub(x, re(z), swap(x) * im(z))
+            yl = _mm512_moveldup_ps(z0);
+            yh = _mm512_movehdup_ps(z0);
+            a0Val = _mm512_fmaddsub_ps(a0Val, yl, _mm512_mul_ps(_mm512_permute_ps(a0Val, 0xB1), yh));
+            yl = _mm512_moveldup_ps(z1);
+            yh = _mm512_movehdup_ps(z1);
+            a1Val = _mm512_fmaddsub_ps(a1Val, yl, _mm512_mul_ps(_mm512_permute_ps(a1Val, 0xB1), yh));
+
+            z0 = _mm512_fmaddsub_ps(z0, dzl, _mm512_mul_ps(_mm512_permute_ps(z0, 0xB1), dzh));
+            z1 = _mm512_fmaddsub_ps(z1, dzl, _mm512_mul_ps(_mm512_permute_ps(z1, 0xB1), dzh));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    xVal = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, xVal), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, xVal), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            // Force the rotators back onto the unit circle
+            if ((number % 64) == 0)
+                {
+                    tmp = _mm512_mul_ps(z0, z0);
+                    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                    tmp = _mm512_mul_ps(z1, z1);
+                    z1 = _mm512_div_ps(z1, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    tmp = _mm512_mul_ps(z0, z0);
+    z0 = _mm512_div_ps(z0, _mm512_sqrt_ps(_mm512_add_ps(tmp, _mm512_permute_ps(tmp, 0xB1))));
+    _mm512_store_ps((float*)phase_vec, z0);
+    _phase = phase_vec[0];
+    _mm256_zeroupper();
+
+    for (number = sixteenthPoints * 16; number < num_points; number++)
+        {
+            wo = in_common[number] * _phase;
+            _phase *= phase_inc;
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F */
+
 #endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_H */
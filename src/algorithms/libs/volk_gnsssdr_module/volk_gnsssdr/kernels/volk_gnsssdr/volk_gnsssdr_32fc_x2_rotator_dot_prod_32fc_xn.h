@@ -647,6 +647,248 @@ static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t
 #endif /* LV_HAVE_AVX */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx512_iters = num_points / 8;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    // Two accumulators per vector: in_a times the real part of the rotated
+    // reference, and swapped in_a times its imaginary part. They are combined
+    // into the complex products only once, after the loop.
+    __m512* acc_l = (__m512*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m512), 64);
+    __m512* acc_h = (__m512*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m512), 64);
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc_l[n_vec] = _mm512_setzero_ps();
+            acc_h[n_vec] = _mm512_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m512 a, eight_phase_acc_reg, yl, yh, z;
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_inc[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = _phase;
+            _phase *= phase_inc;
+        }
+    lv_32fc_t phase_inc8 = phase_inc * phase_inc;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_inc[i] = phase_inc8;
+        }
+    const __m512 eight_phase_inc_reg = _mm512_load_ps((float*)eight_phase_inc);
+    eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    const __m512 ylp = _mm512_moveldup_ps(eight_phase_inc_reg);
+    const __m512 yhp = _mm512_movehdup_ps(eight_phase_inc_reg);
+    const __m512 ones = _mm512_set1_ps(1.0f);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm512_loadu_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+            yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+            z = _mm512_fmaddsub_ps(a, yl, _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh));
+            eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp));
+
+            yl = _mm512_moveldup_ps(z);
+            yh = _mm512_movehdup_ps(z);
+
+            _in_common += 8;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm512_loadu_ps((float*)&(_in_a[n_vec][number * 8]));
+                    acc_l[n_vec] = _mm512_fmadd_ps(a, yl, acc_l[n_vec]);
+                    acc_h[n_vec] = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc_h[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 128) == 0)
+                {
+                    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            z = _mm512_fmaddsub_ps(acc_l[n_vec], ones, acc_h[n_vec]);
+            _mm512_store_ps((float*)dotProductVector, z);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+    volk_gnsssdr_free(acc_l);
+    volk_gnsssdr_free(acc_h);
+
+    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+
+    _mm512_store_ps((float*)eight_phase_acc, eight_phase_acc_reg);
+    _phase = eight_phase_acc[0];
+    _mm256_zeroupper();
+
+    for (n = avx512_iters * 8; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx512_iters = num_points / 8;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    // Two accumulators per vector: in_a times the real part of the rotated
+    // reference, and swapped in_a times its imaginary part. They are combined
+    // into the complex products only once, after the loop.
+    __m512* acc_l = (__m512*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m512), 64);
+    __m512* acc_h = (__m512*)volk_gnsssdr_malloc(num_a_vectors * sizeof(__m512), 64);
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc_l[n_vec] = _mm512_setzero_ps();
+            acc_h[n_vec] = _mm512_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m512 a, eight_phase_acc_reg, yl, yh, z;
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_inc[8];
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = _phase;
+            _phase *= phase_inc;
+        }
+    lv_32fc_t phase_inc8 = phase_inc * phase_inc;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_inc[i] = phase_inc8;
+        }
+    const __m512 eight_phase_inc_reg = _mm512_load_ps((float*)eight_phase_inc);
+    eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    const __m512 ylp = _mm512_moveldup_ps(eight_phase_inc_reg);
+    const __m512 yhp = _mm512_movehdup_ps(eight_phase_inc_reg);
+    const __m512 ones = _mm512_set1_ps(1.0f);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm512_load_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            yl = _mm512_moveldup_ps(eight_phase_acc_reg);
+            yh = _mm512_movehdup_ps(eight_phase_acc_reg);
+            z = _mm512_fmaddsub_ps(a, yl, _mm512_mul_ps(_mm512_permute_ps(a, 0xB1), yh));
+            eight_phase_acc_reg = _mm512_fmaddsub_ps(eight_phase_acc_reg, ylp, _mm512_mul_ps(_mm512_permute_ps(eight_phase_acc_reg, 0xB1), yhp));
+
+            yl = _mm512_moveldup_ps(z);
+            yh = _mm512_movehdup_ps(z);
+
+            _in_common += 8;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm512_load_ps((float*)&(_in_a[n_vec][number * 8]));
+                    acc_l[n_vec] = _mm512_fmadd_ps(a, yl, acc_l[n_vec]);
+                    acc_h[n_vec] = _mm512_fmadd_ps(_mm512_permute_ps(a, 0xB1), yh, acc_h[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 128) == 0)
+                {
+                    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            z = _mm512_fmaddsub_ps(acc_l[n_vec], ones, acc_h[n_vec]);
+            _mm512_store_ps((float*)dotProductVector, z);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+    volk_gnsssdr_free(acc_l);
+    volk_gnsssdr_free(acc_h);
+
+    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+
+    _mm512_store_ps((float*)eight_phase_acc, eight_phase_acc_reg);
+    _phase = eight_phase_acc[0];
+    _mm256_zeroupper();
+
+    for (n = avx512_iters * 8; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_NEONV7
 #include <arm_neon.h>
 
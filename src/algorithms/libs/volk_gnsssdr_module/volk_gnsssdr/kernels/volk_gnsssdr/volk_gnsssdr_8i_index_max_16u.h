@@ -59,6 +59,132 @@
 #include <volk_gnsssdr/volk_gnsssdr_common.h>
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8i_index_max_16u_a_avx512bw(unsigned int* target, const char* src0, unsigned int num_points)
+{
+    if (num_points > 0)
+        {
+            const unsigned int avx512_iters = num_points / 64;
+            unsigned int number;
+            unsigned int i;
+            char* basePtr = (char*)src0;
+            char* inputPtr = (char*)src0;
+            char max = src0[0];
+            unsigned int index = 0;
+            __mmask64 mask;
+            __VOLK_ATTR_ALIGNED(64)
+            char currentValuesBuffer[64];
+            __m512i maxValues, currentValues;
+
+            maxValues = _mm512_set1_epi8(max);
+
+            for (number = 0; number < avx512_iters; number++)
+                {
+                    currentValues = _mm512_load_si512((__m512i*)inputPtr);
+                    mask = _mm512_cmpgt_epi8_mask(currentValues, maxValues);
+
+                    if (mask != 0)
+                        {
+                            _mm512_store_si512((__m512i*)&currentValuesBuffer, currentValues);
+                            i = 0;
+                            while (mask > 0)
+                                {
+                                    if ((mask & 1) == 1)
+                                        {
+                                            if (currentValuesBuffer[i] > max)
+                                                {
+                                                    index = inputPtr - basePtr + i;
+                                                    max = currentValuesBuffer[i];
+                                                }
+                                        }
+                                    i++;
+                                    mask >>= 1;
+                                }
+                            maxValues = _mm512_set1_epi8(max);
+                        }
+                    inputPtr += 64;
+                }
+
+            for (i = avx512_iters * 64; i < num_points; ++i)
+                {
+                    if (src0[i] > max)
+                        {
+                            index = i;
+                            max = src0[i];
+                        }
+                }
+            target[0] = index;
+        }
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8i_index_max_16u_u_avx512bw(unsigned int* target, const char* src0, unsigned int num_points)
+{
+    if (num_points > 0)
+        {
+            const unsigned int avx512_iters = num_points / 64;
+            unsigned int number;
+            unsigned int i;
+            char* basePtr = (char*)src0;
+            char* inputPtr = (char*)src0;
+            char max = src0[0];
+            unsigned int index = 0;
+            __mmask64 mask;
+            __VOLK_ATTR_ALIGNED(64)
+            char currentValuesBuffer[64];
+            __m512i maxValues, currentValues;
+
+            maxValues = _mm512_set1_epi8(max);
+
+            for (number = 0; number < avx512_iters; number++)
+                {
+                    currentValues = _mm512_loadu_si512((__m512i*)inputPtr);
+                    mask = _mm512_cmpgt_epi8_mask(currentValues, maxValues);
+
+                    if (mask != 0)
+                        {
+                            _mm512_store_si512((__m512i*)&currentValuesBuffer, currentValues);
+                            i = 0;
+                            while (mask > 0)
+                                {
+                                    if ((mask & 1) == 1)
+                                        {
+                                            if (currentValuesBuffer[i] > max)
+                                                {
+                                                    index = inputPtr - basePtr + i;
+                                                    max = currentValuesBuffer[i];
+                                                }
+                                        }
+                                    i++;
+                                    mask >>= 1;
+                                }
+                            maxValues = _mm512_set1_epi8(max);
+                        }
+                    inputPtr += 64;
+                }
+
+            for (i = avx512_iters * 64; i < num_points; ++i)
+                {
+                    if (src0[i] > max)
+                        {
+                            index = i;
+                            max = src0[i];
+                        }
+                }
+            target[0] = index;
+        }
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+
 #ifdef LV_HAVE_AVX2
 #include <immintrin.h>
 
@@ -338,6 +338,70 @@ static inline void volk_gnsssdr_8ic_conjugate_8ic_a_sse3(lv_8sc_t* cVector, cons
 #endif /* LV_HAVE_SSE3 */
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_conjugate_8ic_a_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 32;
+    unsigned int i;
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+
+    __m512i tmp;
+    const __m512i zero = _mm512_setzero_si512();
+    const __mmask64 imag_mask = 0xAAAAAAAAAAAAAAAAULL;  // odd bytes hold the imaginary parts
+
+    for (i = 0; i < avx512_iters; ++i)
+        {
+            tmp = _mm512_load_si512((__m512i*)a);
+            tmp = _mm512_mask_sub_epi8(tmp, imag_mask, zero, tmp);
+            _mm512_store_si512((__m512i*)c, tmp);
+
+            a += 32;
+            c += 32;
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            *c++ = lv_conj(*a++);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_conjugate_8ic_u_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 32;
+    unsigned int i;
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+
+    __m512i tmp;
+    const __m512i zero = _mm512_setzero_si512();
+    const __mmask64 imag_mask = 0xAAAAAAAAAAAAAAAAULL;  // odd bytes hold the imaginary parts
+
+    for (i = 0; i < avx512_iters; ++i)
+        {
+            tmp = _mm512_loadu_si512((__m512i*)a);
+            tmp = _mm512_mask_sub_epi8(tmp, imag_mask, zero, tmp);
+            _mm512_storeu_si512((__m512i*)c, tmp);
+
+            a += 32;
+            c += 32;
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            *c++ = lv_conj(*a++);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_conjugate_8ic_a_orc_impl(lv_8sc_t* cVector, const lv_8sc_t* aVector, unsigned int num_points);
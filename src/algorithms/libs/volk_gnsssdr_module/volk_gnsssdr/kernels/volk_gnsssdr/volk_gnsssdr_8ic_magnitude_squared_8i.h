@@ -270,6 +270,104 @@ static inline void volk_gnsssdr_8ic_magnitude_squared_8i_a_sse3(char* magnitudeV
 //#endif /* LV_HAVE_SSE */
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_magnitude_squared_8i_a_avx512bw(char* magnitudeVector, const lv_8sc_t* complexVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 64;
+    unsigned int number;
+    unsigned int i;
+    const char* complexVectorPtr = (char*)complexVector;
+    char* magnitudeVectorPtr = magnitudeVector;
+
+    __m512i mult1, avector, aadded, bvector, badded, realv, imagv, result8;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            avector = _mm512_load_si512((__m512i*)complexVectorPtr);
+            realv = _mm512_and_si512(avector, mult1);
+            imagv = _mm512_srli_epi16(avector, 8);
+            aadded = _mm512_add_epi16(_mm512_mullo_epi16(realv, realv), _mm512_mullo_epi16(imagv, imagv));
+
+            complexVectorPtr += 64;
+
+            bvector = _mm512_load_si512((__m512i*)complexVectorPtr);
+            realv = _mm512_and_si512(bvector, mult1);
+            imagv = _mm512_srli_epi16(bvector, 8);
+            badded = _mm512_add_epi16(_mm512_mullo_epi16(realv, realv), _mm512_mullo_epi16(imagv, imagv));
+
+            complexVectorPtr += 64;
+
+            // Truncate each 16-bit sum to its low byte
+            result8 = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(aadded)), _mm512_cvtepi16_epi8(badded), 1);
+
+            _mm512_store_si512((__m512i*)magnitudeVectorPtr, result8);
+
+            magnitudeVectorPtr += 64;
+        }
+
+    for (i = avx512_iters * 64; i < num_points; ++i)
+        {
+            const char valReal = *complexVectorPtr++;
+            const char valImag = *complexVectorPtr++;
+            *magnitudeVectorPtr++ = (valReal * valReal) + (valImag * valImag);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_magnitude_squared_8i_u_avx512bw(char* magnitudeVector, const lv_8sc_t* complexVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 64;
+    unsigned int number;
+    unsigned int i;
+    const char* complexVectorPtr = (char*)complexVector;
+    char* magnitudeVectorPtr = magnitudeVector;
+
+    __m512i mult1, avector, aadded, bvector, badded, realv, imagv, result8;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            avector = _mm512_loadu_si512((__m512i*)complexVectorPtr);
+            realv = _mm512_and_si512(avector, mult1);
+            imagv = _mm512_srli_epi16(avector, 8);
+            aadded = _mm512_add_epi16(_mm512_mullo_epi16(realv, realv), _mm512_mullo_epi16(imagv, imagv));
+
+            complexVectorPtr += 64;
+
+            bvector = _mm512_loadu_si512((__m512i*)complexVectorPtr);
+            realv = _mm512_and_si512(bvector, mult1);
+            imagv = _mm512_srli_epi16(bvector, 8);
+            badded = _mm512_add_epi16(_mm512_mullo_epi16(realv, realv), _mm512_mullo_epi16(imagv, imagv));
+
+            complexVectorPtr += 64;
+
+            // Truncate each 16-bit sum to its low byte
+            result8 = _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi16_epi8(aadded)), _mm512_cvtepi16_epi8(badded), 1);
+
+            _mm512_storeu_si512((__m512i*)magnitudeVectorPtr, result8);
+
+            magnitudeVectorPtr += 64;
+        }
+
+    for (i = avx512_iters * 64; i < num_points; ++i)
+        {
+            const char valReal = *complexVectorPtr++;
+            const char valImag = *complexVectorPtr++;
+            *magnitudeVectorPtr++ = (valReal * valReal) + (valImag * valImag);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_magnitude_squared_8i_a_orc_impl(char* magnitudeVector, const lv_8sc_t* complexVector, unsigned int num_points);
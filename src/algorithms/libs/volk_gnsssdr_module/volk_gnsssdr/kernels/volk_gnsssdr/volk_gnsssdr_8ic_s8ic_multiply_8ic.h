@@ -207,6 +207,96 @@ static inline void volk_gnsssdr_8ic_s8ic_multiply_8ic_a_sse3(lv_8sc_t* cVector,
 #endif /* LV_HAVE_SSE3 */
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_s8ic_multiply_8ic_a_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, const lv_8sc_t scalar, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int avx512_iters = num_points / 32;
+
+    __m512i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc;
+
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    y = _mm512_set1_epi16(*(short*)&scalar);
+    imagy = _mm512_srli_epi16(y, 8);
+    realy = _mm512_and_si512(y, mult1);
+
+    for (; number < avx512_iters; number++)
+        {
+            x = _mm512_load_si512((__m512i*)a);
+
+            imagx = _mm512_srli_epi16(x, 8);
+            realx = _mm512_and_si512(x, mult1);
+
+            realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+            imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realc, mult1), _mm512_slli_epi16(imagc, 8));
+
+            _mm512_store_si512((__m512i*)c, totalc);
+
+            a += 32;
+            c += 32;
+        }
+
+    for (number = avx512_iters * 32; number < num_points; ++number)
+        {
+            *c++ = (*a++) * scalar;
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_s8ic_multiply_8ic_u_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, const lv_8sc_t scalar, unsigned int num_points)
+{
+    unsigned int number = 0;
+    const unsigned int avx512_iters = num_points / 32;
+
+    __m512i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc;
+
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    y = _mm512_set1_epi16(*(short*)&scalar);
+    imagy = _mm512_srli_epi16(y, 8);
+    realy = _mm512_and_si512(y, mult1);
+
+    for (; number < avx512_iters; number++)
+        {
+            x = _mm512_loadu_si512((__m512i*)a);
+
+            imagx = _mm512_srli_epi16(x, 8);
+            realx = _mm512_and_si512(x, mult1);
+
+            realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+            imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realc, mult1), _mm512_slli_epi16(imagc, 8));
+
+            _mm512_storeu_si512((__m512i*)c, totalc);
+
+            a += 32;
+            c += 32;
+        }
+
+    for (number = avx512_iters * 32; number < num_points; ++number)
+        {
+            *c++ = (*a++) * scalar;
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_s8ic_multiply_8ic_a_orc_impl(lv_8sc_t* cVector, const lv_8sc_t* aVector, const char scalarreal, const char scalarimag, unsigned int num_points);
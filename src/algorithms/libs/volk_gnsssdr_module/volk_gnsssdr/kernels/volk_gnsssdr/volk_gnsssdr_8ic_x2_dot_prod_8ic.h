@@ -416,6 +416,140 @@ static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_sse4_1(lv_8sc_t* result, c
 #endif /*LV_HAVE_SSE4_1*/
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_avx512bw(lv_8sc_t* result, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points)
+{
+    lv_8sc_t dotProduct;
+    memset(&dotProduct, 0x0, 2 * sizeof(char));
+    unsigned int number;
+    unsigned int i;
+    const lv_8sc_t* a = in_a;
+    const lv_8sc_t* b = in_b;
+
+    const unsigned int avx512_iters = num_points / 32;
+
+    if (avx512_iters > 0)
+        {
+            __m512i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc, realcacc, imagcacc;
+
+            mult1 = _mm512_set1_epi16(0x00FF);
+            realcacc = _mm512_setzero_si512();
+            imagcacc = _mm512_setzero_si512();
+
+            for (number = 0; number < avx512_iters; number++)
+                {
+                    x = _mm512_load_si512((__m512i*)a);
+                    y = _mm512_load_si512((__m512i*)b);
+
+                    imagx = _mm512_srli_epi16(x, 8);
+                    realx = _mm512_and_si512(x, mult1);
+
+                    imagy = _mm512_srli_epi16(y, 8);
+                    realy = _mm512_and_si512(y, mult1);
+
+                    realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+                    imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+                    realcacc = _mm512_add_epi16(realcacc, realc);
+                    imagcacc = _mm512_add_epi16(imagcacc, imagc);
+
+                    a += 32;
+                    b += 32;
+                }
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realcacc, mult1), _mm512_slli_epi16(imagcacc, 8));
+
+            __VOLK_ATTR_ALIGNED(64)
+            lv_8sc_t dotProductVector[32];
+
+            _mm512_store_si512((__m512i*)dotProductVector, totalc);  // Store the results back into the dot product vector
+
+            for (i = 0; i < 32; ++i)
+                {
+                    dotProduct += dotProductVector[i];
+                }
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            dotProduct += (*a++) * (*b++);
+        }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_u_avx512bw(lv_8sc_t* result, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points)
+{
+    lv_8sc_t dotProduct;
+    memset(&dotProduct, 0x0, 2 * sizeof(char));
+    unsigned int number;
+    unsigned int i;
+    const lv_8sc_t* a = in_a;
+    const lv_8sc_t* b = in_b;
+
+    const unsigned int avx512_iters = num_points / 32;
+
+    if (avx512_iters > 0)
+        {
+            __m512i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc, realcacc, imagcacc;
+
+            mult1 = _mm512_set1_epi16(0x00FF);
+            realcacc = _mm512_setzero_si512();
+            imagcacc = _mm512_setzero_si512();
+
+            for (number = 0; number < avx512_iters; number++)
+                {
+                    x = _mm512_loadu_si512((__m512i*)a);
+                    y = _mm512_loadu_si512((__m512i*)b);
+
+                    imagx = _mm512_srli_epi16(x, 8);
+                    realx = _mm512_and_si512(x, mult1);
+
+                    imagy = _mm512_srli_epi16(y, 8);
+                    realy = _mm512_and_si512(y, mult1);
+
+                    realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+                    imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+                    realcacc = _mm512_add_epi16(realcacc, realc);
+                    imagcacc = _mm512_add_epi16(imagcacc, imagc);
+
+                    a += 32;
+                    b += 32;
+                }
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realcacc, mult1), _mm512_slli_epi16(imagcacc, 8));
+
+            __VOLK_ATTR_ALIGNED(64)
+            lv_8sc_t dotProductVector[32];
+
+            _mm512_store_si512((__m512i*)dotProductVector, totalc);  // Store the results back into the dot product vector
+
+            for (i = 0; i < 32; ++i)
+                {
+                    dotProduct += dotProductVector[i];
+                }
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            dotProduct += (*a++) * (*b++);
+        }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX512BW*/
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_orc_impl(short* resRealShort, short* resImagShort, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points);
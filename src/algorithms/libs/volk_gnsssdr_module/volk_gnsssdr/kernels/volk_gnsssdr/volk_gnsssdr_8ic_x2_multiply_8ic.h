@@ -301,6 +301,100 @@ static inline void volk_gnsssdr_8ic_x2_multiply_8ic_a_sse4_1(lv_8sc_t* cVector,
 #endif /* LV_HAVE_SSE4_1 */
 
 
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_multiply_8ic_a_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, const lv_8sc_t* bVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 32;
+    unsigned int number;
+    unsigned int i;
+    __m512i x, y;
+    __m512i mult1, realx, imagx, realy, imagy, realc, imagc, totalc;
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+    const lv_8sc_t* b = bVector;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            x = _mm512_load_si512((__m512i*)a);
+            y = _mm512_load_si512((__m512i*)b);
+
+            imagx = _mm512_srli_epi16(x, 8);
+            realx = _mm512_and_si512(x, mult1);
+
+            imagy = _mm512_srli_epi16(y, 8);
+            realy = _mm512_and_si512(y, mult1);
+
+            realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+            imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realc, mult1), _mm512_slli_epi16(imagc, 8));
+
+            _mm512_store_si512((__m512i*)c, totalc);
+
+            a += 32;
+            b += 32;
+            c += 32;
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            *c++ = (*a++) * (*b++);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
+#ifdef LV_HAVE_AVX512BW
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_multiply_8ic_u_avx512bw(lv_8sc_t* cVector, const lv_8sc_t* aVector, const lv_8sc_t* bVector, unsigned int num_points)
+{
+    const unsigned int avx512_iters = num_points / 32;
+    unsigned int number;
+    unsigned int i;
+    __m512i x, y;
+    __m512i mult1, realx, imagx, realy, imagy, realc, imagc, totalc;
+    lv_8sc_t* c = cVector;
+    const lv_8sc_t* a = aVector;
+    const lv_8sc_t* b = bVector;
+
+    mult1 = _mm512_set1_epi16(0x00FF);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            x = _mm512_loadu_si512((__m512i*)a);
+            y = _mm512_loadu_si512((__m512i*)b);
+
+            imagx = _mm512_srli_epi16(x, 8);
+            realx = _mm512_and_si512(x, mult1);
+
+            imagy = _mm512_srli_epi16(y, 8);
+            realy = _mm512_and_si512(y, mult1);
+
+            realc = _mm512_sub_epi16(_mm512_mullo_epi16(realx, realy), _mm512_mullo_epi16(imagx, imagy));
+            imagc = _mm512_add_epi16(_mm512_mullo_epi16(realx, imagy), _mm512_mullo_epi16(imagx, realy));
+
+            totalc = _mm512_or_si512(_mm512_and_si512(realc, mult1), _mm512_slli_epi16(imagc, 8));
+
+            _mm512_storeu_si512((__m512i*)c, totalc);
+
+            a += 32;
+            b += 32;
+            c += 32;
+        }
+
+    for (i = avx512_iters * 32; i < num_points; ++i)
+        {
+            *c++ = (*a++) * (*b++);
+        }
+}
+#endif /* LV_HAVE_AVX512BW */
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_x2_multiply_8ic_a_orc_impl(lv_8sc_t* cVector, const lv_8sc_t* aVector, const lv_8sc_t* bVector, unsigned int num_points);
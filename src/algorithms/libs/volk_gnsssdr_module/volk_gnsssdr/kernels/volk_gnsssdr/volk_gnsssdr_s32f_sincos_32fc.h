@@ -833,6 +833,108 @@ static inline void volk_gnsssdr_s32f_sincos_32fc_u_avx2(lv_32fc_t *out, const fl
 #endif /* LV_HAVE_AVX2  */
 
 
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+/* Same Cephes-based evaluation as the AVX2 version, sixteen phases at a time */
+static inline void volk_gnsssdr_s32f_sincos_32fc_a_avx512f(lv_32fc_t *out, const float phase_inc, float *phase, unsigned int num_points)
+{
+    lv_32fc_t *bPtr = out;
+
+    const unsigned int avx512_iters = num_points / 16;
+    unsigned int number = 0;
+
+    float _phase = (*phase);
+
+    __m512 sine, cosine, sixteen_phases_reg;
+
+    /* interleave the cosines and sines into complex values */
+    const __m512i lo_idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    __VOLK_ATTR_ALIGNED(64)
+    float sixteen_phases[16];
+    for (number = 0; number < 16; number++)
+        {
+            sixteen_phases[number] = _phase + (float)number * phase_inc;
+        }
+    sixteen_phases_reg = _mm512_load_ps(sixteen_phases);
+    const __m512 sixteen_phases_inc_reg = _mm512_set1_ps(16 * phase_inc);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            _mm512_sincos_ps(sixteen_phases_reg, &sine, &cosine);
+
+            /* write the output */
+            _mm512_store_ps((float *)bPtr, _mm512_permutex2var_ps(cosine, lo_idx, sine));
+            _mm512_store_ps((float *)(bPtr + 8), _mm512_permutex2var_ps(cosine, hi_idx, sine));
+            bPtr += 16;
+
+            sixteen_phases_reg = _mm512_add_ps(sixteen_phases_reg, sixteen_phases_inc_reg);
+        }
+    _mm256_zeroupper();
+    _phase = _phase + phase_inc * (avx512_iters * 16);
+    for (number = avx512_iters * 16; number < num_points; number++)
+        {
+            out[number] = lv_cmake((float)cosf(_phase), (float)sinf(_phase));
+            _phase += phase_inc;
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F  */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+/* Same Cephes-based evaluation as the AVX2 version, sixteen phases at a time */
+static inline void volk_gnsssdr_s32f_sincos_32fc_u_avx512f(lv_32fc_t *out, const float phase_inc, float *phase, unsigned int num_points)
+{
+    lv_32fc_t *bPtr = out;
+
+    const unsigned int avx512_iters = num_points / 16;
+    unsigned int number = 0;
+
+    float _phase = (*phase);
+
+    __m512 sine, cosine, sixteen_phases_reg;
+
+    /* interleave the cosines and sines into complex values */
+    const __m512i lo_idx = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    __VOLK_ATTR_ALIGNED(64)
+    float sixteen_phases[16];
+    for (number = 0; number < 16; number++)
+        {
+            sixteen_phases[number] = _phase + (float)number * phase_inc;
+        }
+    sixteen_phases_reg = _mm512_load_ps(sixteen_phases);
+    const __m512 sixteen_phases_inc_reg = _mm512_set1_ps(16 * phase_inc);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            _mm512_sincos_ps(sixteen_phases_reg, &sine, &cosine);
+
+            /* write the output */
+            _mm512_storeu_ps((float *)bPtr, _mm512_permutex2var_ps(cosine, lo_idx, sine));
+            _mm512_storeu_ps((float *)(bPtr + 8), _mm512_permutex2var_ps(cosine, hi_idx, sine));
+            bPtr += 16;
+
+            sixteen_phases_reg = _mm512_add_ps(sixteen_phases_reg, sixteen_phases_inc_reg);
+        }
+    _mm256_zeroupper();
+    _phase = _phase + phase_inc * (avx512_iters * 16);
+    for (number = avx512_iters * 16; number < num_points; number++)
+        {
+            out[number] = lv_cmake((float)cosf(_phase), (float)sinf(_phase));
+            _phase += phase_inc;
+        }
+    (*phase) = _phase;
+}
+
+#endif /* LV_HAVE_AVX512F  */
+
+
 #ifdef LV_HAVE_NEONV7
 #include <arm_neon.h>
 /* Adapted from http://gruntthepeon.free.fr/ssemath/neon_mathfun.h, original code from Julien Pommier  */
@@ -126,7 +126,7 @@ static inline unsigned int get_avx2_enabled(void)
 static inline unsigned int get_avx512_enabled(void)
 {
 #if defined(VOLK_CPU_x86)
-    return __xgetbv() & 0xE6;  //check for zmm, xmm and ymm regs
+    return (__xgetbv() & 0xE6) == 0xE6;  //check for opmask, zmm, xmm and ymm regs
 #else
     return 0;
 #endif
@@ -66,6 +66,9 @@ GalileoE5aDllPllTracking::GalileoE5aDllPllTracking(
     bool dump_mat = configuration->property(role + ".dump_mat", true);
     trk_param.dump_mat = dump_mat;
     trk_param.high_dyn = configuration->property(role + ".high_dyn", false);
+    trk_param.batch_correlators = configuration->property(role + ".batch_correlators", false);
+    trk_param.shared_replica = configuration->property(role + ".shared_replica", false);
+    trk_param.shared_replica_fractional = configuration->property(role + ".shared_replica_fractional", false);
     if (configuration->property(role + ".smoother_length", 10) < 1)
         {
             trk_param.smoother_length = 1;
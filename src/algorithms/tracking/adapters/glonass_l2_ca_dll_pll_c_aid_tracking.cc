@@ -38,6 +38,7 @@
 #include "glonass_l2_ca_dll_pll_c_aid_tracking.h"
 #include "GLONASS_L1_L2_CA.h"
 #include "configuration_interface.h"
+#include "glonass_fdma_channelizer.h"
 #include "gnss_sdr_flags.h"
 #include <glog/logging.h>
 
@@ -65,6 +66,17 @@ GlonassL2CaDllPllCAidTracking::GlonassL2CaDllPllCAidTracking(
     //vector_length = configuration->property(role + ".vector_length", 2048);
     int fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+    bool fdma_channelized = configuration->property("GNSS-SDR.GLONASS_FDMA_channelizer", false);
+    if (fdma_channelized)
+        {
+            fs_in = Glonass_Fdma_Channelizer::output_rate(GLONASS_L2_CA_DFREQ_HZ);
+            if (item_type_ != "gr_complex")
+                {
+                    // The sub-band selector only delivers gr_complex samples
+                    LOG(WARNING) << item_type_ << " tracking item type is not supported with the GLONASS FDMA channelizer. Using gr_complex";
+                    item_type_ = "gr_complex";
+                }
+        }
     dump = configuration->property(role + ".dump", false);
     pll_bw_hz = configuration->property(role + ".pll_bw_hz", 50.0);
     if (FLAGS_pll_bw_hz != 0.0) pll_bw_hz = static_cast<float>(FLAGS_pll_bw_hz);
@@ -94,7 +106,8 @@ GlonassL2CaDllPllCAidTracking::GlonassL2CaDllPllCAidTracking(
                 pll_bw_narrow_hz,
                 dll_bw_narrow_hz,
                 extend_correlation_ms,
-                early_late_space_chips);
+                early_late_space_chips,
+                fdma_channelized);
             DLOG(INFO) << "tracking(" << tracking_cc->unique_id() << ")";
         }
     else if (item_type_ == "cshort")
@@ -110,7 +123,8 @@ GlonassL2CaDllPllCAidTracking::GlonassL2CaDllPllCAidTracking(
                 pll_bw_narrow_hz,
                 dll_bw_narrow_hz,
                 extend_correlation_ms,
-                early_late_space_chips);
+                early_late_space_chips,
+                fdma_channelized);
             DLOG(INFO) << "tracking(" << tracking_sc->unique_id() << ")";
         }
     else
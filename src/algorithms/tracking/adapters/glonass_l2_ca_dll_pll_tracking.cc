@@ -37,6 +37,7 @@
 #include "glonass_l2_ca_dll_pll_tracking.h"
 #include "GLONASS_L1_L2_CA.h"
 #include "configuration_interface.h"
+#include "glonass_fdma_channelizer.h"
 #include "gnss_sdr_flags.h"
 #include <glog/logging.h>
 
@@ -62,6 +63,11 @@ GlonassL2CaDllPllTracking::GlonassL2CaDllPllTracking(
     item_type = configuration->property(role + ".item_type", default_item_type);
     int fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+    bool fdma_channelized = configuration->property("GNSS-SDR.GLONASS_FDMA_channelizer", false);
+    if (fdma_channelized)
+        {
+            fs_in = Glonass_Fdma_Channelizer::output_rate(GLONASS_L2_CA_DFREQ_HZ);
+        }
     dump = configuration->property(role + ".dump", false);
     pll_bw_hz = configuration->property(role + ".pll_bw_hz", 50.0);
     if (FLAGS_pll_bw_hz != 0.0) pll_bw_hz = static_cast<float>(FLAGS_pll_bw_hz);
@@ -83,7 +89,8 @@ GlonassL2CaDllPllTracking::GlonassL2CaDllPllTracking(
                 dump_filename,
                 pll_bw_hz,
                 dll_bw_hz,
-                early_late_space_chips);
+                early_late_space_chips,
+                fdma_channelized);
         }
     else
         {
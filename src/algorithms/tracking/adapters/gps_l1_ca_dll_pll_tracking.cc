@@ -59,6 +59,9 @@ GpsL1CaDllPllTracking::GpsL1CaDllPllTracking(
     int fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     trk_param.fs_in = fs_in;
     trk_param.high_dyn = configuration->property(role + ".high_dyn", false);
+    trk_param.batch_correlators = configuration->property(role + ".batch_correlators", false);
+    trk_param.shared_replica = configuration->property(role + ".shared_replica", false);
+    trk_param.shared_replica_fractional = configuration->property(role + ".shared_replica_fractional", false);
     if (configuration->property(role + ".smoother_length", 10) < 1)
         {
             trk_param.smoother_length = 1;
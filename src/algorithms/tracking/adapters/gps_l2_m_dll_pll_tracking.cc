@@ -58,6 +58,9 @@ GpsL2MDllPllTracking::GpsL2MDllPllTracking(
     int fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000);
     int fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     trk_param.fs_in = fs_in;
+    trk_param.batch_correlators = configuration->property(role + ".batch_correlators", false);
+    trk_param.shared_replica = configuration->property(role + ".shared_replica", false);
+    trk_param.shared_replica_fractional = configuration->property(role + ".shared_replica_fractional", false);
     bool dump = configuration->property(role + ".dump", false);
     trk_param.dump = dump;
     std::string default_dump_filename = "./track_ch";
@@ -340,6 +340,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
             d_prompt_data_shift = &d_local_code_shift_chips[1];
         }
 
+    multicorrelator_cpu.set_shared_replica(trk_parameters.shared_replica, trk_parameters.shared_replica_fractional);
     multicorrelator_cpu.init(2 * trk_parameters.vector_length, d_n_correlator_taps);
 
     if (trk_parameters.extend_correlation_symbols > 1)
@@ -358,6 +359,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
             // Extra correlator for the data component
             correlator_data_cpu.init(2 * trk_parameters.vector_length, 1);
             correlator_data_cpu.set_high_dynamics_resampler(trk_parameters.high_dyn);
+            correlator_data_cpu.set_batch_correlation(trk_parameters.batch_correlators);
             d_data_code = static_cast<float *>(volk_gnsssdr_malloc(2 * d_code_length_chips * sizeof(float), volk_gnsssdr_get_alignment()));
         }
     else
@@ -367,6 +369,11 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
 
     // --- Initializations ---
     multicorrelator_cpu.set_high_dynamics_resampler(trk_parameters.high_dyn);
+    multicorrelator_cpu.set_batch_correlation(trk_parameters.batch_correlators);
+    if (trk_parameters.batch_correlators and trk_parameters.high_dyn)
+        {
+            LOG(WARNING) << "Batched correlators are not used with the high dynamics resampler";
+        }
     // Initial code frequency basis of NCO
     d_code_freq_chips = d_code_chip_rate;
     // Residual code phase (in chips)
@@ -69,10 +69,11 @@ glonass_l1_ca_dll_pll_c_aid_make_tracking_sc(
     float pll_bw_narrow_hz,
     float dll_bw_narrow_hz,
     int32_t extend_correlation_ms,
-    float early_late_space_chips)
+    float early_late_space_chips,
+    bool fdma_channelized)
 {
     return glonass_l1_ca_dll_pll_c_aid_tracking_sc_sptr(new glonass_l1_ca_dll_pll_c_aid_tracking_sc(
-        fs_in, vector_length, dump, std::move(dump_filename), pll_bw_hz, dll_bw_hz, pll_bw_narrow_hz, dll_bw_narrow_hz, extend_correlation_ms, early_late_space_chips));
+        fs_in, vector_length, dump, std::move(dump_filename), pll_bw_hz, dll_bw_hz, pll_bw_narrow_hz, dll_bw_narrow_hz, extend_correlation_ms, early_late_space_chips, fdma_channelized));
 }
 
 
@@ -108,7 +109,8 @@ glonass_l1_ca_dll_pll_c_aid_tracking_sc::glonass_l1_ca_dll_pll_c_aid_tracking_sc
     float pll_bw_narrow_hz,
     float dll_bw_narrow_hz,
     int32_t extend_correlation_ms,
-    float early_late_space_chips) : gr::block("glonass_l1_ca_dll_pll_c_aid_tracking_sc", gr::io_signature::make(1, 1, sizeof(lv_16sc_t)),
+    float early_late_space_chips,
+    bool fdma_channelized) : gr::block("glonass_l1_ca_dll_pll_c_aid_tracking_sc", gr::io_signature::make(1, 1, sizeof(lv_16sc_t)),
                                         gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
     // Telemetry bit synchronization message port input
@@ -119,6 +121,7 @@ glonass_l1_ca_dll_pll_c_aid_tracking_sc::glonass_l1_ca_dll_pll_c_aid_tracking_sc
     // initialize internal vars
     d_dump = dump;
     d_fs_in = fs_in;
+    d_fdma_channelized = fdma_channelized;
     d_vector_length = vector_length;
     d_dump_filename = std::move(dump_filename);
     d_correlation_length_samples = static_cast<int32_t>(d_vector_length);
@@ -255,7 +258,12 @@ void glonass_l1_ca_dll_pll_c_aid_tracking_sc::start_tracking()
 
     d_acq_code_phase_samples = corrected_acq_phase_samples;
 
-    d_carrier_frequency_hz = d_acq_carrier_doppler_hz + (DFRQ1_GLO * static_cast<double>(GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN)));
+    d_carrier_frequency_hz = d_acq_carrier_doppler_hz;
+    if (!d_fdma_channelized)
+        {
+            // The FDMA offset of the satellite is still in the wideband input
+            d_carrier_frequency_hz += DFRQ1_GLO * static_cast<double>(GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN));
+        }
     ;
     d_carrier_doppler_hz = d_acq_carrier_doppler_hz;
 
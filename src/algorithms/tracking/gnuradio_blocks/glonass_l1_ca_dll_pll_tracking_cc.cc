@@ -65,10 +65,11 @@ glonass_l1_ca_dll_pll_make_tracking_cc(
     std::string dump_filename,
     float pll_bw_hz,
     float dll_bw_hz,
-    float early_late_space_chips)
+    float early_late_space_chips,
+    bool fdma_channelized)
 {
     return glonass_l1_ca_dll_pll_tracking_cc_sptr(new Glonass_L1_Ca_Dll_Pll_Tracking_cc(
-        fs_in, vector_length, dump, std::move(dump_filename), pll_bw_hz, dll_bw_hz, early_late_space_chips));
+        fs_in, vector_length, dump, std::move(dump_filename), pll_bw_hz, dll_bw_hz, early_late_space_chips, fdma_channelized));
 }
 
 
@@ -89,7 +90,8 @@ Glonass_L1_Ca_Dll_Pll_Tracking_cc::Glonass_L1_Ca_Dll_Pll_Tracking_cc(
     std::string dump_filename,
     float pll_bw_hz,
     float dll_bw_hz,
-    float early_late_space_chips) : gr::block("Glonass_L1_Ca_Dll_Pll_Tracking_cc", gr::io_signature::make(1, 1, sizeof(gr_complex)),
+    float early_late_space_chips,
+    bool fdma_channelized) : gr::block("Glonass_L1_Ca_Dll_Pll_Tracking_cc", gr::io_signature::make(1, 1, sizeof(gr_complex)),
                                         gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
     this->message_port_register_out(pmt::mp("events"));
@@ -97,6 +99,7 @@ Glonass_L1_Ca_Dll_Pll_Tracking_cc::Glonass_L1_Ca_Dll_Pll_Tracking_cc(
     // initialize internal vars
     d_dump = dump;
     d_fs_in = fs_in;
+    d_fdma_channelized = fdma_channelized;
     d_vector_length = vector_length;
     d_dump_filename = std::move(dump_filename);
 
@@ -217,7 +220,12 @@ void Glonass_L1_Ca_Dll_Pll_Tracking_cc::start_tracking()
 
     d_acq_code_phase_samples = corrected_acq_phase_samples;
 
-    d_carrier_frequency_hz = d_acq_carrier_doppler_hz + (DFRQ1_GLO * GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN));
+    d_carrier_frequency_hz = d_acq_carrier_doppler_hz;
+    if (!d_fdma_channelized)
+        {
+            // The FDMA offset of the satellite is still in the wideband input
+            d_carrier_frequency_hz += DFRQ1_GLO * GLONASS_PRN.at(d_acquisition_gnss_synchro->PRN);
+        }
     d_carrier_doppler_hz = d_acq_carrier_doppler_hz;
     d_carrier_phase_step_rad = GLONASS_TWO_PI * d_carrier_frequency_hz / static_cast<double>(d_fs_in);
     d_carrier_doppler_phase_step_rad = GLONASS_TWO_PI * (d_carrier_doppler_hz) / static_cast<double>(d_fs_in);
@@ -60,7 +60,8 @@ glonass_l1_ca_dll_pll_make_tracking_cc(
     std::string dump_filename,
     float pll_bw_hz,
     float dll_bw_hz,
-    float early_late_space_chips);
+    float early_late_space_chips,
+    bool fdma_channelized);
 
 
 /*!
@@ -88,7 +89,8 @@ private:
         std::string dump_filename,
         float pll_bw_hz,
         float dll_bw_hz,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     Glonass_L1_Ca_Dll_Pll_Tracking_cc(
         int64_t fs_in, uint32_t vector_length,
@@ -96,7 +98,8 @@ private:
         std::string dump_filename,
         float pll_bw_hz,
         float dll_bw_hz,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     // tracking configuration vars
     uint32_t d_vector_length;
@@ -106,6 +109,7 @@ private:
     uint32_t d_channel;
 
     int64_t d_fs_in;
+    bool d_fdma_channelized;  // the input is already the sub-band of the satellite, at baseband
     int64_t d_glonass_freq_ch;
 
     double d_early_late_spc_chips;
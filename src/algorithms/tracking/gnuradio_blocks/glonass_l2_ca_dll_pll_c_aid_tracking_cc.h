@@ -64,7 +64,8 @@ glonass_l2_ca_dll_pll_c_aid_make_tracking_cc(
     float pll_bw_narrow_hz,
     float dll_bw_narrow_hz,
     int32_t extend_correlation_ms,
-    float early_late_space_chips);
+    float early_late_space_chips,
+    bool fdma_channelized);
 
 
 /*!
@@ -95,7 +96,8 @@ private:
         float pll_bw_narrow_hz,
         float dll_bw_narrow_hz,
         int32_t extend_correlation_ms,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     glonass_l2_ca_dll_pll_c_aid_tracking_cc(
         int64_t fs_in, uint32_t vector_length,
@@ -106,7 +108,8 @@ private:
         float pll_bw_narrow_hz,
         float dll_bw_narrow_hz,
         int32_t extend_correlation_ms,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     // tracking configuration vars
     uint32_t d_vector_length;
@@ -116,6 +119,7 @@ private:
     uint32_t d_channel;
 
     int64_t d_fs_in;
+    bool d_fdma_channelized;  // the input is already the sub-band of the satellite, at baseband
     double d_glonass_freq_ch;
 
     double d_early_late_spc_chips;
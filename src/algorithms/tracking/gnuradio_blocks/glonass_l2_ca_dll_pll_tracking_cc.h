@@ -58,7 +58,8 @@ glonass_l2_ca_dll_pll_make_tracking_cc(
     std::string dump_filename,
     float pll_bw_hz,
     float dll_bw_hz,
-    float early_late_space_chips);
+    float early_late_space_chips,
+    bool fdma_channelized);
 
 
 /*!
@@ -86,7 +87,8 @@ private:
         std::string dump_filename,
         float pll_bw_hz,
         float dll_bw_hz,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     Glonass_L2_Ca_Dll_Pll_Tracking_cc(
         int64_t fs_in, uint32_t vector_length,
@@ -94,7 +96,8 @@ private:
         std::string dump_filename,
         float pll_bw_hz,
         float dll_bw_hz,
-        float early_late_space_chips);
+        float early_late_space_chips,
+        bool fdma_channelized);
 
     // tracking configuration vars
     uint32_t d_vector_length;
@@ -104,6 +107,7 @@ private:
     uint32_t d_channel;
 
     int64_t d_fs_in;
+    bool d_fdma_channelized;  // the input is already the sub-band of the satellite, at baseband
     int64_t d_glonass_freq_ch;
 
     double d_early_late_spc_chips;
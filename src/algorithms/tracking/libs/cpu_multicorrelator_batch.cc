@@ -0,0 +1,286 @@
+/*!
+ * \file cpu_multicorrelator_batch.cc
+ * \brief Carrier wipe-off and correlators of several tracking channels
+ * computed in a single cache-blocked pass over the shared input samples
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "cpu_multicorrelator_batch.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+
+uint32_t cpu_multicorrelator_batch::s_max_batch = 0U;
+uint32_t cpu_multicorrelator_batch::s_gather_us = 0U;
+uint32_t cpu_multicorrelator_batch::s_block_samples = 0U;
+uint32_t cpu_multicorrelator_batch::s_max_threads = 0U;
+
+
+Batch_Correlation::Batch_Correlation()
+{
+    sig_in = nullptr;
+    local_codes = nullptr;
+    corr_out = nullptr;
+    rem_carrier_phase_rad = 0.0;
+    phase_step_rad = 0.0;
+    num_samples = 0;
+    n_correlators = 0;
+}
+
+
+cpu_multicorrelator_batch::Batch::Batch()
+{
+    next_item = 0;
+    completed_items = 0;
+    workers = 0U;
+    expected_requests = 0U;
+    closed = false;
+}
+
+
+void cpu_multicorrelator_batch::configure(uint32_t max_batch, uint32_t gather_us, uint32_t block_samples, uint32_t max_threads)
+{
+    s_max_batch = max_batch;
+    s_gather_us = gather_us;
+    s_block_samples = block_samples;
+    s_max_threads = max_threads;
+}
+
+
+cpu_multicorrelator_batch& cpu_multicorrelator_batch::instance()
+{
+    // Thread-safe initialization (C++11 magic statics)
+    static cpu_multicorrelator_batch engine(s_max_batch, s_gather_us, s_block_samples, s_max_threads);
+    return engine;
+}
+
+
+cpu_multicorrelator_batch::cpu_multicorrelator_batch(uint32_t max_batch, uint32_t gather_us, uint32_t block_samples, uint32_t max_threads)
+{
+    d_max_batch = (max_batch == 0) ? 16U : max_batch;
+    d_gather_us = (gather_us == 0) ? 100U : gather_us;
+    d_block_samples = (block_samples == 0) ? 2048U : block_samples;
+    d_max_threads = max_threads;
+    d_expected_requests = d_max_batch;
+    d_batches_to_probe = 0U;
+}
+
+
+void cpu_multicorrelator_batch::correlate_span(const Batch_Correlation& request, int first_sample, int num_samples, std::complex<float>* partial, std::vector<const float*>& local_codes)
+{
+    // Regenerate the carrier phase at the first sample of the span, so that
+    // the result does not depend on how the samples are split in blocks
+    double phase_rad = std::fmod(request.rem_carrier_phase_rad + request.phase_step_rad * static_cast<double>(first_sample), 2.0 * M_PI);
+    lv_32fc_t phase_offset_as_complex[1];
+    phase_offset_as_complex[0] = lv_cmake(static_cast<float>(std::cos(phase_rad)), static_cast<float>(-std::sin(phase_rad)));
+    const float* const* codes = request.local_codes;
+    if (first_sample != 0)
+        {
+            local_codes.resize(std::max(local_codes.size(), static_cast<size_t>(request.n_correlators)));
+            for (int n = 0; n < request.n_correlators; n++)
+                {
+                    local_codes[n] = request.local_codes[n] + first_sample;
+                }
+            codes = local_codes.data();
+        }
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(partial, request.sig_in + first_sample, std::exp(lv_32fc_t(0.0, -static_cast<float>(request.phase_step_rad))), phase_offset_as_complex, const_cast<const float**>(codes), request.n_correlators, num_samples);
+}
+
+
+void cpu_multicorrelator_batch::correlate(const Batch_Correlation& request)
+{
+    if (request.num_samples <= 0)
+        {
+            std::fill_n(request.corr_out, request.n_correlators, std::complex<float>(0.0, 0.0));
+            return;
+        }
+    if (d_max_batch <= 1)
+        {
+            std::vector<const float*> unused;
+            correlate_span(request, 0, request.num_samples, request.corr_out, unused);
+            return;
+        }
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+    if (d_open_batch == nullptr)
+        {
+            d_open_batch = std::make_shared<Batch>();
+            if (d_batches_to_probe == 0)
+                {
+                    d_open_batch->expected_requests = d_max_batch;
+                    d_batches_to_probe = probe_interval;
+                }
+            else
+                {
+                    d_open_batch->expected_requests = d_expected_requests;
+                    d_batches_to_probe--;
+                }
+        }
+    std::shared_ptr<Batch> batch = d_open_batch;
+    const size_t index = batch->requests.size();
+    batch->requests.push_back(&request);
+
+    if (batch->requests.size() >= std::min(d_max_batch, batch->expected_requests))
+        {
+            close_batch(batch);
+        }
+    else if (index == 0)
+        {
+            // The first request waits for the others only up to the gathering time
+            batch->cond.wait_for(lock, std::chrono::microseconds(d_gather_us), [&batch] { return batch->closed; });
+            if (!batch->closed)
+                {
+                    d_expected_requests = static_cast<uint32_t>(batch->requests.size());
+                    close_batch(batch);
+                }
+        }
+    else
+        {
+            batch->cond.wait(lock, [&batch] { return batch->closed; });
+        }
+
+    // Share the work among the threads of the batch
+    const uint32_t worker = batch->workers++;
+    const uint32_t num_workers = (d_max_threads == 0) ? static_cast<uint32_t>(batch->requests.size()) : std::min(static_cast<uint32_t>(batch->requests.size()), d_max_threads);
+    std::unique_ptr<Worker_Scratch> scratch;
+    if (worker < num_workers and batch->next_item < batch->items.size())
+        {
+            if (d_free_scratch.empty())
+                {
+                    scratch = std::unique_ptr<Worker_Scratch>(new Worker_Scratch());
+                }
+            else
+                {
+                    scratch = std::move(d_free_scratch.back());
+                    d_free_scratch.pop_back();
+                }
+        }
+    while (worker < num_workers and batch->next_item < batch->items.size())
+        {
+            const Batch_Item item = batch->items[batch->next_item++];
+            lock.unlock();
+            scratch->partials.clear();
+            scratch->partial_requests.clear();
+            for (size_t i = item.first; i < item.last; i++)
+                {
+                    const size_t r = batch->item_requests[i];
+                    const Batch_Correlation* req = batch->requests[r];
+                    const uintptr_t start = reinterpret_cast<uintptr_t>(req->sig_in);
+                    const uintptr_t end = start + static_cast<uintptr_t>(req->num_samples) * sizeof(std::complex<float>);
+                    const uintptr_t lo = std::max(start, item.block_start);
+                    const uintptr_t hi = std::min(end, item.block_end);
+                    const int first = static_cast<int>((lo - start + sizeof(std::complex<float>) - 1) / sizeof(std::complex<float>));
+                    const int last = static_cast<int>((hi - start + sizeof(std::complex<float>) - 1) / sizeof(std::complex<float>));
+                    if (last > first)
+                        {
+                            const size_t offset = scratch->partials.size();
+                            scratch->partials.resize(offset + req->n_correlators);
+                            correlate_span(*req, first, last - first, &scratch->partials[offset], scratch->local_codes);
+                            scratch->partial_requests.push_back(r);
+                        }
+                }
+            lock.lock();
+            const std::complex<float>* partial = scratch->partials.data();
+            for (size_t r : scratch->partial_requests)
+                {
+                    std::vector<std::complex<float>>& sums = batch->sums[r];
+                    for (size_t n = 0; n < sums.size(); n++)
+                        {
+                            sums[n] += partial[n];
+                        }
+                    partial += sums.size();
+                }
+            batch->completed_items++;
+            if (batch->completed_items == batch->items.size())
+                {
+                    batch->cond.notify_all();
+                }
+        }
+    if (scratch)
+        {
+            d_free_scratch.push_back(std::move(scratch));
+        }
+    batch->cond.wait(lock, [&batch] { return batch->completed_items == batch->items.size(); });
+    std::copy(batch->sums[index].begin(), batch->sums[index].end(), request.corr_out);
+}
+
+
+void cpu_multicorrelator_batch::close_batch(const std::shared_ptr<Batch>& batch)
+{
+    // Called with d_mutex locked
+    batch->closed = true;
+    if (d_open_batch == batch)
+        {
+            d_open_batch = nullptr;
+        }
+
+    // Blocks are aligned in the address space, so that the channels reading
+    // the same buffer share them regardless of where their spans start
+    const uintptr_t block_bytes = static_cast<uintptr_t>(d_block_samples) * sizeof(std::complex<float>);
+    std::vector<std::pair<uintptr_t, size_t>> block_requests;
+    batch->sums.resize(batch->requests.size());
+    for (size_t r = 0; r < batch->requests.size(); r++)
+        {
+            const Batch_Correlation* req = batch->requests[r];
+            batch->sums[r].assign(req->n_correlators, std::complex<float>(0.0, 0.0));
+            const uintptr_t start = reinterpret_cast<uintptr_t>(req->sig_in);
+            const uintptr_t end = start + static_cast<uintptr_t>(req->num_samples) * sizeof(std::complex<float>);
+            for (uintptr_t block = start / block_bytes; block <= (end - 1) / block_bytes; block++)
+                {
+                    block_requests.emplace_back(block, r);
+                }
+        }
+    std::sort(block_requests.begin(), block_requests.end());
+
+    // Split the requests of each block in one run per thread
+    const size_t num_workers = (d_max_threads == 0) ? batch->requests.size() : std::min(batch->requests.size(), static_cast<size_t>(d_max_threads));
+    batch->item_requests.reserve(block_requests.size());
+    size_t i = 0;
+    while (i < block_requests.size())
+        {
+            size_t j = i;
+            while (j < block_requests.size() and block_requests[j].first == block_requests[i].first)
+                {
+                    batch->item_requests.push_back(block_requests[j].second);
+                    j++;
+                }
+            const size_t run = (j - i + num_workers - 1) / num_workers;
+            for (size_t first = i; first < j; first += run)
+                {
+                    Batch_Item item;
+                    item.block_start = block_requests[i].first * block_bytes;
+                    item.block_end = item.block_start + block_bytes;
+                    item.first = first;
+                    item.last = std::min(first + run, j);
+                    batch->items.push_back(item);
+                }
+            i = j;
+        }
+    batch->cond.notify_all();
+}
@@ -0,0 +1,182 @@
+/*!
+ * \file cpu_multicorrelator_batch.h
+ * \brief Carrier wipe-off and correlators of several tracking channels
+ * computed in a single cache-blocked pass over the shared input samples
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CPU_MULTICORRELATOR_BATCH_H_
+#define GNSS_SDR_CPU_MULTICORRELATOR_BATCH_H_
+
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+/*!
+ * \brief Correlation requested by one channel: the carrier wipe-off and
+ * the dot products of \p num_samples input samples with each one of the
+ * \p n_correlators resampled local codes.
+ */
+class Batch_Correlation
+{
+public:
+    const std::complex<float>* sig_in;
+    const float* const* local_codes;  // resampled local codes, num_samples each
+    std::complex<float>* corr_out;    // n_correlators outputs
+    double rem_carrier_phase_rad;
+    double phase_step_rad;
+    int num_samples;
+    int n_correlators;
+
+    Batch_Correlation();
+};
+
+
+/*!
+ * \brief This class implements a process-wide correlator engine shared by
+ * the tracking channels.
+ *
+ * All the channels fed by the same signal conditioner read the same input
+ * buffer, but each one streams through it on its own, so on a receiver with
+ * many channels the same samples are brought from memory once per channel.
+ * Here, the correlations requested by the channels that reach the engine
+ * within a short gathering window are bundled in a batch and computed block
+ * by block: the input is split in blocks of block_samples samples, and every
+ * channel of the batch overlapping a block applies its rotator and taps to
+ * it while the block is still in cache. The carrier phase at the start of
+ * each block is regenerated from the remnant phase and the phase step, so
+ * the blocks can be processed in any order and by any thread.
+ *
+ * There is no thread of its own: the channel threads waiting for the batch
+ * share the work, each one taking a run of (block, channels) pairs, so the
+ * tracking load is still spread over the cores. A batch is closed when it
+ * holds max_batch requests or when the gathering time of its first request
+ * expires, and a channel never waits for a late one beyond that time.
+ *
+ * The gathering time is only spent in full when the number of channels is
+ * not known: a batch also closes as soon as it holds as many requests as
+ * the last batch closed on time out, so with a single channel the requests
+ * are computed right away. One batch out of probe_interval still waits the
+ * whole gathering time, to notice the channels that start or stop.
+ */
+class cpu_multicorrelator_batch
+{
+public:
+    /*!
+     * \brief Sets the batch parameters. It only has effect if called before
+     * the first call to instance(). A value of 0 selects the default (one
+     * batch per 16 channels, 100 us of gathering time, blocks of 2048
+     * samples and as many threads per batch as requests).
+     */
+    static void configure(uint32_t max_batch, uint32_t gather_us, uint32_t block_samples, uint32_t max_threads);
+
+    /*!
+     * \brief Returns the engine shared by all the tracking channels,
+     * creating it at the first call.
+     */
+    static cpu_multicorrelator_batch& instance();
+
+    /*!
+     * \brief Computes \p request, batched with the requests of other
+     * channels arriving at the same time. Blocks until its outputs are
+     * written to request.corr_out.
+     */
+    void correlate(const Batch_Correlation& request);
+
+    inline uint32_t max_batch() const
+    {
+        return d_max_batch;
+    }
+
+    inline uint32_t block_samples() const
+    {
+        return d_block_samples;
+    }
+
+    cpu_multicorrelator_batch(const cpu_multicorrelator_batch&) = delete;
+    cpu_multicorrelator_batch& operator=(const cpu_multicorrelator_batch&) = delete;
+
+private:
+    cpu_multicorrelator_batch(uint32_t max_batch, uint32_t gather_us, uint32_t block_samples, uint32_t max_threads);
+
+    // Requests item_requests[first, last) of a batch over the samples of one block
+    struct Batch_Item
+    {
+        uintptr_t block_start;
+        uintptr_t block_end;
+        size_t first;
+        size_t last;
+    };
+
+    struct Batch
+    {
+        std::vector<const Batch_Correlation*> requests;
+        std::vector<std::vector<std::complex<float>>> sums;
+        std::vector<Batch_Item> items;
+        std::vector<size_t> item_requests;
+        size_t next_item;
+        size_t completed_items;
+        uint32_t workers;
+        uint32_t expected_requests;  // closes without waiting further once it holds them
+        bool closed;
+        std::condition_variable cond;
+        Batch();
+    };
+
+    // Buffers of a thread working on a batch, kept by the engine between batches
+    struct Worker_Scratch
+    {
+        std::vector<const float*> local_codes;      // local codes from the first sample of a span
+        std::vector<std::complex<float>> partials;  // outputs of the spans of an item, one after the other
+        std::vector<size_t> partial_requests;       // request of each span in partials
+    };
+
+    static const uint32_t probe_interval = 64U;
+
+    void close_batch(const std::shared_ptr<Batch>& batch);
+    static void correlate_span(const Batch_Correlation& request, int first_sample, int num_samples, std::complex<float>* partial, std::vector<const float*>& local_codes);
+
+    static uint32_t s_max_batch;
+    static uint32_t s_gather_us;
+    static uint32_t s_block_samples;
+    static uint32_t s_max_threads;
+
+    uint32_t d_max_batch;
+    uint32_t d_gather_us;
+    uint32_t d_block_samples;
+    uint32_t d_max_threads;
+    uint32_t d_expected_requests;  // requests of the last batch closed on time out
+    uint32_t d_batches_to_probe;   // batches left before the next one waiting the whole gathering time
+    std::shared_ptr<Batch> d_open_batch;  // batch still gathering requests
+    std::vector<std::unique_ptr<Worker_Scratch>> d_free_scratch;
+    std::mutex d_mutex;
+};
+
+#endif
@@ -34,7 +34,9 @@
  */
 
 #include "cpu_multicorrelator_real_codes.h"
+#include "cpu_multicorrelator_batch.h"
 #include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
 #include <cmath>
 
 cpu_multicorrelator_real_codes::cpu_multicorrelator_real_codes()
@@ -46,7 +48,13 @@ cpu_multicorrelator_real_codes::cpu_multicorrelator_real_codes()
     d_local_codes_resampled = nullptr;
     d_code_length_chips = 0;
     d_n_correlators = 0;
+    d_n_codes = 0;
     d_use_high_dynamics_resampler = true;
+    d_use_batch_correlation = false;
+    d_use_shared_replica = false;
+    d_use_fractional_correction = false;
+    d_shared_replica = nullptr;
+    d_shared_replica_size = 0;
 }
 
 
@@ -66,12 +74,29 @@ bool cpu_multicorrelator_real_codes::init(
     // ALLOCATE MEMORY FOR INTERNAL vectors
     size_t size = max_signal_length_samples * sizeof(float);
 
-    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
-    for (int n = 0; n < n_correlators; n++)
+    if (d_use_shared_replica)
         {
-            d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+            // The code pointers are views into the shared replica. With the
+            // fractional correction a tap may need the codes at two offsets.
+            d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(2 * n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
+            d_shared_replica = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+            d_shared_replica_size = max_signal_length_samples;
+            d_code_offsets.resize(2 * n_correlators);
+            d_tap_codes.resize(n_correlators);
+            d_tap_next_codes.resize(n_correlators);
+            d_tap_fractions.resize(n_correlators);
+            d_code_corr_out.resize(2 * n_correlators);
+        }
+    else
+        {
+            d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
+            for (int n = 0; n < n_correlators; n++)
+                {
+                    d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+                }
         }
     d_n_correlators = n_correlators;
+    d_n_codes = n_correlators;
     return true;
 }
 
@@ -100,7 +125,11 @@ bool cpu_multicorrelator_real_codes::set_input_output_vectors(std::complex<float
 
 void cpu_multicorrelator_real_codes::update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips)
 {
-    if (d_use_high_dynamics_resampler)
+    if (d_use_shared_replica)
+        {
+            update_shared_replica(correlator_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+        }
+    else if (d_use_high_dynamics_resampler)
         {
             volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(d_local_codes_resampled,
                 d_local_code_in,
@@ -125,6 +154,121 @@ void cpu_multicorrelator_real_codes::update_local_code(int correlator_length_sam
         }
 }
 
+
+void cpu_multicorrelator_real_codes::update_shared_replica(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips)
+{
+    // The taps only differ by a constant code phase, so they are all read
+    // from one replica. Their offsets are taken from the prompt tap (no code
+    // phase shift), which is exact, and rounded symmetrically, so that the
+    // early and late taps stay at the same distance from it.
+    int first_offset = 0;
+    int last_offset = 0;
+    d_n_codes = 0;
+    for (int n = 0; n < d_n_correlators; n++)
+        {
+            float offset_samples = d_shifts_chips[n] / code_phase_step_chips;
+            int whole_samples;
+            if (d_use_fractional_correction)
+                {
+                    whole_samples = static_cast<int>(std::floor(offset_samples));
+                    d_tap_fractions[n] = offset_samples - static_cast<float>(whole_samples);
+                }
+            else
+                {
+                    whole_samples = static_cast<int>(std::round(offset_samples));
+                    d_tap_fractions[n] = 0.0;
+                }
+            d_tap_codes[n] = shared_replica_code(whole_samples);
+            d_tap_next_codes[n] = d_tap_codes[n];
+            first_offset = std::min(first_offset, whole_samples);
+            last_offset = std::max(last_offset, whole_samples);
+            if (d_tap_fractions[n] > 0.0)
+                {
+                    d_tap_next_codes[n] = shared_replica_code(whole_samples + 1);
+                    last_offset = std::max(last_offset, whole_samples + 1);
+                }
+        }
+
+    // The replica starts at the earliest offset
+    float first_shift_chips = static_cast<float>(first_offset) * code_phase_step_chips;
+    int replica_length = correlator_length_samples + last_offset - first_offset;
+    if (replica_length > d_shared_replica_size)
+        {
+            volk_gnsssdr_free(d_shared_replica);
+            d_shared_replica = static_cast<float*>(volk_gnsssdr_malloc(replica_length * sizeof(float), volk_gnsssdr_get_alignment()));
+            d_shared_replica_size = replica_length;
+        }
+    if (d_use_high_dynamics_resampler)
+        {
+            volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(&d_shared_replica,
+                d_local_code_in,
+                rem_code_phase_chips,
+                code_phase_step_chips,
+                code_phase_rate_step_chips,
+                &first_shift_chips,
+                d_code_length_chips,
+                1,
+                replica_length);
+        }
+    else
+        {
+            volk_gnsssdr_32f_xn_resampler_32f_xn(&d_shared_replica,
+                d_local_code_in,
+                rem_code_phase_chips,
+                code_phase_step_chips,
+                &first_shift_chips,
+                d_code_length_chips,
+                1,
+                replica_length);
+        }
+    for (int n = 0; n < d_n_codes; n++)
+        {
+            d_local_codes_resampled[n] = d_shared_replica + (d_code_offsets[n] - first_offset);
+        }
+}
+
+
+int cpu_multicorrelator_real_codes::shared_replica_code(int offset_samples)
+{
+    // Taps that fall on the same sample share their code and correlation
+    for (int n = 0; n < d_n_codes; n++)
+        {
+            if (d_code_offsets[n] == offset_samples)
+                {
+                    return n;
+                }
+        }
+    d_code_offsets[d_n_codes] = offset_samples;
+    return d_n_codes++;
+}
+
+
+std::complex<float>* cpu_multicorrelator_real_codes::correlation_outputs()
+{
+    if (d_use_shared_replica)
+        {
+            return d_code_corr_out.data();
+        }
+    return d_corr_out;
+}
+
+
+void cpu_multicorrelator_real_codes::combine_fractional_taps()
+{
+    if (!d_use_shared_replica)
+        {
+            return;
+        }
+    // The correlation is linear in the local code, so the one of a tap that
+    // falls between two samples is interpolated from its two neighbours
+    for (int n = 0; n < d_n_correlators; n++)
+        {
+            const std::complex<float>& corr = d_code_corr_out[d_tap_codes[n]];
+            const std::complex<float>& next_corr = d_code_corr_out[d_tap_next_codes[n]];
+            d_corr_out[n] = corr + d_tap_fractions[n] * (next_corr - corr);
+        }
+}
+
 // Overload Carrier_wipeoff_multicorrelator_resampler to ensure back compatibility
 bool cpu_multicorrelator_real_codes::Carrier_wipeoff_multicorrelator_resampler(
     float rem_carrier_phase_in_rad,
@@ -142,12 +286,17 @@ bool cpu_multicorrelator_real_codes::Carrier_wipeoff_multicorrelator_resampler(
     // call VOLK_GNSSSDR kernel
     if (d_use_high_dynamics_resampler)
         {
-            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(correlation_outputs(), d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_codes, signal_length_samples);
+        }
+    else if (d_use_batch_correlation)
+        {
+            batch_correlate(rem_carrier_phase_in_rad, phase_step_rad, signal_length_samples);
         }
     else
         {
-            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(correlation_outputs(), d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_codes, signal_length_samples);
         }
+    combine_fractional_taps();
     return true;
 }
 // Overload Carrier_wipeoff_multicorrelator_resampler to ensure back compatibility
@@ -163,20 +312,51 @@ bool cpu_multicorrelator_real_codes::Carrier_wipeoff_multicorrelator_resampler(
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
     phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
-    // call VOLK_GNSSSDR kernel
-    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+    if (d_use_batch_correlation)
+        {
+            batch_correlate(rem_carrier_phase_in_rad, phase_step_rad, signal_length_samples);
+        }
+    else
+        {
+            // call VOLK_GNSSSDR kernel
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(correlation_outputs(), d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_codes, signal_length_samples);
+        }
+    combine_fractional_taps();
     return true;
 }
 
 
+void cpu_multicorrelator_real_codes::batch_correlate(float rem_carrier_phase_in_rad, float phase_step_rad, int signal_length_samples)
+{
+    Batch_Correlation request;
+    request.sig_in = d_sig_in;
+    request.local_codes = d_local_codes_resampled;
+    request.corr_out = correlation_outputs();
+    request.rem_carrier_phase_rad = rem_carrier_phase_in_rad;
+    request.phase_step_rad = phase_step_rad;
+    request.num_samples = signal_length_samples;
+    request.n_correlators = d_n_codes;
+    cpu_multicorrelator_batch::instance().correlate(request);
+}
+
+
 bool cpu_multicorrelator_real_codes::free()
 {
     // Free memory
     if (d_local_codes_resampled != nullptr)
         {
-            for (int n = 0; n < d_n_correlators; n++)
+            if (d_use_shared_replica)
                 {
-                    volk_gnsssdr_free(d_local_codes_resampled[n]);
+                    volk_gnsssdr_free(d_shared_replica);
+                    d_shared_replica = nullptr;
+                    d_shared_replica_size = 0;
+                }
+            else
+                {
+                    for (int n = 0; n < d_n_correlators; n++)
+                        {
+                            volk_gnsssdr_free(d_local_codes_resampled[n]);
+                        }
                 }
             volk_gnsssdr_free(d_local_codes_resampled);
             d_local_codes_resampled = nullptr;
@@ -190,3 +370,19 @@ void cpu_multicorrelator_real_codes::set_high_dynamics_resampler(
 {
     d_use_high_dynamics_resampler = use_high_dynamics_resampler;
 }
+
+
+void cpu_multicorrelator_real_codes::set_batch_correlation(
+    bool use_batch_correlation)
+{
+    d_use_batch_correlation = use_batch_correlation;
+}
+
+
+void cpu_multicorrelator_real_codes::set_shared_replica(
+    bool use_shared_replica,
+    bool use_fractional_correction)
+{
+    d_use_shared_replica = use_shared_replica;
+    d_use_fractional_correction = use_fractional_correction;
+}
@@ -38,6 +38,7 @@
 
 
 #include <complex>
+#include <vector>
 
 /*!
  * \brief Class that implements carrier wipe-off and correlators.
@@ -47,6 +48,10 @@ class cpu_multicorrelator_real_codes
 public:
     cpu_multicorrelator_real_codes();
     void set_high_dynamics_resampler(bool use_high_dynamics_resampler);
+    // Hand the correlations to the engine shared by all the channels (not used with the high dynamics resampler)
+    void set_batch_correlation(bool use_batch_correlation);
+    // Generate a single replica spanning all the taps, which are then read at whole-sample offsets (call before init)
+    void set_shared_replica(bool use_shared_replica, bool use_fractional_correction = false);
     ~cpu_multicorrelator_real_codes();
     bool init(int max_signal_length_samples, int n_correlators);
     bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
@@ -58,6 +63,11 @@ public:
     bool free();
 
 private:
+    void batch_correlate(float rem_carrier_phase_in_rad, float phase_step_rad, int signal_length_samples);
+    void update_shared_replica(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips);
+    int shared_replica_code(int offset_samples);
+    std::complex<float> *correlation_outputs();
+    void combine_fractional_taps();
     // Allocate the device input vectors
     const std::complex<float> *d_sig_in;
     float **d_local_codes_resampled;
@@ -65,8 +75,20 @@ private:
     std::complex<float> *d_corr_out;
     float *d_shifts_chips;
     bool d_use_high_dynamics_resampler;
+    bool d_use_batch_correlation;
+    bool d_use_shared_replica;
+    bool d_use_fractional_correction;
     int d_code_length_chips;
     int d_n_correlators;
+    int d_n_codes;  // codes handed to the dot product kernels
+    // Shared replica mode
+    float *d_shared_replica;
+    int d_shared_replica_size;
+    std::vector<int> d_code_offsets;     // whole-sample offset of each code from the prompt tap
+    std::vector<int> d_tap_codes;        // per tap: code at its offset, rounded down (or to the nearest)
+    std::vector<int> d_tap_next_codes;   // per tap: code one sample later (the same one if the offset is whole)
+    std::vector<float> d_tap_fractions;  // per tap: weight of the code one sample later
+    std::vector<std::complex<float>> d_code_corr_out;
 };
 
 
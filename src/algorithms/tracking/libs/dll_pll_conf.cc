@@ -37,6 +37,9 @@ Dll_Pll_Conf::Dll_Pll_Conf()
 {
     /* DLL/PLL tracking configuration */
     high_dyn = false;
+    batch_correlators = false;
+    shared_replica = false;
+    shared_replica_fractional = false;
     smoother_length = 10;
     fs_in = 0.0;
     vector_length = 0U;
@@ -57,6 +57,9 @@ public:
     float very_early_late_space_narrow_chips;
     int32_t extend_correlation_symbols;
     bool high_dyn;
+    bool batch_correlators;
+    bool shared_replica;
+    bool shared_replica_fractional;
     int32_t cn0_samples;
     int32_t carrier_lock_det_mav_samples;
     int32_t cn0_min;
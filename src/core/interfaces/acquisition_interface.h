@@ -40,6 +40,7 @@
 
 #include "gnss_block_interface.h"
 #include "gnss_synchro.h"
+#include <string>
 
 template <typename Data>
 class concurrent_queue;
@@ -66,6 +67,7 @@ public:
     virtual void reset() = 0;
     virtual void stop_acquisition() = 0;
     virtual void set_resampler_latency(uint32_t latency_samples) = 0;
+    virtual bool set_sample_ring(const std::string& ring_key) = 0;  // false if the block must be connected to the stream
 };
 
 #endif /* GNSS_SDR_ACQUISITION_INTERFACE */
@@ -37,6 +37,7 @@
 #ifndef GNSS_SDR_PVT_INTERFACE_H_
 #define GNSS_SDR_PVT_INTERFACE_H_
 
+#include "agnss_hot_start.h"
 #include "galileo_almanac.h"
 #include "galileo_ephemeris.h"
 #include "gnss_block_interface.h"
@@ -68,6 +69,12 @@ public:
         double* ground_speed_kmh,
         double* course_over_ground_deg,
         time_t* UTC_time) = 0;
+
+    /*!
+     * \brief Get the state of the last tracked channels, to be saved for a
+     * hot start of the next session. Returns false if there is none.
+     */
+    virtual bool get_hot_start(Agnss_Hot_Start& hot_start) = 0;
 };
 
 #endif /* GNSS_SDR_PVT_INTERFACE_H_ */
@@ -0,0 +1,226 @@
+/*!
+ * \file acquisition_scheduler.cc
+ * \brief Chooses the satellite signal that each free channel searches next,
+ * by expected visibility, failure history and an acquisition rate budget
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acquisition_scheduler.h"
+#include <algorithm>
+#include <cmath>
+
+
+AcquisitionScheduler::AcquisitionScheduler(double max_searches_per_s,
+    uint32_t failures_before_backoff,
+    double backoff_s,
+    double max_backoff_s,
+    double elevation_mask_deg,
+    double visibility_validity_s)
+{
+    max_searches_per_s_ = std::max(max_searches_per_s, 0.0);
+    failures_before_backoff_ = std::max(failures_before_backoff, 1U);
+    backoff_s_ = std::max(backoff_s, 0.0);
+    max_backoff_s_ = std::max(max_backoff_s, backoff_s_);
+    elevation_mask_deg_ = elevation_mask_deg;
+    visibility_validity_s_ = visibility_validity_s;
+}
+
+
+std::string AcquisitionScheduler::key(const Gnss_Satellite& satellite)
+{
+    return satellite.get_system() + " " + std::to_string(satellite.get_PRN());
+}
+
+
+std::string AcquisitionScheduler::key(const Gnss_Signal& signal)
+{
+    return key(signal.get_satellite()) + " " + signal.get_signal_str();
+}
+
+
+void AcquisitionScheduler::set_elevations(const std::vector<std::pair<int, Gnss_Satellite>>& elevations, double now_s)
+{
+    for (const auto& elevation : elevations)
+        {
+            Satellite_State& state = satellites_[key(elevation.second)];
+            state.elevation_valid = true;
+            state.elevation_deg = static_cast<double>(elevation.first);
+            state.elevation_time_s = now_s;
+        }
+}
+
+
+int AcquisitionScheduler::visibility_class(const Gnss_Satellite& satellite, double now_s, double& elevation_deg) const
+{
+    elevation_deg = 0.0;
+    auto it = satellites_.find(key(satellite));
+    if (it == satellites_.end())
+        {
+            return 2;
+        }
+    const Satellite_State& state = it->second;
+    if (state.acquired and now_s - state.acquisition_time_s < visibility_validity_s_)
+        {
+            return 0;
+        }
+    if (state.elevation_valid and now_s - state.elevation_time_s < visibility_validity_s_)
+        {
+            elevation_deg = state.elevation_deg;
+            return (state.elevation_deg > elevation_mask_deg_) ? 1 : -1;
+        }
+    return 2;
+}
+
+
+bool AcquisitionScheduler::eligible(const Gnss_Signal& signal, double now_s) const
+{
+    if (in_acquisition(signal))
+        {
+            return false;
+        }
+    auto it = signals_.find(key(signal));
+    if (it != signals_.end() and now_s < it->second.backoff_until_s)
+        {
+            return false;
+        }
+    double elevation_deg;
+    return visibility_class(signal.get_satellite(), now_s, elevation_deg) >= 0;
+}
+
+
+bool AcquisitionScheduler::select(std::list<Gnss_Signal>& candidates, double now_s) const
+{
+    auto best = candidates.end();
+    int best_class = 0;
+    uint32_t best_failures = 0;
+    double best_elevation_deg = 0.0;
+    for (auto it = candidates.begin(); it != candidates.end(); ++it)
+        {
+            if (!eligible(*it, now_s))
+                {
+                    continue;
+                }
+            double elevation_deg;
+            int satellite_class = visibility_class(it->get_satellite(), now_s, elevation_deg);
+            uint32_t failures = consecutive_failures(*it);
+            // Strict comparisons keep the list order among equivalent candidates
+            bool better = (best == candidates.end()) or
+                          (satellite_class < best_class) or
+                          (satellite_class == best_class and failures < best_failures) or
+                          (satellite_class == best_class and failures == best_failures and elevation_deg > best_elevation_deg);
+            if (better)
+                {
+                    best = it;
+                    best_class = satellite_class;
+                    best_failures = failures;
+                    best_elevation_deg = elevation_deg;
+                }
+        }
+    if (best == candidates.end())
+        {
+            return false;
+        }
+    candidates.splice(candidates.begin(), candidates, best);
+    return true;
+}
+
+
+bool AcquisitionScheduler::budget_available(double now_s)
+{
+    while (!search_times_s_.empty() and now_s - search_times_s_.front() >= 1.0)
+        {
+            search_times_s_.pop_front();
+        }
+    return max_searches_per_s_ <= 0.0 or static_cast<double>(search_times_s_.size()) < max_searches_per_s_;
+}
+
+
+void AcquisitionScheduler::search_started(uint32_t channel, const Gnss_Signal& signal, double now_s)
+{
+    searches_[channel] = signal;
+    search_times_s_.push_back(now_s);
+}
+
+
+void AcquisitionScheduler::search_failed(uint32_t channel, double now_s)
+{
+    auto it = searches_.find(channel);
+    if (it == searches_.end())
+        {
+            return;
+        }
+    Signal_History& history = signals_[key(it->second)];
+    history.consecutive_failures++;
+    if (backoff_s_ > 0.0 and history.consecutive_failures >= failures_before_backoff_)
+        {
+            double exponent = static_cast<double>(std::min(history.consecutive_failures - failures_before_backoff_, 16U));
+            history.backoff_until_s = now_s + std::min(backoff_s_ * std::pow(2.0, exponent), max_backoff_s_);
+        }
+    searches_.erase(it);
+}
+
+
+void AcquisitionScheduler::search_succeeded(uint32_t channel, double now_s)
+{
+    auto it = searches_.find(channel);
+    if (it == searches_.end())
+        {
+            return;
+        }
+    signals_.erase(key(it->second));
+    Satellite_State& state = satellites_[key(it->second.get_satellite())];
+    state.acquired = true;
+    state.acquisition_time_s = now_s;
+    searches_.erase(it);
+}
+
+
+void AcquisitionScheduler::search_stopped(uint32_t channel)
+{
+    searches_.erase(channel);
+}
+
+
+bool AcquisitionScheduler::in_acquisition(const Gnss_Signal& signal) const
+{
+    // Compared by key: Gnss_Signal::operator== ignores the signal type
+    const std::string signal_key = key(signal);
+    for (const auto& search : searches_)
+        {
+            if (key(search.second) == signal_key)
+                {
+                    return true;
+                }
+        }
+    return false;
+}
+
+
+uint32_t AcquisitionScheduler::consecutive_failures(const Gnss_Signal& signal) const
+{
+    auto it = signals_.find(key(signal));
+    return (it == signals_.end()) ? 0U : it->second.consecutive_failures;
+}
@@ -0,0 +1,165 @@
+/*!
+ * \file acquisition_scheduler.h
+ * \brief Chooses the satellite signal that each free channel searches next,
+ * by expected visibility, failure history and an acquisition rate budget
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQUISITION_SCHEDULER_H_
+#define GNSS_SDR_ACQUISITION_SCHEDULER_H_
+
+#include "gnss_satellite.h"
+#include "gnss_signal.h"
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+/*!
+ * \brief This class keeps the state the receiver needs to decide which
+ * signal a channel should search next.
+ *
+ * The candidates of each signal type are still held in the flow graph search
+ * lists, in their usual order. select() moves the best eligible one to the
+ * front, ranking them as follows:
+ *  - satellites acquired recently on any signal,
+ *  - satellites above the elevation mask, highest first,
+ *  - satellites without elevation information,
+ * and, within each class, the ones with fewer consecutive failures first.
+ * Signals already being searched by another channel, signals backing off
+ * after repeated failures and satellites known to be below the elevation mask
+ * are not eligible. Elevation information expires after a while, so that a
+ * wrong almanac or position cannot hide a satellite forever.
+ *
+ * Times are in seconds of any monotonic clock chosen by the caller.
+ */
+class AcquisitionScheduler
+{
+public:
+    /*!
+     * \brief Builds the scheduler. \p max_searches_per_s limits the number
+     * of searches started in any one second window (0 = no limit). A signal
+     * that fails \p failures_before_backoff times in a row is not searched
+     * again for \p backoff_s seconds, doubled at each further failure up to
+     * \p max_backoff_s (\p backoff_s = 0 disables the back-off).
+     */
+    AcquisitionScheduler(double max_searches_per_s = 0.0,
+        uint32_t failures_before_backoff = 3,
+        double backoff_s = 10.0,
+        double max_backoff_s = 300.0,
+        double elevation_mask_deg = -5.0,
+        double visibility_validity_s = 900.0);
+
+    /*!
+     * \brief Stores the elevation, in degrees, of each listed satellite,
+     * including those below the horizon
+     */
+    void set_elevations(const std::vector<std::pair<int, Gnss_Satellite>>& elevations, double now_s);
+
+    /*!
+     * \brief Moves the best eligible signal of \p candidates to the front of
+     * the list. Returns false, leaving the list untouched, if none is eligible.
+     */
+    bool select(std::list<Gnss_Signal>& candidates, double now_s) const;
+
+    /*!
+     * \brief True if one more search can start without exceeding the rate budget
+     */
+    bool budget_available(double now_s);
+
+    /*!
+     * \brief Records that \p channel starts searching \p signal
+     */
+    void search_started(uint32_t channel, const Gnss_Signal& signal, double now_s);
+
+    /*!
+     * \brief Records that the search of \p channel failed
+     */
+    void search_failed(uint32_t channel, double now_s);
+
+    /*!
+     * \brief Records that the search of \p channel succeeded
+     */
+    void search_succeeded(uint32_t channel, double now_s);
+
+    /*!
+     * \brief Records that the search of \p channel was stopped without a result
+     */
+    void search_stopped(uint32_t channel);
+
+    /*!
+     * \brief True if some channel is searching \p signal
+     */
+    bool in_acquisition(const Gnss_Signal& signal) const;
+
+    /*!
+     * \brief True if \p signal is eligible for a new search
+     */
+    bool eligible(const Gnss_Signal& signal, double now_s) const;
+
+    /*!
+     * \brief Consecutive failed searches of \p signal
+     */
+    uint32_t consecutive_failures(const Gnss_Signal& signal) const;
+
+private:
+    struct Signal_History
+    {
+        uint32_t consecutive_failures = 0;
+        double backoff_until_s = 0.0;
+    };
+
+    struct Satellite_State
+    {
+        bool elevation_valid = false;
+        double elevation_deg = 0.0;
+        double elevation_time_s = 0.0;
+        bool acquired = false;
+        double acquisition_time_s = 0.0;
+    };
+
+    static std::string key(const Gnss_Satellite& satellite);
+    static std::string key(const Gnss_Signal& signal);
+    int visibility_class(const Gnss_Satellite& satellite, double now_s, double& elevation_deg) const;  // -1 if below the mask
+
+    double max_searches_per_s_;
+    uint32_t failures_before_backoff_;
+    double backoff_s_;
+    double max_backoff_s_;
+    double elevation_mask_deg_;
+    double visibility_validity_s_;
+
+    std::map<std::string, Signal_History> signals_;
+    std::map<std::string, Satellite_State> satellites_;
+    std::map<uint32_t, Gnss_Signal> searches_;  // channel -> signal being searched
+    std::deque<double> search_times_s_;         // start times of the searches of the last second
+};
+
+#endif
@@ -35,6 +35,7 @@
 #include "control_thread.h"
 #include "concurrent_map.h"
 #include "concurrent_queue.h"
+#include "acq_search_window.h"
 #include "control_message_factory.h"
 #include "file_configuration.h"
 #include "galileo_almanac.h"
@@ -45,6 +46,7 @@
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
 #include "gnss_flowgraph.h"
+#include "gnss_sdr_fft.h"
 #include "gnss_sdr_flags.h"
 #include "gps_almanac.h"
 #include "gps_ephemeris.h"
@@ -106,6 +108,14 @@ void ControlThread::init()
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
     control_queue_ = gr::msg_queue::make(0);
     cmd_interface_.set_msg_queue(control_queue_);  //set also the queue pointer for the telecommand thread
+
+    // Load the FFTW wisdom before the blocks create their FFT plans
+    startup_time_ = std::chrono::steady_clock::now();
+    fftw_wisdom_file_ = configuration_->property("GNSS-SDR.fftw_wisdom_file", std::string(""));
+    if (!fftw_wisdom_file_.empty())
+        {
+            Gnss_Fft_Plan_Registry::instance().load_wisdom(fftw_wisdom_file_);
+        }
     try
         {
             flowgraph_ = std::make_shared<GNSSFlowgraph>(configuration_, control_queue_);
@@ -125,6 +135,16 @@ void ControlThread::init()
     msqid = -1;
     agnss_ref_location_ = Agnss_Ref_Location();
     agnss_ref_time_ = Agnss_Ref_Time();
+    agnss_rx_clock_drift_ppm_ = configuration_->property("GNSS-SDR.AGNSS_rx_clock_drift_ppm", 0.0);
+    agnss_rx_clock_drift_uncertainty_ppm_ = configuration_->property("GNSS-SDR.AGNSS_rx_clock_drift_uncertainty_ppm", 0.5);
+    agnss_search_window_growth_m_s2_ = configuration_->property("GNSS-SDR.AGNSS_search_window_growth_m_s2", 0.2);
+    agnss_search_window_max_age_s_ = configuration_->property("GNSS-SDR.AGNSS_search_window_max_age_s", 600.0);
+    hot_start_file_ = configuration_->property("GNSS-SDR.hot_start_file", std::string(""));
+    hot_start_max_age_s_ = configuration_->property("GNSS-SDR.hot_start_max_age_s", 600.0);
+    hot_start_range_rate_uncertainty_m_s_ = configuration_->property("GNSS-SDR.hot_start_range_rate_uncertainty_m_s", 10.0);
+    hot_start_time_uncertainty_s_ = configuration_->property("GNSS-SDR.hot_start_time_uncertainty_s", 0.0);
+    hot_start_load_time_s_ = 0.0;
+    hot_start_.clear();
 
     std::string empty_string = "";
     std::string ref_location_str = configuration_->property("GNSS-SDR.AGNSS_ref_location", empty_string);
@@ -217,6 +237,10 @@ void ControlThread::telecommand_listener()
  */
 int ControlThread::run()
 {
+    // The satellites of the previous session must be at the front of the
+    // search lists before the flowgraph assigns them to the channels
+    load_hot_start();
+
     // Connect the flowgraph
     try
         {
@@ -236,7 +260,16 @@ int ControlThread::run()
             LOG(ERROR) << "Unable to connect flowgraph";
             return 0;
         }
+    Gnss_Fft_Plan_Registry& fft_plans = Gnss_Fft_Plan_Registry::instance();
+    LOG(INFO) << "Receiver startup took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startup_time_).count()
+              << " ms (" << fft_plans.created() << " FFT plans created, " << fft_plans.reused() << " reused)";
+    if (!fftw_wisdom_file_.empty())
+        {
+            fft_plans.save_wisdom(fftw_wisdom_file_);
+        }
     // Start the flowgraph
+    set_hot_start_windows();
     flowgraph_->start();
     if (flowgraph_->running())
         {
@@ -250,9 +283,12 @@ int ControlThread::run()
 
     // launch GNSS assistance process AFTER the flowgraph is running because the GNU Radio asynchronous queues must be already running to transport msgs
     assist_GNSS();
+    // The assistance may have replaced the hot start windows by wider ones
+    set_hot_start_windows();
     // start the keyboard_listener thread
     keyboard_thread_ = boost::thread(&ControlThread::keyboard_listener, this);
     sysv_queue_thread_ = boost::thread(&ControlThread::sysv_queue_listener, this);
+    acquisition_scheduler_thread_ = boost::thread(&ControlThread::acquisition_scheduler_listener, this);
 
     // start the telecommand listener thread
     cmd_interface_.set_pvt(flowgraph_->get_pvt());
@@ -270,21 +306,25 @@ int ControlThread::run()
             //TODO re-enable the blocking read messages functions and fork the process
             read_control_messages();
             if (control_messages_ != 0) process_control_messages();
+            expire_hot_start_windows();
         }
     std::cout << "Stopping GNSS-SDR, please wait!" << std::endl;
     flowgraph_->stop();
     stop_ = true;
+    save_hot_start();
     flowgraph_->disconnect();
 
 // Join keyboard thread
 #ifdef OLD_BOOST
     keyboard_thread_.timed_join(boost::posix_time::seconds(1));
     sysv_queue_thread_.timed_join(boost::posix_time::seconds(1));
+    acquisition_scheduler_thread_.timed_join(boost::posix_time::seconds(1));
     cmd_interface_thread_.timed_join(boost::posix_time::seconds(1));
 #endif
 #ifndef OLD_BOOST
     keyboard_thread_.try_join_until(boost::chrono::steady_clock::now() + boost::chrono::milliseconds(1000));
     sysv_queue_thread_.try_join_until(boost::chrono::steady_clock::now() + boost::chrono::milliseconds(1000));
+    acquisition_scheduler_thread_.try_join_until(boost::chrono::steady_clock::now() + boost::chrono::milliseconds(1000));
     cmd_interface_thread_.try_join_until(boost::chrono::steady_clock::now() + boost::chrono::milliseconds(1000));
 #endif
 
@@ -765,6 +805,163 @@ void ControlThread::assist_GNSS()
 }
 
 
+void ControlThread::load_hot_start()
+{
+    if (hot_start_file_.empty())
+        {
+            return;
+        }
+    if (!hot_start_.load(hot_start_file_))
+        {
+            LOG(INFO) << "No hot start state found in " << hot_start_file_;
+            return;
+        }
+    double now_s = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+    double age_s = now_s - hot_start_.save_time_s;
+    if (age_s < 0.0 or age_s > hot_start_max_age_s_)
+        {
+            LOG(INFO) << "Discarding the hot start state in " << hot_start_file_ << ", saved " << age_s << " s ago";
+            hot_start_.clear();
+            return;
+        }
+    hot_start_load_time_s_ = Acq_Search_Window::now_s();
+
+    // The clock drift and position measured in the last session are better
+    // than the a priori ones for the windows computed from the assistance
+    if (hot_start_.clock_drift_valid)
+        {
+            agnss_rx_clock_drift_ppm_ = hot_start_.clock_drift_ppm;
+        }
+    if (hot_start_.position_valid and !agnss_ref_location_.valid)
+        {
+            arma::vec LLH = cart2geo(arma::vec{hot_start_.position_ecef_m[0], hot_start_.position_ecef_m[1], hot_start_.position_ecef_m[2]}, 4);
+            agnss_ref_location_.lat = radtodeg(LLH(0));
+            agnss_ref_location_.lon = radtodeg(LLH(1));
+            agnss_ref_location_.valid = true;
+        }
+
+    // Strongest satellites first
+    std::vector<std::pair<int, Gnss_Satellite>> tracked_satellites;
+    for (const auto &channel : hot_start_.channels)
+        {
+            std::string system;
+            switch (channel.system)
+                {
+                case 'G':
+                    system = "GPS";
+                    break;
+                case 'E':
+                    system = "Galileo";
+                    break;
+                case 'R':
+                    system = "Glonass";
+                    break;
+                default:
+                    continue;
+                }
+            tracked_satellites.push_back(std::pair<int, Gnss_Satellite>(static_cast<int>(channel.cn0_db_hz), Gnss_Satellite(system, channel.prn)));
+        }
+    std::sort(tracked_satellites.begin(), tracked_satellites.end(), [](const std::pair<int, Gnss_Satellite> &a, const std::pair<int, Gnss_Satellite> &b) {
+        return a.first > b.first;
+    });
+    flowgraph_->priorize_satellites(tracked_satellites);
+    std::cout << "Hot start: " << hot_start_.channels.size() << " channel states saved " << age_s << " s ago loaded from " << hot_start_file_ << std::endl;
+}
+
+
+void ControlThread::set_hot_start_windows()
+{
+    if (hot_start_.channels.empty())
+        {
+            return;
+        }
+    // The Doppler is extrapolated as a constant, so the window widens with the
+    // time since the save by the largest line-of-sight acceleration of a
+    // satellite seen from a static receiver, and keeps widening at the same
+    // rate while it is used in this session
+    const double max_range_acceleration_m_s2 = 0.2;
+    double now_s = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+    double elapsed_s = std::max(now_s - hot_start_.save_time_s, 0.0);
+    double reference_time_s = Acq_Search_Window::now_s();
+    double remaining_s = hot_start_max_age_s_ - (reference_time_s - hot_start_load_time_s_);
+    if (remaining_s <= 0.0)
+        {
+            return;  // expired
+        }
+    for (const auto &channel : hot_start_.channels)
+        {
+            if (Agnss_Hot_Start::carrier_hz(channel.signal) <= 0.0)
+                {
+                    continue;  // no search window prediction for FDMA signals
+                }
+            double dt = hot_start_.extrapolation_time_s(channel, elapsed_s);
+            Acq_Search_Window window;
+            window.range_rate_m_s = Agnss_Hot_Start::range_rate_m_s(channel);
+            window.range_rate_uncertainty_m_s = hot_start_range_rate_uncertainty_m_s_ + max_range_acceleration_m_s2 * dt;
+            window.reference_time_s = reference_time_s;
+            window.uncertainty_growth_m_s2 = max_range_acceleration_m_s2;
+            window.max_age_s = remaining_s;
+            if (hot_start_time_uncertainty_s_ > 0.0)
+                {
+                    // The first sample of this session is taken as issued now
+                    window.code_phase_valid = true;
+                    window.code_phase_s = hot_start_.code_phase_s(channel, elapsed_s);
+                    window.code_phase_window_s = hot_start_time_uncertainty_s_ + window.range_rate_uncertainty_m_s * dt / SPEED_OF_LIGHT;
+                    window.reference_sample_stamp = 0ULL;
+                }
+            Acq_Search_Window_Store::instance().set(channel.system, channel.prn, window);
+            DLOG(INFO) << "Hot start window of " << channel.system << " " << channel.prn << ": range rate " << window.range_rate_m_s
+                       << " +/- " << window.range_rate_uncertainty_m_s << " m/s";
+        }
+}
+
+
+void ControlThread::expire_hot_start_windows()
+{
+    if (hot_start_.channels.empty())
+        {
+            return;
+        }
+    // The age limit counts from the load: the windows are widened with the
+    // time since the save, but not for ever
+    if (Acq_Search_Window::now_s() - hot_start_load_time_s_ < hot_start_max_age_s_)
+        {
+            return;
+        }
+    // Past the age limit the extrapolated windows could hide a satellite
+    // lost and searched again, so it goes back to the full search
+    for (const auto &channel : hot_start_.channels)
+        {
+            Acq_Search_Window_Store::instance().erase(channel.system, channel.prn);
+        }
+    LOG(INFO) << "Hot start windows expired";
+    hot_start_.clear();
+}
+
+
+void ControlThread::save_hot_start()
+{
+    if (hot_start_file_.empty())
+        {
+            return;
+        }
+    Agnss_Hot_Start hot_start;
+    if (!flowgraph_->get_pvt()->get_hot_start(hot_start))
+        {
+            LOG(INFO) << "No tracked channel to save for a hot start";
+            return;
+        }
+    if (hot_start.save(hot_start_file_))
+        {
+            LOG(INFO) << "Saved " << hot_start.channels.size() << " channel states to " << hot_start_file_;
+        }
+    else
+        {
+            LOG(WARNING) << "Unable to save the hot start state to " << hot_start_file_;
+        }
+}
+
+
 void ControlThread::read_control_messages()
 {
     DLOG(INFO) << "Reading control messages from queue";
@@ -827,6 +1024,7 @@ void ControlThread::apply_action(unsigned int what)
             // delete all ephemeris and almanac information from maps (also the PVT map queue)
             pvt_ptr = flowgraph_->get_pvt();
             pvt_ptr->clear_ephemeris();
+            Acq_Search_Window_Store::instance().clear();
             // todo: reorder the satellite queues to the receiver default startup order.
             // This is required to allow repeatability. Otherwise the satellite search order will depend on the last tracked satellites
             break;
@@ -851,6 +1049,10 @@ void ControlThread::apply_action(unsigned int what)
             flowgraph_->priorize_satellites(visible_satellites);
             // start again the satellite acquisitions (done in chained apply_action to flowgraph)
             break;
+        case 14:
+            DLOG(INFO) << "Acquisition scheduler wake-up";
+            flowgraph_->schedule_acquisitions();
+            break;
         default:
             LOG(INFO) << "Unrecognized action.";
             break;
@@ -876,6 +1078,7 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
     // 3. loop through all the available ephemeris or almanac and compute satellite positions and elevations
     // store visible satellites in a vector of pairs <int,Gnss_Satellite> to associate an elevation to the each satellite
     std::vector<std::pair<int, Gnss_Satellite>> available_satellites;
+    std::vector<std::pair<int, Gnss_Satellite>> elevations;  // also below the horizon, for the acquisition scheduler
     std::vector<unsigned int> visible_gps;
     std::vector<unsigned int> visible_gal;
     std::shared_ptr<PvtInterface> pvt_ptr = flowgraph_->get_pvt();
@@ -900,6 +1103,7 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             arma::vec r_sat_eb_e = arma::vec{r_sat[0], r_sat[1], r_sat[2]};
             arma::vec dx = r_sat_eb_e - r_eb_e;
             topocent(&Az, &El, &dist_m, r_eb_e, dx);
+            elevations.push_back(std::pair<int, Gnss_Satellite>(floor(El), Gnss_Satellite(std::string("GPS"), it->second.i_satellite_PRN)));
             // push sat
             if (El > 0)
                 {
@@ -907,6 +1111,11 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                     available_satellites.push_back(std::pair<int, Gnss_Satellite>(floor(El),
                         (Gnss_Satellite(std::string("GPS"), it->second.i_satellite_PRN))));
                     visible_gps.push_back(it->second.i_satellite_PRN);
+                    double r_sat_next[3];
+                    double clock_bias_next_s;
+                    eph2pos(timeadd(gps_gtime, 1.0), &rtklib_eph, &r_sat_next[0], &clock_bias_next_s,
+                        &sat_pos_variance_m2);
+                    set_search_window('G', it->second.i_satellite_PRN, r_eb_e, &r_sat[0], clock_bias_s, &r_sat_next[0], clock_bias_next_s, 50.0);
                 }
         }
 
@@ -923,6 +1132,7 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             arma::vec r_sat_eb_e = arma::vec{r_sat[0], r_sat[1], r_sat[2]};
             arma::vec dx = r_sat_eb_e - r_eb_e;
             topocent(&Az, &El, &dist_m, r_eb_e, dx);
+            elevations.push_back(std::pair<int, Gnss_Satellite>(floor(El), Gnss_Satellite(std::string("Galileo"), it->second.i_satellite_PRN)));
             // push sat
             if (El > 0)
                 {
@@ -930,6 +1140,11 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                     available_satellites.push_back(std::pair<int, Gnss_Satellite>(floor(El),
                         (Gnss_Satellite(std::string("Galileo"), it->second.i_satellite_PRN))));
                     visible_gal.push_back(it->second.i_satellite_PRN);
+                    double r_sat_next[3];
+                    double clock_bias_next_s;
+                    eph2pos(timeadd(gps_gtime, 1.0), &rtklib_eph, &r_sat_next[0], &clock_bias_next_s,
+                        &sat_pos_variance_m2);
+                    set_search_window('E', it->second.i_satellite_PRN, r_eb_e, &r_sat[0], clock_bias_s, &r_sat_next[0], clock_bias_next_s, 50.0);
                 }
         }
 
@@ -940,12 +1155,17 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             double r_sat[3];
             double clock_bias_s;
             gtime_t aux_gtime;
+            aux_gtime.sec = 0.0;
             aux_gtime.time = fmod(utc2gpst(gps_gtime).time + 345600, 604800);
             alm2pos(aux_gtime, &rtklib_alm, &r_sat[0], &clock_bias_s);
             double Az, El, dist_m;
             arma::vec r_sat_eb_e = arma::vec{r_sat[0], r_sat[1], r_sat[2]};
             arma::vec dx = r_sat_eb_e - r_eb_e;
             topocent(&Az, &El, &dist_m, r_eb_e, dx);
+            if (gps_eph_map.find(it->second.i_satellite_PRN) == gps_eph_map.end())
+                {
+                    elevations.push_back(std::pair<int, Gnss_Satellite>(floor(El), Gnss_Satellite(std::string("GPS"), it->second.i_satellite_PRN)));
+                }
             // push sat
             std::vector<unsigned int>::iterator it2;
             if (El > 0)
@@ -956,6 +1176,11 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                             std::cout << "Using GPS Almanac:  Sat " << it->second.i_satellite_PRN << " Az: " << Az << " El: " << El << std::endl;
                             available_satellites.push_back(std::pair<int, Gnss_Satellite>(floor(El),
                                 (Gnss_Satellite(std::string("GPS"), it->second.i_satellite_PRN))));
+                            double r_sat_next[3];
+                            double clock_bias_next_s;
+                            aux_gtime.time += 1;
+                            alm2pos(aux_gtime, &rtklib_alm, &r_sat_next[0], &clock_bias_next_s);
+                            set_search_window('G', it->second.i_satellite_PRN, r_eb_e, &r_sat[0], clock_bias_s, &r_sat_next[0], clock_bias_next_s, 150.0);
                         }
                 }
         }
@@ -967,12 +1192,17 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
             double r_sat[3];
             double clock_bias_s;
             gtime_t gal_gtime;
+            gal_gtime.sec = 0.0;
             gal_gtime.time = fmod(utc2gpst(gps_gtime).time + 345600, 604800);
             alm2pos(gal_gtime, &rtklib_alm, &r_sat[0], &clock_bias_s);
             double Az, El, dist_m;
             arma::vec r_sat_eb_e = arma::vec{r_sat[0], r_sat[1], r_sat[2]};
             arma::vec dx = r_sat_eb_e - r_eb_e;
             topocent(&Az, &El, &dist_m, r_eb_e, dx);
+            if (gal_eph_map.find(it->second.i_satellite_PRN) == gal_eph_map.end())
+                {
+                    elevations.push_back(std::pair<int, Gnss_Satellite>(floor(El), Gnss_Satellite(std::string("Galileo"), it->second.i_satellite_PRN)));
+                }
             // push sat
             std::vector<unsigned int>::iterator it2;
             if (El > 0)
@@ -983,6 +1213,11 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
                             std::cout << "Using Galileo Almanac:  Sat " << it->second.i_satellite_PRN << " Az: " << Az << " El: " << El << std::endl;
                             available_satellites.push_back(std::pair<int, Gnss_Satellite>(floor(El),
                                 (Gnss_Satellite(std::string("Galileo"), it->second.i_satellite_PRN))));
+                            double r_sat_next[3];
+                            double clock_bias_next_s;
+                            gal_gtime.time += 1;
+                            alm2pos(gal_gtime, &rtklib_alm, &r_sat_next[0], &clock_bias_next_s);
+                            set_search_window('E', it->second.i_satellite_PRN, r_eb_e, &r_sat[0], clock_bias_s, &r_sat_next[0], clock_bias_next_s, 150.0);
                         }
                 }
         }
@@ -993,10 +1228,32 @@ std::vector<std::pair<int, Gnss_Satellite>> ControlThread::get_visible_sats(time
     });
     // provide list starting from satellites with higher elevation
     std::reverse(available_satellites.begin(), available_satellites.end());
+    flowgraph_->set_satellite_elevations(elevations);
     return available_satellites;
 }
 
 
+void ControlThread::set_search_window(char system, uint32_t prn, const arma::vec &r_eb_e,
+    const double *r_sat, double clock_bias_s, const double *r_sat_next, double clock_bias_next_s,
+    double uncertainty_m_s)
+{
+    // The receiver is static in ECEF, so the pseudorange rate is the change of the
+    // geometric range in one second, plus the satellite and receiver clock drifts
+    double range = arma::norm(arma::vec{r_sat[0], r_sat[1], r_sat[2]} - r_eb_e);
+    double range_next = arma::norm(arma::vec{r_sat_next[0], r_sat_next[1], r_sat_next[2]} - r_eb_e);
+    Acq_Search_Window window;
+    window.range_rate_m_s = (range_next - range) - SPEED_OF_LIGHT * (clock_bias_next_s - clock_bias_s) + SPEED_OF_LIGHT * agnss_rx_clock_drift_ppm_ * 1e-6;
+    window.range_rate_uncertainty_m_s = uncertainty_m_s + SPEED_OF_LIGHT * agnss_rx_clock_drift_uncertainty_ppm_ * 1e-6;
+    // The range rate is held constant, so the window widens by the largest
+    // line-of-sight acceleration of a satellite seen from a static receiver
+    window.uncertainty_growth_m_s2 = agnss_search_window_growth_m_s2_;
+    window.max_age_s = agnss_search_window_max_age_s_;
+    Acq_Search_Window_Store::instance().set(system, prn, window);
+    DLOG(INFO) << "Search window of " << system << " " << prn << ": range rate " << window.range_rate_m_s
+               << " +/- " << window.range_rate_uncertainty_m_s << " m/s";
+}
+
+
 void ControlThread::gps_acq_assist_data_collector()
 {
     // ############ 1.bis READ EPHEMERIS/UTC_MODE/IONO QUEUE ####################
@@ -1090,3 +1347,20 @@ void ControlThread::keyboard_listener()
             usleep(500000);
         }
 }
+
+
+void ControlThread::acquisition_scheduler_listener()
+{
+    // Channels deferred by the acquisition scheduler (search rate budget,
+    // back-off of failing signals) do not produce control messages by
+    // themselves, so the control thread is reminded of them periodically
+    std::unique_ptr<ControlMessageFactory> cmf(new ControlMessageFactory());
+    while (!stop_)
+        {
+            usleep(250000);
+            if (!stop_ and flowgraph_->acquisition_pending() and control_queue_ != gr::msg_queue::sptr())
+                {
+                    control_queue_->handle(cmf->GetQueueMessage(200, 14));
+                }
+        }
+}
@@ -35,6 +35,7 @@
 #ifndef GNSS_SDR_CONTROL_THREAD_H_
 #define GNSS_SDR_CONTROL_THREAD_H_
 
+#include "agnss_hot_start.h"
 #include "agnss_ref_location.h"
 #include "agnss_ref_time.h"
 #include "configuration_interface.h"
@@ -46,6 +47,7 @@
 #include <armadillo>
 #include <boost/thread.hpp>
 #include <gnuradio/msg_queue.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -152,11 +154,41 @@ private:
      */
     std::vector<std::pair<int, Gnss_Satellite>> get_visible_sats(time_t rx_utc_time, const arma::vec& LLH);
 
+    /*
+     * Publish the acquisition search window of a visible satellite, from its positions and clock biases
+     * one second apart, so that the acquisition blocks only search around its predicted Doppler
+     */
+    void set_search_window(char system, uint32_t prn, const arma::vec& r_eb_e,
+        const double* r_sat, double clock_bias_s, const double* r_sat_next, double clock_bias_next_s,
+        double uncertainty_m_s);
+
     /*
      * Read initial GNSS assistance from SUPL server or local XML files
      */
     void assist_GNSS();
 
+    /*
+     * Read the channel states saved by the previous session, if recent enough,
+     * and give priority to the satellites it was tracking
+     */
+    void load_hot_start();
+
+    /*
+     * Publish the acquisition search windows of the satellites tracked by the
+     * previous session, extrapolated to the current time
+     */
+    void set_hot_start_windows();
+
+    /*
+     * Remove the hot start windows once the age limit has elapsed since they were loaded
+     */
+    void expire_hot_start_windows();
+
+    /*
+     * Save the state of the tracked channels for the next session
+     */
+    void save_hot_start();
+
     void apply_action(unsigned int what);
     std::shared_ptr<GNSSFlowgraph> flowgraph_;
     std::shared_ptr<ConfigurationInterface> configuration_;
@@ -168,12 +200,27 @@ private:
     bool delete_configuration_;
     unsigned int processed_control_messages_;
     unsigned int applied_actions_;
+    std::string fftw_wisdom_file_;  // FFTW wisdom loaded at startup and saved once the flowgraph is connected
+    std::chrono::steady_clock::time_point startup_time_;
+    double agnss_rx_clock_drift_ppm_;              // a priori receiver clock (and front-end oscillator) drift
+    double agnss_rx_clock_drift_uncertainty_ppm_;
+    double agnss_search_window_growth_m_s2_;       // widening of the assistance search windows with their age
+    double agnss_search_window_max_age_s_;         // older assistance search windows are not used
+    std::string hot_start_file_;                        // channel states saved on shutdown and loaded on startup
+    Agnss_Hot_Start hot_start_;
+    double hot_start_max_age_s_;                        // older states are discarded, and the windows expire this long after the load
+    double hot_start_load_time_s_;                      // steady clock time of the load
+    double hot_start_range_rate_uncertainty_m_s_;       // window half width right after the restart
+    double hot_start_time_uncertainty_s_;               // alignment of the first input sample with the system clock, 0 if unknown
     boost::thread keyboard_thread_;
     boost::thread sysv_queue_thread_;
     boost::thread gps_acq_assist_data_collector_thread_;
 
+    boost::thread acquisition_scheduler_thread_;
+
     void keyboard_listener();
     void sysv_queue_listener();
+    void acquisition_scheduler_listener();  // wakes up the channels deferred by the acquisition scheduler
     int msqid;
 
     // default filename for assistance data
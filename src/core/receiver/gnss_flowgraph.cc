@@ -37,16 +37,24 @@
 #include "GPS_L2C.h"
 #include "GPS_L5.h"
 #include "Galileo_E1.h"
+#include "GLONASS_L1_L2_CA.h"
 #include "Galileo_E5a.h"
+#include "acq_decimator_cc.h"
+#include "acq_sample_ring_sink.h"
+#include "acq_worker_pool.h"
 #include "channel.h"
 #include "channel_interface.h"
+#include "cpu_multicorrelator_batch.h"
 #include "configuration_interface.h"
+#include "glonass_fdma_channelizer_cc.h"
+#include "glonass_fdma_subband_selector_cc.h"
 #include "gnss_block_factory.h"
 #include <boost/lexical_cast.hpp>
 #include <boost/tokenizer.hpp>
 #include <glog/logging.h>
 #include <gnuradio/filter/firdes.h>
 #include <algorithm>
+#include <chrono>
 #include <exception>
 #include <iostream>
 #include <set>
@@ -355,6 +363,7 @@ void GNSSFlowgraph::connect()
     // Signal conditioner (selected_signal_source) >> channels (i) (dependent of their associated SignalSource_ID)
     int selected_signal_conditioner_ID = 0;
     bool use_acq_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
+    bool use_acq_decimator = configuration_->property("GNSS-SDR.use_acquisition_decimator", false);
     uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
     for (unsigned int i = 0; i < channels_count_; i++)
         {
@@ -370,32 +379,46 @@ void GNSSFlowgraph::connect()
                         }
                     try
                         {
+                            if (connect_fdma_channel(i, selected_signal_conditioner_ID))
+                                {
+                                    DLOG(INFO) << "Channel " << i << " takes its GLONASS sub-band from the FDMA channelizer";
+                                }
                             // Enable automatic resampler for the acquisition, if required
-                            if (use_acq_resampler == true)
+                            else if (use_acq_resampler == true)
                                 {
                                     //create acquisition resamplers if required
                                     double resampler_ratio = 1.0;
                                     double acq_fs = fs;
+                                    double chip_rate = 0.0;  // of the acquired code, for the decimator
+                                    double samples_per_chip = 2.0;
                                     //find the signal associated to this channel
                                     switch (mapStringValues_[channels_.at(i)->implementation()])
                                         {
                                         case evGPS_1C:
                                             acq_fs = GPS_L1_CA_OPT_ACQ_FS_HZ;
+                                            chip_rate = GPS_L1_CA_CODE_RATE_HZ;
                                             break;
                                         case evGPS_2S:
                                             acq_fs = GPS_L2C_OPT_ACQ_FS_HZ;
+                                            chip_rate = GPS_L2_M_CODE_RATE_HZ;
+                                            samples_per_chip = 4.0;  // the M and L chips are time multiplexed
                                             break;
                                         case evGPS_L5:
                                             acq_fs = GPS_L5_OPT_ACQ_FS_HZ;
+                                            chip_rate = GPS_L5i_CODE_RATE_HZ;
                                             break;
                                         case evSBAS_1C:
                                             acq_fs = GPS_L1_CA_OPT_ACQ_FS_HZ;
+                                            chip_rate = GPS_L1_CA_CODE_RATE_HZ;
                                             break;
                                         case evGAL_1B:
                                             acq_fs = Galileo_E1_OPT_ACQ_FS_HZ;
+                                            chip_rate = Galileo_E1_CODE_CHIP_RATE_HZ;
+                                            samples_per_chip = 4.0;  // two subcarrier half-periods per chip
                                             break;
                                         case evGAL_5X:
                                             acq_fs = Galileo_E5a_OPT_ACQ_FS_HZ;
+                                            chip_rate = Galileo_E5a_CODE_CHIP_RATE_HZ;
                                             break;
                                         case evGLO_1G:
                                             acq_fs = fs;
@@ -404,6 +427,11 @@ void GNSSFlowgraph::connect()
                                             acq_fs = fs;
                                             break;
                                         }
+                                    if (use_acq_decimator and chip_rate > 0.0)
+                                        {
+                                            // Lowest rate that keeps the code resolution, with a smooth FFT size
+                                            acq_fs = static_cast<double>(fs) / static_cast<double>(Acq_Decimator::choose_decimation(fs, chip_rate, samples_per_chip));
+                                        }
 
                                     if (acq_fs < fs)
                                         {
@@ -419,15 +447,27 @@ void GNSSFlowgraph::connect()
 
                                             if (decimation > 1)
                                                 {
-                                                    //create a FIR low pass filter
                                                     std::vector<float> taps;
-                                                    taps = gr::filter::firdes::low_pass(1.0,
-                                                        fs,
-                                                        acq_fs / 2.1,
-                                                        acq_fs / 10,
-                                                        gr::filter::firdes::win_type::WIN_HAMMING);
-
-                                                    gr::basic_block_sptr fir_filter_ccf_ = gr::filter::fir_filter_ccf::make(decimation, taps);
+                                                    uint32_t latency_samples = 0U;
+                                                    gr::basic_block_sptr fir_filter_ccf_;
+                                                    if (use_acq_decimator)
+                                                        {
+                                                            // Polyphase decimator, its filter delay is already compensated
+                                                            fir_filter_ccf_ = acq_make_decimator_cc(decimation);
+                                                            taps = Acq_Decimator(decimation).taps();
+                                                        }
+                                                    else
+                                                        {
+                                                            //create a FIR low pass filter
+                                                            taps = gr::filter::firdes::low_pass(1.0,
+                                                                fs,
+                                                                acq_fs / 2.1,
+                                                                acq_fs / 10,
+                                                                gr::filter::firdes::win_type::WIN_HAMMING);
+
+                                                            fir_filter_ccf_ = gr::filter::fir_filter_ccf::make(decimation, taps);
+                                                            latency_samples = (taps.size() - 1) / 2;
+                                                        }
 
                                                     std::pair<std::map<std::string, gr::basic_block_sptr>::iterator, bool> ret;
                                                     ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
@@ -447,22 +487,20 @@ void GNSSFlowgraph::connect()
                                                         }
 
 
-                                                    top_block_->connect(acq_resamplers_.at(map_key), 0,
-                                                        channels_.at(i)->get_left_block_acq(), 0);
+                                                    connect_acquisition(i, acq_resamplers_.at(map_key), "resampler_" + map_key);
 
                                                     top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
                                                         channels_.at(i)->get_left_block_trk(), 0);
 
                                                     std::shared_ptr<Channel> channel_ptr;
                                                     channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
-                                                    channel_ptr->acquisition()->set_resampler_latency((taps.size() - 1) / 2);
+                                                    channel_ptr->acquisition()->set_resampler_latency(latency_samples);
                                                 }
                                             else
                                                 {
                                                     LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
                                                     //resampler not required!
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                                                        channels_.at(i)->get_left_block_acq(), 0);
+                                                    connect_acquisition(i, sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), "conditioner_" + std::to_string(selected_signal_conditioner_ID));
                                                     top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
                                                         channels_.at(i)->get_left_block_trk(), 0);
                                                 }
@@ -470,16 +508,14 @@ void GNSSFlowgraph::connect()
                                     else
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                                                channels_.at(i)->get_left_block_acq(), 0);
+                                            connect_acquisition(i, sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), "conditioner_" + std::to_string(selected_signal_conditioner_ID));
                                             top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
                                                 channels_.at(i)->get_left_block_trk(), 0);
                                         }
                                 }
                             else
                                 {
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                                        channels_.at(i)->get_left_block_acq(), 0);
+                                    connect_acquisition(i, sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), "conditioner_" + std::to_string(selected_signal_conditioner_ID));
                                     top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
                                         channels_.at(i)->get_left_block_trk(), 0);
                                 }
@@ -652,6 +688,7 @@ void GNSSFlowgraph::connect()
             LOG(INFO) << "Channel " << i << " assigned to " << channels_.at(i)->get_signal();
             if (channels_state_[i] == 1)
                 {
+                    acq_scheduler_.search_started(i, channels_.at(i)->get_signal(), scheduler_time_s());
                     if (FPGA_enabled == false)
                         {
                             channels_.at(i)->start_acquisition();
@@ -670,6 +707,67 @@ void GNSSFlowgraph::connect()
 }
 
 
+void GNSSFlowgraph::connect_acquisition(unsigned int channel, const gr::basic_block_sptr& acq_source, const std::string& ring_key)
+{
+    // Acquisition blocks able to do it take their snapshots from a sample ring, fed
+    // once per acquisition input, instead of all reading the full-rate stream
+    std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(channel));
+    if (channel_ptr and channel_ptr->acquisition()->set_sample_ring(ring_key))
+        {
+            if (acq_sample_rings_.count(ring_key) == 0)
+                {
+                    gr::basic_block_sptr ring_sink = acq_make_sample_ring_sink(ring_key, acq_source->output_signature()->sizeof_stream_item(0));
+                    top_block_->connect(acq_source, 0, ring_sink, 0);
+                    acq_sample_rings_[ring_key] = std::make_pair(acq_source, ring_sink);
+                    LOG(INFO) << "Created acquisition sample ring " << ring_key;
+                }
+            DLOG(INFO) << "Acquisition of channel " << channel << " reads from the sample ring " << ring_key;
+            return;
+        }
+    top_block_->connect(acq_source, 0, channels_.at(channel)->get_left_block_acq(), 0);
+}
+
+
+bool GNSSFlowgraph::connect_fdma_channel(unsigned int channel, int signal_conditioner_ID)
+{
+    // GLONASS channels can take their sub-band from a polyphase channelizer, shared by all
+    // the channels of the same signal and RF channel, instead of the wideband stream
+    std::string implementation = channels_.at(channel)->implementation();
+    if (configuration_->property("GNSS-SDR.GLONASS_FDMA_channelizer", false) == false or (implementation != "1G" and implementation != "2G"))
+        {
+            return false;
+        }
+    std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(channel));
+    if (!channel_ptr)
+        {
+            return false;
+        }
+
+    std::string map_key = implementation + std::to_string(signal_conditioner_ID);
+    if (fdma_channelizers_.count(map_key) == 0)
+        {
+            int64_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
+            double channel_spacing_hz = (implementation == "1G") ? GLONASS_L1_CA_DFREQ_HZ : GLONASS_L2_CA_DFREQ_HZ;
+            fdma_channelizers_[map_key] = glonass_fdma_make_channelizer_cc(fs, channel_spacing_hz);
+            top_block_->connect(sig_conditioner_.at(signal_conditioner_ID)->get_right_block(), 0, fdma_channelizers_.at(map_key), 0);
+            LOG(INFO) << "Created GLONASS " << implementation << " FDMA channelizer for RF channel " << signal_conditioner_ID;
+        }
+
+    // The sub-band follows the satellite assigned to the channel, so each channel
+    // gets its own selector instead of a fixed channelizer output
+    glonass_fdma_subband_selector_cc_sptr selector = glonass_fdma_make_subband_selector_cc();
+    for (int32_t k = 0; k < Glonass_Fdma_Channelizer::num_channels; k++)
+        {
+            top_block_->connect(fdma_channelizers_.at(map_key), k, selector, k);
+        }
+    top_block_->connect(selector, 0, channels_.at(channel)->get_left_block_acq(), 0);
+    top_block_->connect(selector, 0, channels_.at(channel)->get_left_block_trk(), 0);
+    channel_ptr->set_fdma_subband_selector(selector);
+    fdma_selectors_[channel] = selector;
+    return true;
+}
+
+
 void GNSSFlowgraph::disconnect()
 {
     LOG(INFO) << "Disconnecting flowgraph";
@@ -787,6 +885,7 @@ void GNSSFlowgraph::disconnect()
 #endif
     // Signal conditioner (selected_signal_source) >> channels (i) (dependent of their associated SignalSource_ID)
     int selected_signal_conditioner_ID;
+    std::set<std::string> disconnected_channelizers;  // shared by the GLONASS channels of the same signal and RF channel
     for (unsigned int i = 0; i < channels_count_; i++)
         {
             try
@@ -801,8 +900,31 @@ void GNSSFlowgraph::disconnect()
                 }
             try
                 {
-                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                        channels_.at(i)->get_left_block_trk(), 0);
+                    if (fdma_selectors_.count(i) != 0)
+                        {
+                            // Signal conditioner > FDMA channelizer >> sub-band selector > channel
+                            top_block_->disconnect(fdma_selectors_.at(i), 0, channels_.at(i)->get_left_block_trk(), 0);
+                            top_block_->disconnect(fdma_selectors_.at(i), 0, channels_.at(i)->get_left_block_acq(), 0);
+                            std::string map_key = channels_.at(i)->implementation() + std::to_string(selected_signal_conditioner_ID);
+                            for (int32_t k = 0; k < Glonass_Fdma_Channelizer::num_channels; k++)
+                                {
+                                    top_block_->disconnect(fdma_channelizers_.at(map_key), k, fdma_selectors_.at(i), k);
+                                }
+                            if (disconnected_channelizers.insert(map_key).second)
+                                {
+                                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0, fdma_channelizers_.at(map_key), 0);
+                                }
+                            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+                            if (channel_ptr)
+                                {
+                                    channel_ptr->set_fdma_subband_selector(nullptr);
+                                }
+                        }
+                    else
+                        {
+                            top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                channels_.at(i)->get_left_block_trk(), 0);
+                        }
                 }
             catch (const std::exception& e)
                 {
@@ -825,6 +947,23 @@ void GNSSFlowgraph::disconnect()
                 }
         }
 
+    for (auto& ring : acq_sample_rings_)
+        {
+            try
+                {
+                    top_block_->disconnect(ring.second.first, 0, ring.second.second, 0);
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(INFO) << "Can't disconnect acquisition sample ring " << ring.first << ": " << e.what();
+                    top_block_->disconnect_all();
+                    return;
+                }
+        }
+    acq_sample_rings_.clear();
+    fdma_selectors_.clear();
+    fdma_channelizers_.clear();
+
     try
         {
             for (unsigned int i = 0; i < channels_count_; i++)
@@ -1020,6 +1159,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                             break;
                         }
                 }
+            acq_scheduler_.search_failed(who, scheduler_time_s());
             channels_state_[who] = 0;
             acq_channels_count_--;
             for (unsigned int i = 0; i < channels_count_; i++)
@@ -1036,14 +1176,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                         }
                     if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[ch_index] == 0))
                         {
-                            channels_state_[ch_index] = 1;
-                            if (sat_ == 0)
-                                {
-                                    channels_[ch_index]->set_signal(search_next_signal(channels_[ch_index]->get_signal().get_signal_str(), true));
-                                }
-                            acq_channels_count_++;
-                            DLOG(INFO) << "Channel " << ch_index << " Starting acquisition " << channels_[ch_index]->get_signal().get_satellite() << ", Signal " << channels_[ch_index]->get_signal().get_signal_str();
-                            channels_[ch_index]->start_acquisition();
+                            start_channel_acquisition(ch_index, sat_ == 0, false);
                         }
                     DLOG(INFO) << "Channel " << ch_index << " in state " << channels_state_[ch_index];
                 }
@@ -1088,6 +1221,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                     break;
                 }
 
+            acq_scheduler_.search_succeeded(who, scheduler_time_s());
             channels_state_[who] = 2;
             acq_channels_count_--;
             for (unsigned int i = 0; i < channels_count_; i++)
@@ -1103,14 +1237,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                         }
                     if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[i] == 0))
                         {
-                            channels_state_[i] = 1;
-                            if (sat_ == 0)
-                                {
-                                    channels_[i]->set_signal(search_next_signal(channels_[i]->get_signal().get_signal_str(), true, true));
-                                }
-                            acq_channels_count_++;
-                            DLOG(INFO) << "Channel " << i << " Starting acquisition " << channels_[i]->get_signal().get_satellite() << ", Signal " << channels_[i]->get_signal().get_signal_str();
-                            channels_[i]->start_acquisition();
+                            start_channel_acquisition(i, sat_ == 0, true);
                         }
                     DLOG(INFO) << "Channel " << i << " in state " << channels_state_[i];
                 }
@@ -1120,12 +1247,10 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
             LOG(INFO) << "Channel " << who << " TRK FAILED satellite " << channels_[who]->get_signal().get_satellite();
             DLOG(INFO) << "Number of channels in acquisition = " << acq_channels_count_;
 
-            if (acq_channels_count_ < max_acq_channels_)
+            channels_state_[who] = 0;
+            if ((acq_channels_count_ < max_acq_channels_) && start_channel_acquisition(who, false, false))
                 {
-                    channels_state_[who] = 1;
-                    acq_channels_count_++;
                     LOG(INFO) << "Channel " << who << " Starting acquisition " << channels_[who]->get_signal().get_satellite() << ", Signal " << channels_[who]->get_signal().get_signal_str();
-                    channels_[who]->start_acquisition();
                 }
             else
                 {
@@ -1221,13 +1346,16 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                                     break;
                                 }
                             channels_[n]->stop_channel();  //stop the acquisition or tracking operation
+                            acq_scheduler_.search_stopped(n);
                             channels_state_[n] = 0;
                         }
                 }
             acq_channels_count_ = 0;  // all channels are in standby now
+            standby_ = true;
             break;
         case 11:  // request coldstart mode
             LOG(INFO) << "TC request flowgraph coldstart";
+            standby_ = false;
             //start again the satellite acquisitions
             for (unsigned int i = 0; i < channels_count_; i++)
                 {
@@ -1243,20 +1371,14 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                         }
                     if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[ch_index] == 0))
                         {
-                            channels_state_[ch_index] = 1;
-                            if (sat_ == 0)
-                                {
-                                    channels_[ch_index]->set_signal(search_next_signal(channels_[ch_index]->get_signal().get_signal_str(), true));
-                                }
-                            acq_channels_count_++;
-                            DLOG(INFO) << "Channel " << ch_index << " Starting acquisition " << channels_[ch_index]->get_signal().get_satellite() << ", Signal " << channels_[ch_index]->get_signal().get_signal_str();
-                            channels_[ch_index]->start_acquisition();
+                            start_channel_acquisition(ch_index, sat_ == 0, false);
                         }
                     DLOG(INFO) << "Channel " << ch_index << " in state " << channels_state_[ch_index];
                 }
             break;
         case 12:  // request hotstart mode
             LOG(INFO) << "TC request flowgraph hotstart";
+            standby_ = false;
             for (unsigned int i = 0; i < channels_count_; i++)
                 {
                     unsigned int ch_index = (who + i + 1) % channels_count_;
@@ -1271,20 +1393,14 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                         }
                     if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[ch_index] == 0))
                         {
-                            channels_state_[ch_index] = 1;
-                            if (sat_ == 0)
-                                {
-                                    channels_[ch_index]->set_signal(search_next_signal(channels_[ch_index]->get_signal().get_signal_str(), true));
-                                }
-                            acq_channels_count_++;
-                            DLOG(INFO) << "Channel " << ch_index << " Starting acquisition " << channels_[ch_index]->get_signal().get_satellite() << ", Signal " << channels_[ch_index]->get_signal().get_signal_str();
-                            channels_[ch_index]->start_acquisition();
+                            start_channel_acquisition(ch_index, sat_ == 0, false);
                         }
                     DLOG(INFO) << "Channel " << ch_index << " in state " << channels_state_[ch_index];
                 }
             break;
         case 13:  // request warmstart mode
             LOG(INFO) << "TC request flowgraph warmstart";
+            standby_ = false;
             //start again the satellite acquisitions
             for (unsigned int i = 0; i < channels_count_; i++)
                 {
@@ -1300,14 +1416,7 @@ void GNSSFlowgraph::apply_action(unsigned int who, unsigned int what)
                         }
                     if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[ch_index] == 0))
                         {
-                            channels_state_[ch_index] = 1;
-                            if (sat_ == 0)
-                                {
-                                    channels_[ch_index]->set_signal(search_next_signal(channels_[ch_index]->get_signal().get_signal_str(), true));
-                                }
-                            acq_channels_count_++;
-                            DLOG(INFO) << "Channel " << ch_index << " Starting acquisition " << channels_[ch_index]->get_signal().get_satellite() << ", Signal " << channels_[ch_index]->get_signal().get_signal_str();
-                            channels_[ch_index]->start_acquisition();
+                            start_channel_acquisition(ch_index, sat_ == 0, false);
                         }
                     DLOG(INFO) << "Channel " << ch_index << " in state " << channels_state_[ch_index];
                 }
@@ -1373,6 +1482,108 @@ void GNSSFlowgraph::priorize_satellites(std::vector<std::pair<int, Gnss_Satellit
 }
 
 
+void GNSSFlowgraph::set_satellite_elevations(const std::vector<std::pair<int, Gnss_Satellite>>& elevations)
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex);
+    acq_scheduler_.set_elevations(elevations, scheduler_time_s());
+}
+
+
+bool GNSSFlowgraph::acquisition_pending()
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex);
+    if (standby_ or acq_channels_count_ >= max_acq_channels_)
+        {
+            return false;
+        }
+    return std::find(channels_state_.begin(), channels_state_.end(), 0U) != channels_state_.end();
+}
+
+
+void GNSSFlowgraph::schedule_acquisitions()
+{
+    std::lock_guard<std::mutex> lock(signal_list_mutex);
+    if (standby_)
+        {
+            return;
+        }
+    for (unsigned int i = 0; i < channels_count_; i++)
+        {
+            unsigned int sat_ = 0;
+            try
+                {
+                    sat_ = configuration_->property("Channel" + std::to_string(i) + ".satellite", 0);
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(WARNING) << e.what();
+                }
+            if ((acq_channels_count_ < max_acq_channels_) && (channels_state_[i] == 0))
+                {
+                    start_channel_acquisition(i, sat_ == 0, false);
+                }
+        }
+}
+
+
+bool GNSSFlowgraph::start_channel_acquisition(unsigned int channel, bool assign_signal, bool tracked)
+{
+    double now_s = scheduler_time_s();
+    if (!acq_scheduler_.budget_available(now_s))
+        {
+            return false;
+        }
+    if (assign_signal)
+        {
+            // The scheduler brings the best eligible candidate to the front of the search list
+            std::string signal_str = channels_[channel]->get_signal().get_signal_str();
+            std::list<Gnss_Signal>* candidates = available_signals(signal_str);
+            if (candidates == nullptr or !acq_scheduler_.select(*candidates, now_s))
+                {
+                    DLOG(INFO) << "Channel " << channel << " waiting: no " << signal_str << " signal eligible for acquisition";
+                    return false;
+                }
+            channels_[channel]->set_signal(search_next_signal(signal_str, true, tracked));
+        }
+    channels_state_[channel] = 1;
+    acq_channels_count_++;
+    acq_scheduler_.search_started(channel, channels_[channel]->get_signal(), now_s);
+    DLOG(INFO) << "Channel " << channel << " Starting acquisition " << channels_[channel]->get_signal().get_satellite() << ", Signal " << channels_[channel]->get_signal().get_signal_str();
+    channels_[channel]->start_acquisition();
+    return true;
+}
+
+
+std::list<Gnss_Signal>* GNSSFlowgraph::available_signals(const std::string& searched_signal)
+{
+    switch (mapStringValues_[searched_signal])
+        {
+        case evGPS_1C:
+            return &available_GPS_1C_signals_;
+        case evGPS_2S:
+            return &available_GPS_2S_signals_;
+        case evGPS_L5:
+            return &available_GPS_L5_signals_;
+        case evGAL_1B:
+            return &available_GAL_1B_signals_;
+        case evGAL_5X:
+            return &available_GAL_5X_signals_;
+        case evGLO_1G:
+            return &available_GLO_1G_signals_;
+        case evGLO_2G:
+            return &available_GLO_2G_signals_;
+        default:
+            return nullptr;
+        }
+}
+
+
+double GNSSFlowgraph::scheduler_time_s()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
 void GNSSFlowgraph::set_configuration(std::shared_ptr<ConfigurationInterface> configuration)
 {
     if (running_)
@@ -1407,6 +1618,16 @@ void GNSSFlowgraph::init()
      */
     std::unique_ptr<GNSSBlockFactory> block_factory_(new GNSSBlockFactory());
 
+    // 0. Size of the worker pool shared by the non-blocking acquisition blocks (0 = automatic)
+    Acq_Worker_Pool::configure(configuration_->property("GNSS-SDR.acquisition_threads", 0U),
+        configuration_->property("GNSS-SDR.acquisition_queue_depth", 0U));
+
+    // Batches of the correlator engine shared by the tracking channels with batch_correlators set (0 = default)
+    cpu_multicorrelator_batch::configure(configuration_->property("GNSS-SDR.tracking_batch_size", 0U),
+        configuration_->property("GNSS-SDR.tracking_batch_gather_us", 0U),
+        configuration_->property("GNSS-SDR.tracking_batch_block_samples", 0U),
+        configuration_->property("GNSS-SDR.tracking_batch_threads", 0U));
+
     // 1. read the number of RF front-ends available (one file_source per RF front-end)
     sources_count_ = configuration_->property("Receiver.sources_count", 1);
 
@@ -1497,6 +1718,16 @@ void GNSSFlowgraph::init()
     set_signals_list();
     set_channels_state();
     applied_actions_ = 0;
+
+    // Acquisition scheduler: search rate budget, back-off of the signals that
+    // keep failing, and elevation mask for the satellites with known position
+    acq_scheduler_ = AcquisitionScheduler(configuration_->property("GNSS-SDR.acquisition_searches_per_s", 0.0),
+        configuration_->property("GNSS-SDR.acquisition_failures_before_backoff", 3U),
+        configuration_->property("GNSS-SDR.acquisition_backoff_s", 10.0),
+        configuration_->property("GNSS-SDR.acquisition_max_backoff_s", 300.0),
+        configuration_->property("GNSS-SDR.acquisition_elevation_mask_deg", -5.0),
+        configuration_->property("GNSS-SDR.acquisition_visibility_validity_s", 900.0));
+    standby_ = false;
     DLOG(INFO) << "Blocks instantiated. " << channels_count_ << " channels.";
 
     /*
@@ -38,6 +38,7 @@
 #define GNSS_SDR_GNSS_FLOWGRAPH_H_
 
 #include "GPS_L1_CA.h"
+#include "acquisition_scheduler.h"
 #include "channel_interface.h"
 #include "configuration_interface.h"
 #include "gnss_block_factory.h"
@@ -54,6 +55,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -144,12 +146,34 @@ public:
      */
     void priorize_satellites(std::vector<std::pair<int, Gnss_Satellite>> visible_satellites);
 
+    /*!
+     * \brief Stores the elevation, in degrees, of each listed satellite, including
+     * those below the horizon, for the acquisition scheduler
+     */
+    void set_satellite_elevations(const std::vector<std::pair<int, Gnss_Satellite>>& elevations);
+
+    /*!
+     * \brief True if some channel is waiting for an acquisition slot
+     */
+    bool acquisition_pending();
+
+    /*!
+     * \brief Starts the acquisition of the waiting channels that the scheduler
+     * allows now (acquisition budget, back-off of failing signals)
+     */
+    void schedule_acquisitions();
+
 private:
     void init();  // Populates the SV PRN list available for acquisition and tracking
     void set_signals_list();
     void set_channels_state();  // Initializes the channels state (start acquisition or keep standby)
                                 // using the configuration parameters (number of channels and max channels in acquisition)
     Gnss_Signal search_next_signal(const std::string& searched_signal, bool pop, bool tracked = false);
+    std::list<Gnss_Signal>* available_signals(const std::string& searched_signal);
+    bool start_channel_acquisition(unsigned int channel, bool assign_signal, bool tracked);  // false if the scheduler defers it
+    static double scheduler_time_s();
+    void connect_acquisition(unsigned int channel, const gr::basic_block_sptr& acq_source, const std::string& ring_key);
+    bool connect_fdma_channel(unsigned int channel, int signal_conditioner_ID);
     bool connected_;
     bool running_;
     int sources_count_;
@@ -168,6 +192,9 @@ private:
     std::shared_ptr<GNSSBlockInterface> pvt_;
 
     std::map<std::string, gr::basic_block_sptr> acq_resamplers_;
+    std::map<std::string, std::pair<gr::basic_block_sptr, gr::basic_block_sptr>> acq_sample_rings_;  // (source, sink) feeding each acquisition sample ring
+    std::map<std::string, gr::basic_block_sptr> fdma_channelizers_;
+    std::map<unsigned int, gr::basic_block_sptr> fdma_selectors_;  // sub-band selector of each GLONASS channel
     std::vector<std::shared_ptr<ChannelInterface>> channels_;
     gnss_sdr_sample_counter_sptr ch_out_sample_counter;
 #if ENABLE_FPGA
@@ -199,6 +226,8 @@ private:
 
     std::vector<unsigned int> channels_state_;
     std::mutex signal_list_mutex;
+    AcquisitionScheduler acq_scheduler_;
+    bool standby_;
 
     bool enable_monitor_;
     gr::basic_block_sptr GnssSynchroMonitor_;
@@ -0,0 +1,220 @@
+/*!
+ * \file agnss_hot_start.cc
+ * \brief Channel states of the last tracked satellites, kept across
+ * receiver restarts in a compact binary file
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "agnss_hot_start.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_frequencies.h"
+#include <cstring>
+#include <fstream>
+
+
+namespace
+{
+const char hot_start_magic[8] = {'G', 'S', 'D', 'R', 'H', 'O', 'T', '\0'};
+const uint32_t hot_start_version = 1;
+const uint32_t hot_start_max_channels = 1024;
+
+template <typename T>
+void write_value(std::ofstream& ofs, const T& value)
+{
+    ofs.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void read_value(std::ifstream& ifs, T& value)
+{
+    ifs.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+}  // namespace
+
+
+Agnss_Hot_Start_Channel::Agnss_Hot_Start_Channel()
+{
+    system = 0;
+    std::memset(signal, 0, sizeof(signal));
+    prn = 0U;
+    doppler_hz = 0.0;
+    code_phase_s = 0.0;
+    sample_stamp = 0ULL;
+    fs = 0LL;
+    cn0_db_hz = 0.0;
+}
+
+
+Agnss_Hot_Start::Agnss_Hot_Start()
+{
+    clear();
+}
+
+
+void Agnss_Hot_Start::clear()
+{
+    save_time_s = 0.0;
+    session_time_s = 0.0;
+    position_valid = false;
+    position_ecef_m[0] = 0.0;
+    position_ecef_m[1] = 0.0;
+    position_ecef_m[2] = 0.0;
+    clock_drift_valid = false;
+    clock_drift_ppm = 0.0;
+    channels.clear();
+}
+
+
+bool Agnss_Hot_Start::save(const std::string& file_name) const
+{
+    std::ofstream ofs(file_name.c_str(), std::ofstream::binary | std::ofstream::trunc | std::ofstream::out);
+    if (!ofs.is_open())
+        {
+            return false;
+        }
+    ofs.write(hot_start_magic, sizeof(hot_start_magic));
+    write_value(ofs, hot_start_version);
+    write_value(ofs, save_time_s);
+    write_value(ofs, session_time_s);
+    write_value(ofs, static_cast<uint8_t>(position_valid));
+    write_value(ofs, position_ecef_m);
+    write_value(ofs, static_cast<uint8_t>(clock_drift_valid));
+    write_value(ofs, clock_drift_ppm);
+    write_value(ofs, static_cast<uint32_t>(channels.size()));
+    for (const auto& channel : channels)
+        {
+            write_value(ofs, channel.system);
+            ofs.write(channel.signal, 2);
+            write_value(ofs, channel.prn);
+            write_value(ofs, channel.doppler_hz);
+            write_value(ofs, channel.code_phase_s);
+            write_value(ofs, channel.sample_stamp);
+            write_value(ofs, channel.fs);
+            write_value(ofs, channel.cn0_db_hz);
+        }
+    return ofs.good();
+}
+
+
+bool Agnss_Hot_Start::load(const std::string& file_name)
+{
+    clear();
+    std::ifstream ifs(file_name.c_str(), std::ifstream::binary | std::ifstream::in);
+    if (!ifs.is_open())
+        {
+            return false;
+        }
+    char magic[sizeof(hot_start_magic)];
+    uint32_t version = 0;
+    ifs.read(magic, sizeof(magic));
+    read_value(ifs, version);
+    if (!ifs.good() or std::memcmp(magic, hot_start_magic, sizeof(magic)) != 0 or version != hot_start_version)
+        {
+            return false;
+        }
+    uint8_t flag = 0;
+    uint32_t num_channels = 0;
+    read_value(ifs, save_time_s);
+    read_value(ifs, session_time_s);
+    read_value(ifs, flag);
+    position_valid = (flag != 0);
+    read_value(ifs, position_ecef_m);
+    read_value(ifs, flag);
+    clock_drift_valid = (flag != 0);
+    read_value(ifs, clock_drift_ppm);
+    read_value(ifs, num_channels);
+    if (!ifs.good() or num_channels > hot_start_max_channels)
+        {
+            clear();
+            return false;
+        }
+    channels.resize(num_channels);
+    for (auto& channel : channels)
+        {
+            read_value(ifs, channel.system);
+            ifs.read(channel.signal, 2);
+            channel.signal[2] = '\0';
+            read_value(ifs, channel.prn);
+            read_value(ifs, channel.doppler_hz);
+            read_value(ifs, channel.code_phase_s);
+            read_value(ifs, channel.sample_stamp);
+            read_value(ifs, channel.fs);
+            read_value(ifs, channel.cn0_db_hz);
+        }
+    if (!ifs.good())
+        {
+            clear();
+            return false;
+        }
+    return true;
+}
+
+
+double Agnss_Hot_Start::carrier_hz(const char* signal)
+{
+    std::string signal_str(signal, 2);
+    if (signal_str == "1C" or signal_str == "1B")
+        {
+            return FREQ1;
+        }
+    if (signal_str == "2S")
+        {
+            return FREQ2;
+        }
+    if (signal_str == "L5" or signal_str == "5X")
+        {
+            return FREQ5;
+        }
+    return 0.0;
+}
+
+
+double Agnss_Hot_Start::range_rate_m_s(const Agnss_Hot_Start_Channel& channel)
+{
+    double carrier = carrier_hz(channel.signal);
+    if (carrier <= 0.0)
+        {
+            return 0.0;
+        }
+    // An approaching satellite (negative range rate) has a positive Doppler
+    return -channel.doppler_hz * SPEED_OF_LIGHT / carrier;
+}
+
+
+double Agnss_Hot_Start::extrapolation_time_s(const Agnss_Hot_Start_Channel& channel, double elapsed_s) const
+{
+    double stamp_time_s = (channel.fs > 0 ? static_cast<double>(channel.sample_stamp) / static_cast<double>(channel.fs) : session_time_s);
+    return (session_time_s - stamp_time_s) + elapsed_s;
+}
+
+
+double Agnss_Hot_Start::code_phase_s(const Agnss_Hot_Start_Channel& channel, double elapsed_s) const
+{
+    // The code epoch is seen dt seconds earlier relative to a later sample,
+    // and the code delay itself grows with the range rate
+    double dt = extrapolation_time_s(channel, elapsed_s);
+    return channel.code_phase_s - dt + dt * range_rate_m_s(channel) / SPEED_OF_LIGHT;
+}
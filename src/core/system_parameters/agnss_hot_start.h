@@ -0,0 +1,119 @@
+/*!
+ * \file agnss_hot_start.h
+ * \brief Channel states of the last tracked satellites, kept across
+ * receiver restarts in a compact binary file
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_AGNSS_HOT_START_H_
+#define GNSS_SDR_AGNSS_HOT_START_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/*!
+ * \brief Last tracking state of one channel
+ */
+class Agnss_Hot_Start_Channel
+{
+public:
+    char system;            // 'G', 'E', 'R'
+    char signal[3];         // "1C", "1B", ...
+    uint32_t prn;
+    double doppler_hz;      // carrier Doppler, receiver clock drift included [Hz]
+    double code_phase_s;    // delay of the code epoch after sample_stamp [s]
+    uint64_t sample_stamp;  // tracking input sample the code phase refers to
+    int64_t fs;             // tracking input sampling rate [sps]
+    double cn0_db_hz;
+
+    Agnss_Hot_Start_Channel();
+};
+
+
+/*!
+ * \brief This class keeps the last tracked satellites, the receiver position
+ * and the clock drift of a receiver session, so that the next session can
+ * search those satellites first and only around their last Doppler and code
+ * phase.
+ *
+ * The file is a small binary dump in the byte order of the host: it is
+ * meant to be written on shutdown and read back by the same receiver.
+ */
+class Agnss_Hot_Start
+{
+public:
+    double save_time_s;     // UNIX time of the last stored epoch [s]
+    double session_time_s;  // time of the same epoch since the first input sample [s]
+    bool position_valid;
+    double position_ecef_m[3];
+    bool clock_drift_valid;
+    double clock_drift_ppm;
+    std::vector<Agnss_Hot_Start_Channel> channels;
+
+    Agnss_Hot_Start();
+
+    /*!
+     * \brief Writes the state to \p file_name. Returns false on failure.
+     */
+    bool save(const std::string& file_name) const;
+
+    /*!
+     * \brief Reads a state written by save(). Returns false, leaving the
+     * object empty, if the file is missing, truncated or of another version.
+     */
+    bool load(const std::string& file_name);
+
+    /*!
+     * \brief Carrier frequency of a CDMA signal [Hz], or 0 for the FDMA ones
+     */
+    static double carrier_hz(const char* signal);
+
+    /*!
+     * \brief Range rate of the satellite of \p channel, receiver clock
+     * drift included [m/s]. Zero if the carrier is unknown.
+     */
+    static double range_rate_m_s(const Agnss_Hot_Start_Channel& channel);
+
+    /*!
+     * \brief Code delay of \p channel at the first sample of a new session
+     * started \p elapsed_s seconds after save_time_s, extrapolated with the
+     * last Doppler [s]. It is not reduced modulo the code period.
+     */
+    double code_phase_s(const Agnss_Hot_Start_Channel& channel, double elapsed_s) const;
+
+    /*!
+     * \brief Time from the stored code phase of \p channel to the first
+     * sample of a new session started \p elapsed_s seconds after
+     * save_time_s [s]
+     */
+    double extrapolation_time_s(const Agnss_Hot_Start_Channel& channel, double elapsed_s) const;
+
+    void clear();
+};
+
+#endif
@@ -85,8 +85,10 @@ DECLARE_string(log_dir);
 #include "unit-tests/arithmetic/conjugate_test.cc"
 #include "unit-tests/arithmetic/fft_length_test.cc"
 #include "unit-tests/arithmetic/fft_speed_test.cc"
+#include "unit-tests/arithmetic/gnss_sdr_fft_test.cc"
 #include "unit-tests/arithmetic/magnitude_squared_test.cc"
 #include "unit-tests/arithmetic/multiply_test.cc"
+#include "unit-tests/control-plane/acquisition_scheduler_test.cc"
 #include "unit-tests/control-plane/control_message_factory_test.cc"
 #include "unit-tests/control-plane/control_thread_test.cc"
 #include "unit-tests/control-plane/file_configuration_test.cc"
@@ -94,6 +96,16 @@ DECLARE_string(log_dir);
 #include "unit-tests/control-plane/gnss_flowgraph_test.cc"
 #include "unit-tests/control-plane/in_memory_configuration_test.cc"
 #include "unit-tests/control-plane/string_converter_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_worker_pool_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_shared_engine_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_code_spectra_cache_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_dump_writer_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_sample_ring_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_wipeoff_store_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_search_window_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_peak_interpolator_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_decimator_test.cc"
+#include "unit-tests/signal-processing-blocks/acquisition/acq_sequential_test_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_8ms_ambiguous_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_ambiguous_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_ambiguous_acquisition_gsoc_test.cc"
@@ -110,6 +122,7 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/adapter/adapter_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/pass_through_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/fir_filter_test.cc"
+#include "unit-tests/signal-processing-blocks/filter/glonass_fdma_channelizer_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/notch_filter_lite_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/notch_filter_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/pulse_blanking_filter_test.cc"
@@ -125,6 +138,7 @@ DECLARE_string(log_dir);
 #endif
 
 #include "unit-tests/signal-processing-blocks/tracking/bayesian_estimation_test.cc"
+#include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_batch_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_real_codes_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/cpu_multicorrelator_test.cc"
 #include "unit-tests/signal-processing-blocks/tracking/galileo_e1_dll_pll_veml_tracking_test.cc"
@@ -147,6 +161,7 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_printer_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_test.cc"
 #include "unit-tests/signal-processing-blocks/telemetry_decoder/galileo_fnav_inav_decoder_test.cc"
+#include "unit-tests/system-parameters/agnss_hot_start_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_ephemeris_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_nav_message_test.cc"
 
@@ -0,0 +1,84 @@
+/*!
+ * \file gnss_sdr_fft_test.cc
+ * \brief Tests for the FFT with shared plans and the FFTW wisdom persistence
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_fft.h"
+#include <boost/filesystem.hpp>
+#include <gnuradio/fft/fft.h>
+#include <gtest/gtest.h>
+#include <cmath>
+
+
+TEST(GnssSdrFftTest, SamePlanForSameSize)
+{
+    Gnss_Fft_Plan_Registry& registry = Gnss_Fft_Plan_Registry::instance();
+    Gnss_Fft_Plan_Registry::Plan_sptr forward = registry.get(1297, true);
+    uint64_t reused = registry.reused();
+    EXPECT_EQ(forward.get(), registry.get(1297, true).get());
+    EXPECT_EQ(registry.reused(), reused + 1);
+    EXPECT_NE(forward.get(), registry.get(1297, false).get());
+}
+
+
+TEST(GnssSdrFftTest, MatchesGnuRadioFft)
+{
+    const int fft_size = 4000;
+    gr::fft::fft_complex reference(fft_size, true);
+    Gnss_Fft first(fft_size, true);
+    Gnss_Fft second(fft_size, true);
+    for (int i = 0; i < fft_size; i++)
+        {
+            gr_complex sample(std::cos(0.01F * static_cast<float>(i * i)), std::sin(0.3F * static_cast<float>(i)));
+            reference.get_inbuf()[i] = sample;
+            first.get_inbuf()[i] = sample;
+            second.get_inbuf()[i] = sample * 2.0F;
+        }
+    reference.execute();
+    first.execute();
+    second.execute();
+
+    // Two objects sharing a plan work on their own buffers
+    for (int i = 0; i < fft_size; i++)
+        {
+            EXPECT_NEAR(std::abs(first.get_outbuf()[i] - reference.get_outbuf()[i]), 0.0, 1e-2);
+            EXPECT_NEAR(std::abs(second.get_outbuf()[i] - 2.0F * reference.get_outbuf()[i]), 0.0, 2e-2);
+        }
+}
+
+
+TEST(GnssSdrFftTest, WisdomRoundTrip)
+{
+    const std::string filename = "./gnss_sdr_fft_test_wisdom";
+    Gnss_Fft_Plan_Registry& registry = Gnss_Fft_Plan_Registry::instance();
+    EXPECT_FALSE(registry.load_wisdom("./non_existing_wisdom_file"));
+    Gnss_Fft fft(3000, true);
+    ASSERT_TRUE(registry.save_wisdom(filename));
+    EXPECT_TRUE(boost::filesystem::exists(filename));
+    EXPECT_TRUE(registry.load_wisdom(filename));
+    boost::filesystem::remove(filename);
+}
@@ -0,0 +1,168 @@
+/*!
+ * \file acquisition_scheduler_test.cc
+ * \brief Tests for the selection of the signals to acquire
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acquisition_scheduler.h"
+#include <gtest/gtest.h>
+#include <list>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+std::list<Gnss_Signal> gps_candidates(uint32_t n)
+{
+    std::list<Gnss_Signal> candidates;
+    for (uint32_t prn = 1; prn <= n; prn++)
+        {
+            candidates.push_back(Gnss_Signal(Gnss_Satellite("GPS", prn), "1C"));
+        }
+    return candidates;
+}
+}  // namespace
+
+
+TEST(AcquisitionSchedulerTest, VisibilityAndElevationOrder)
+{
+    AcquisitionScheduler scheduler;
+    std::list<Gnss_Signal> candidates = gps_candidates(6);
+
+    // Without information, the list order is kept
+    ASSERT_TRUE(scheduler.select(candidates, 0.0));
+    EXPECT_EQ(1U, candidates.front().get_satellite().get_PRN());
+
+    // PRN 2 and 5 visible, PRN 1 and 3 below the horizon, 4 and 6 unknown
+    std::vector<std::pair<int, Gnss_Satellite>> elevations;
+    elevations.push_back(std::make_pair(-30, Gnss_Satellite("GPS", 1)));
+    elevations.push_back(std::make_pair(20, Gnss_Satellite("GPS", 2)));
+    elevations.push_back(std::make_pair(-10, Gnss_Satellite("GPS", 3)));
+    elevations.push_back(std::make_pair(60, Gnss_Satellite("GPS", 5)));
+    scheduler.set_elevations(elevations, 0.0);
+
+    ASSERT_TRUE(scheduler.select(candidates, 1.0));
+    EXPECT_EQ(5U, candidates.front().get_satellite().get_PRN());
+    EXPECT_FALSE(scheduler.eligible(Gnss_Signal(Gnss_Satellite("GPS", 1), "1C"), 1.0));
+    EXPECT_FALSE(scheduler.eligible(Gnss_Signal(Gnss_Satellite("GPS", 3), "1C"), 1.0));
+
+    // Drain the list as the flow graph would: the order is 5, 2, then the unknown ones
+    std::vector<uint32_t> order;
+    while (scheduler.select(candidates, 1.0))
+        {
+            order.push_back(candidates.front().get_satellite().get_PRN());
+            candidates.pop_front();
+        }
+    ASSERT_EQ(4U, order.size());
+    EXPECT_EQ(5U, order[0]);
+    EXPECT_EQ(2U, order[1]);
+    EXPECT_EQ(4U, order[2]);
+    EXPECT_EQ(6U, order[3]);
+    EXPECT_EQ(2U, candidates.size());  // the satellites below the horizon are never chosen
+
+    // Once the elevations expire, they are searched again
+    ASSERT_TRUE(scheduler.select(candidates, 1000.0));
+    EXPECT_EQ(1U, candidates.front().get_satellite().get_PRN());
+}
+
+
+TEST(AcquisitionSchedulerTest, NoConcurrentSearches)
+{
+    AcquisitionScheduler scheduler;
+    std::list<Gnss_Signal> candidates = gps_candidates(2);
+    Gnss_Signal prn1 = candidates.front();
+
+    scheduler.search_started(0, prn1, 0.0);
+    EXPECT_TRUE(scheduler.in_acquisition(prn1));
+    EXPECT_FALSE(scheduler.in_acquisition(Gnss_Signal(Gnss_Satellite("GPS", 1), "2S")));
+    ASSERT_TRUE(scheduler.select(candidates, 0.0));
+    EXPECT_EQ(2U, candidates.front().get_satellite().get_PRN());
+
+    scheduler.search_started(1, candidates.front(), 0.0);
+    EXPECT_FALSE(scheduler.select(candidates, 0.0));
+
+    scheduler.search_stopped(0);
+    ASSERT_TRUE(scheduler.select(candidates, 0.0));
+    EXPECT_EQ(1U, candidates.front().get_satellite().get_PRN());
+}
+
+
+TEST(AcquisitionSchedulerTest, BackoffOfFailingSignals)
+{
+    AcquisitionScheduler scheduler(0.0, 2, 10.0, 25.0);
+    Gnss_Signal signal(Gnss_Satellite("GPS", 7), "1C");
+
+    scheduler.search_started(0, signal, 0.0);
+    scheduler.search_failed(0, 0.0);
+    EXPECT_EQ(1U, scheduler.consecutive_failures(signal));
+    EXPECT_TRUE(scheduler.eligible(signal, 0.0));
+
+    // Second failure: 10 s back-off
+    scheduler.search_started(0, signal, 1.0);
+    scheduler.search_failed(0, 1.0);
+    EXPECT_FALSE(scheduler.eligible(signal, 10.9));
+    EXPECT_TRUE(scheduler.eligible(signal, 11.0));
+
+    // Third failure: doubled, then limited to 25 s
+    scheduler.search_started(0, signal, 11.0);
+    scheduler.search_failed(0, 11.0);
+    EXPECT_FALSE(scheduler.eligible(signal, 30.9));
+    EXPECT_TRUE(scheduler.eligible(signal, 31.0));
+    scheduler.search_started(0, signal, 31.0);
+    scheduler.search_failed(0, 31.0);
+    EXPECT_FALSE(scheduler.eligible(signal, 55.9));
+    EXPECT_TRUE(scheduler.eligible(signal, 56.0));
+
+    // A success clears the history, and makes the satellite the first choice
+    scheduler.search_started(0, signal, 56.0);
+    scheduler.search_succeeded(0, 56.0);
+    EXPECT_EQ(0U, scheduler.consecutive_failures(signal));
+    std::list<Gnss_Signal> candidates = gps_candidates(8);
+    ASSERT_TRUE(scheduler.select(candidates, 57.0));
+    EXPECT_EQ(7U, candidates.front().get_satellite().get_PRN());
+}
+
+
+TEST(AcquisitionSchedulerTest, SearchRateBudget)
+{
+    AcquisitionScheduler scheduler(3.0);
+    Gnss_Signal signal(Gnss_Satellite("GPS", 1), "1C");
+    for (uint32_t ch = 0; ch < 3; ch++)
+        {
+            ASSERT_TRUE(scheduler.budget_available(0.1 * ch));
+            scheduler.search_started(ch, signal, 0.1 * ch);
+        }
+    EXPECT_FALSE(scheduler.budget_available(0.5));
+    EXPECT_TRUE(scheduler.budget_available(1.0));
+
+    AcquisitionScheduler unlimited;
+    for (uint32_t ch = 0; ch < 100; ch++)
+        {
+            unlimited.search_started(ch, signal, 0.0);
+        }
+    EXPECT_TRUE(unlimited.budget_available(0.0));
+}
@@ -0,0 +1,603 @@
+/*!
+ * \file acq_benchmark_test.cc
+ * \brief Timing of the PCPS acquisition block in each of its search modes,
+ * and stage by stage timing of its grid search
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "gnss_sdr_fft.h"
+#include "gnss_synchro.h"
+#include "gps_l1_ca_pcps_acquisition.h"
+#include "in_memory_configuration.h"
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <gflags/gflags.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+DEFINE_int32(acq_benchmark_iterations, 10, "Number of timed dwells per configuration in the acquisition benchmark");
+DEFINE_string(acq_benchmark_fs, "2000000,4000000", "Comma-separated sampling rates [sps] swept by the acquisition benchmark");
+DEFINE_string(acq_benchmark_dwell_ms, "1,4", "Comma-separated coherent integration times [ms] swept by the acquisition benchmark");
+DEFINE_string(acq_benchmark_doppler_max, "5000,10000", "Comma-separated Doppler spans [Hz] swept by the acquisition benchmark");
+DEFINE_int32(acq_benchmark_doppler_step, 500, "Doppler step [Hz] of the acquisition benchmark");
+DEFINE_int32(acq_benchmark_channels, 8, "Channels sharing the input spectra in the shared mode of the acquisition benchmark");
+DEFINE_int32(acq_benchmark_doppler_workers, 4, "Doppler workers of the doppler_workers mode of the acquisition benchmark");
+DEFINE_string(acq_benchmark_output, "acq_benchmark.csv", "CSV file where the acquisition benchmark appends the timings of the block. Empty to disable");
+DEFINE_string(acq_benchmark_stage_output, "acq_benchmark_stages.csv", "CSV file where the acquisition benchmark appends the timings of each stage. Empty to disable");
+
+
+// ######## GNURADIO BLOCK MESSAGE RECEVER #########
+class AcqBenchmarkTest_msg_rx;
+
+using AcqBenchmarkTest_msg_rx_sptr = boost::shared_ptr<AcqBenchmarkTest_msg_rx>;
+
+AcqBenchmarkTest_msg_rx_sptr AcqBenchmarkTest_msg_rx_make(std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition, uint32_t acquisitions, concurrent_queue<int>& done);
+
+/*
+ * Restarts the acquisition each time it reports a result, until it has
+ * searched acquisitions + 1 times. The first search is the warm-up, so the
+ * timed ones are those between the first and the last result.
+ */
+class AcqBenchmarkTest_msg_rx : public gr::block
+{
+private:
+    friend AcqBenchmarkTest_msg_rx_sptr AcqBenchmarkTest_msg_rx_make(std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition, uint32_t acquisitions, concurrent_queue<int>& done);
+    void msg_handler_events(pmt::pmt_t msg);
+    AcqBenchmarkTest_msg_rx(std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition, uint32_t acquisitions, concurrent_queue<int>& done);
+    std::shared_ptr<GpsL1CaPcpsAcquisition> d_acquisition;
+    uint32_t d_acquisitions;
+    concurrent_queue<int>& d_done;
+
+public:
+    uint32_t results;
+    std::chrono::steady_clock::time_point first_result;
+    std::chrono::steady_clock::time_point last_result;
+    ~AcqBenchmarkTest_msg_rx();  //!< Default destructor
+};
+
+
+AcqBenchmarkTest_msg_rx_sptr AcqBenchmarkTest_msg_rx_make(std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition, uint32_t acquisitions, concurrent_queue<int>& done)
+{
+    return AcqBenchmarkTest_msg_rx_sptr(new AcqBenchmarkTest_msg_rx(std::move(acquisition), acquisitions, done));
+}
+
+
+void AcqBenchmarkTest_msg_rx::msg_handler_events(pmt::pmt_t msg __attribute__((unused)))
+{
+    auto now = std::chrono::steady_clock::now();
+    if (results == 0)
+        {
+            first_result = now;
+        }
+    last_result = now;
+    results++;
+    if (results <= d_acquisitions)
+        {
+            d_acquisition->set_state(1);
+        }
+    else if (results == d_acquisitions + 1)
+        {
+            d_done.push(1);
+        }
+}
+
+
+AcqBenchmarkTest_msg_rx::AcqBenchmarkTest_msg_rx(std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition, uint32_t acquisitions, concurrent_queue<int>& done)
+    : gr::block("AcqBenchmarkTest_msg_rx", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+      d_acquisition(std::move(acquisition)),
+      d_acquisitions(acquisitions),
+      d_done(done)
+{
+    this->message_port_register_in(pmt::mp("events"));
+    this->set_msg_handler(pmt::mp("events"), boost::bind(&AcqBenchmarkTest_msg_rx::msg_handler_events, this, _1));
+    results = 0;
+}
+
+
+AcqBenchmarkTest_msg_rx::~AcqBenchmarkTest_msg_rx() = default;
+
+
+namespace
+{
+std::vector<int64_t> parse_list(const std::string& list)
+{
+    std::vector<int64_t> values;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        {
+            if (!item.empty())
+                {
+                    values.push_back(std::stoll(item));
+                }
+        }
+    return values;
+}
+
+
+// Grid of one search, sized as pcps_acquisition does for a code of 1 ms
+struct Acq_Grid_Size
+{
+    Acq_Grid_Size(int64_t fs, uint32_t dwell_ms, uint32_t doppler_max, uint32_t doppler_step, bool bit_transition)
+    {
+        consumed_samples = static_cast<uint32_t>(fs * dwell_ms / 1000) * (bit_transition ? 2 : 1);
+        fft_size = (bit_transition or dwell_ms > 1) ? 2 * consumed_samples : consumed_samples;
+        effective_fft_size = bit_transition ? fft_size / 2 : fft_size;
+        num_doppler_bins = static_cast<uint32_t>(std::ceil(2.0 * static_cast<double>(doppler_max) / static_cast<double>(doppler_step)));
+        fft_bin_hz = static_cast<double>(fs) / static_cast<double>(fft_size);
+        // fft_doppler_shift falls back to the time-domain wipeoff unless the grid is made of whole FFT bins
+        fft_shift_aligned = is_multiple_of_fft_bin(doppler_step) and is_multiple_of_fft_bin(doppler_max);
+    }
+
+    bool is_multiple_of_fft_bin(double freq_hz) const
+    {
+        double bins = freq_hz / fft_bin_hz;
+        return std::abs(bins - std::round(bins)) < 1e-6;
+    }
+
+    uint32_t consumed_samples;
+    uint32_t fft_size;
+    uint32_t effective_fft_size;
+    uint32_t num_doppler_bins;
+    double fft_bin_hz;
+    bool fft_shift_aligned;
+};
+
+
+/*
+ * Microseconds per search of the pcps_acquisition block, configured as a
+ * GPS L1 C/A channel and fed with noise, in one of its search modes:
+ * "grid"            one carrier wipe-off and forward FFT per Doppler bin, CFAR statistic,
+ * "streaming"       same, with the peak-to-peak statistic tracked row by row,
+ * "fft_shift"       a single forward FFT, with the Doppler removed by shifting it,
+ * "shared"          the wiped-off spectra shared by \p channels channels,
+ * "fixed_point"     the 16-bit wipe-off of the cshort input,
+ * "doppler_workers" the Doppler bins split among \p doppler_workers workers.
+ */
+double time_block(const std::string& mode, int64_t fs, uint32_t dwell_ms, uint32_t doppler_max, uint32_t doppler_step, bool bit_transition, bool cshort,
+    uint32_t channels, uint32_t doppler_workers, uint32_t iterations)
+{
+    std::shared_ptr<InMemoryConfiguration> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs));
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.item_type", cshort ? "cshort" : "gr_complex");
+    config->set_property("Acquisition_1C.coherent_integration_time_ms", std::to_string(dwell_ms));
+    config->set_property("Acquisition_1C.bit_transition_flag", bit_transition ? "true" : "false");
+    config->set_property("Acquisition_1C.doppler_max", std::to_string(doppler_max));
+    config->set_property("Acquisition_1C.doppler_step", std::to_string(doppler_step));
+    config->set_property("Acquisition_1C.max_dwells", "1");
+    config->set_property("Acquisition_1C.dump", "false");
+    config->set_property("Acquisition_1C.blocking", "true");
+    config->set_property("Acquisition_1C.use_CFAR_algorithm", mode == "streaming" ? "false" : "true");
+    config->set_property("Acquisition_1C.fft_doppler_shift", mode == "fft_shift" ? "true" : "false");
+    config->set_property("Acquisition_1C.share_input_spectra", mode == "shared" ? "true" : "false");
+    config->set_property("Acquisition_1C.fixed_point_wipeoff", mode == "fixed_point" ? "true" : "false");
+    config->set_property("Acquisition_1C.doppler_workers", mode == "doppler_workers" ? std::to_string(doppler_workers) : "1");
+    if (mode != "shared")
+        {
+            channels = 1;
+        }
+
+    // Ten codes of noise, repeated
+    std::mt19937 generator(1234);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    auto samples = static_cast<uint32_t>(fs / 100);
+    gr::top_block_sptr top_block = gr::make_top_block("Acquisition benchmark");
+    gr::basic_block_sptr source;
+    if (cshort)
+        {
+            std::vector<int16_t> data(2 * samples);
+            for (auto& value : data)
+                {
+                    value = static_cast<int16_t>(100.0 * noise(generator));
+                }
+            source = gr::blocks::vector_source_s::make(data, true, 2);
+        }
+    else
+        {
+            std::vector<gr_complex> data(samples);
+            for (auto& value : data)
+                {
+                    value = gr_complex(noise(generator), noise(generator));
+                }
+            source = gr::blocks::vector_source_c::make(data, true);
+        }
+
+    concurrent_queue<int> done;
+    std::vector<Gnss_Synchro> gnss_synchro(channels);
+    std::vector<std::shared_ptr<GpsL1CaPcpsAcquisition>> acquisitions;
+    std::vector<AcqBenchmarkTest_msg_rx_sptr> msg_rx;
+    for (uint32_t channel = 0; channel < channels; channel++)
+        {
+            gnss_synchro[channel].Channel_ID = channel;
+            gnss_synchro[channel].System = 'G';
+            std::string signal = "1C";
+            signal.copy(gnss_synchro[channel].Signal, 2, 0);
+            gnss_synchro[channel].PRN = channel + 1;
+
+            std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
+            acquisition->set_channel(channel);
+            acquisition->set_gnss_synchro(&gnss_synchro[channel]);
+            acquisition->set_threshold(1.0e6);  // never detected, so every search is a full one
+            acquisition->set_doppler_max(doppler_max);
+            acquisition->set_doppler_step(doppler_step);
+            acquisition->connect(top_block);
+            msg_rx.push_back(AcqBenchmarkTest_msg_rx_make(acquisition, iterations, done));
+            top_block->connect(source, 0, acquisition->get_left_block(), 0);
+            top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx.back(), pmt::mp("events"));
+            acquisition->set_local_code();
+            acquisition->set_state(1);
+            acquisition->init();
+            acquisitions.push_back(acquisition);
+        }
+
+    top_block->start();
+    for (uint32_t channel = 0; channel < channels; channel++)
+        {
+            int finished;
+            done.wait_and_pop(finished);
+        }
+    top_block->stop();
+    top_block->wait();
+
+    auto first = msg_rx.front()->first_result;
+    auto last = msg_rx.front()->last_result;
+    for (const auto& rx : msg_rx)
+        {
+            first = std::min(first, rx->first_result);
+            last = std::max(last, rx->last_result);
+        }
+    return std::chrono::duration<double, std::micro>(last - first).count() / static_cast<double>(channels * iterations);
+}
+
+
+// Time spent in each stage of one dwell, in microseconds
+struct Acq_Stage_Times
+{
+    double input = 0.0;  // cshort conversion and zero padding
+    double wipeoff = 0.0;
+    double fft = 0.0;
+    double code_multiply = 0.0;
+    double ifft = 0.0;
+    double magnitude = 0.0;
+    double peak_search = 0.0;
+
+    double total() const
+    {
+        return input + wipeoff + fft + code_multiply + ifft + magnitude + peak_search;
+    }
+};
+
+
+class Stage_Clock
+{
+public:
+    Stage_Clock() : d_last(std::chrono::steady_clock::now()) {}
+
+    // Adds the time elapsed since the previous lap to \p stage
+    void lap(double& stage)
+    {
+        auto now = std::chrono::steady_clock::now();
+        stage += std::chrono::duration<double, std::micro>(now - d_last).count();
+        d_last = now;
+    }
+
+private:
+    std::chrono::steady_clock::time_point d_last;
+};
+
+
+/*
+ * The block cannot be timed stage by stage from outside, so this runs the
+ * same kernels on the same grid as pcps_acquisition::acquisition_core(),
+ * in the "grid", "fft_shift" and "shared" modes, to show where the time
+ * measured by time_block() goes.
+ */
+class Acq_Benchmark
+{
+public:
+    Acq_Benchmark(int64_t fs, const Acq_Grid_Size& grid, uint32_t doppler_max, uint32_t doppler_step, bool bit_transition, bool cshort)
+        : d_bit_transition(bit_transition), d_cshort(cshort)
+    {
+        d_consumed_samples = grid.consumed_samples;
+        d_fft_size = grid.fft_size;
+        d_effective_fft_size = grid.effective_fft_size;
+        d_num_doppler_bins = grid.num_doppler_bins;
+        d_fft_if = std::unique_ptr<Gnss_Fft>(new Gnss_Fft(d_fft_size, true));
+        d_ifft = std::unique_ptr<Gnss_Fft>(new Gnss_Fft(d_fft_size, false));
+
+        std::mt19937 generator(1234);
+        std::normal_distribution<float> noise(0.0, 1.0);
+        d_input_sc.resize(d_consumed_samples);
+        d_input.resize(d_consumed_samples);
+        for (uint32_t i = 0; i < d_consumed_samples; i++)
+            {
+                d_input[i] = gr_complex(noise(generator), noise(generator));
+                d_input_sc[i] = lv_16sc_t(static_cast<int16_t>(100.0 * d_input[i].real()), static_cast<int16_t>(100.0 * d_input[i].imag()));
+            }
+        d_input_signal.assign(d_fft_size, gr_complex(0.0, 0.0));
+        d_fft_codes.resize(d_fft_size);
+        for (uint32_t i = 0; i < d_fft_size; i++)
+            {
+                d_fft_codes[i] = gr_complex(noise(generator), noise(generator));
+            }
+        d_wipeoffs.resize(d_num_doppler_bins, std::vector<gr_complex>(d_fft_size));
+        d_shifts.resize(d_num_doppler_bins);
+        for (uint32_t k = 0; k < d_num_doppler_bins; k++)
+            {
+                float doppler = -static_cast<float>(doppler_max) + static_cast<float>(doppler_step * k);
+                float phase_step_rad = 2.0 * M_PI * doppler / static_cast<float>(fs);
+                float phase[1] = {0.0};
+                volk_gnsssdr_s32f_sincos_32fc(d_wipeoffs[k].data(), -phase_step_rad, phase, d_fft_size);
+                auto shift = static_cast<int64_t>(std::round(static_cast<double>(doppler) / grid.fft_bin_hz));
+                d_shifts[k] = static_cast<uint32_t>((shift % d_fft_size + d_fft_size) % d_fft_size);
+            }
+        d_spectra.resize(d_num_doppler_bins, std::vector<gr_complex>(d_fft_size));
+        d_magnitude.resize(d_fft_size);
+    }
+
+    Acq_Stage_Times run(const std::string& mode, uint32_t channels)
+    {
+        Acq_Stage_Times times;
+        Stage_Clock clock;
+        if (d_cshort)
+            {
+                volk_gnsssdr_16ic_convert_32fc(d_input.data(), d_input_sc.data(), d_consumed_samples);
+            }
+        memcpy(d_input_signal.data(), d_input.data(), d_consumed_samples * sizeof(gr_complex));
+        clock.lap(times.input);
+
+        if (mode == "shared")
+            {
+                // Paid once by the first channel asking for this snapshot
+                Acq_Stage_Times shared;
+                for (uint32_t k = 0; k < d_num_doppler_bins; k++)
+                    {
+                        volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), d_input_signal.data(), d_wipeoffs[k].data(), d_fft_size);
+                        clock.lap(shared.wipeoff);
+                        d_fft_if->execute();
+                        clock.lap(shared.fft);
+                        memcpy(d_spectra[k].data(), d_fft_if->get_outbuf(), d_fft_size * sizeof(gr_complex));
+                        clock.lap(shared.fft);
+                    }
+                times.wipeoff += shared.wipeoff / static_cast<double>(channels);
+                times.fft += shared.fft / static_cast<double>(channels);
+            }
+        else if (mode == "fft_shift")
+            {
+                memcpy(d_fft_if->get_inbuf(), d_input_signal.data(), d_fft_size * sizeof(gr_complex));
+                clock.lap(times.wipeoff);
+                d_fft_if->execute();
+                clock.lap(times.fft);
+            }
+
+        uint32_t peak_index = 0;
+        for (uint32_t k = 0; k < d_num_doppler_bins; k++)
+            {
+                if (mode == "grid")
+                    {
+                        volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), d_input_signal.data(), d_wipeoffs[k].data(), d_fft_size);
+                        clock.lap(times.wipeoff);
+                        d_fft_if->execute();
+                        clock.lap(times.fft);
+                        volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+                    }
+                else if (mode == "fft_shift")
+                    {
+                        uint32_t shift = d_shifts[k];
+                        volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf() + shift, d_fft_codes.data(), d_fft_size - shift);
+                        volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf() + d_fft_size - shift, d_fft_if->get_outbuf(), d_fft_codes.data() + d_fft_size - shift, shift);
+                    }
+                else
+                    {
+                        volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_spectra[k].data(), d_fft_codes.data(), d_fft_size);
+                    }
+                clock.lap(times.code_multiply);
+                d_ifft->execute();
+                clock.lap(times.ifft);
+                size_t offset = d_bit_transition ? d_effective_fft_size : 0;
+                volk_32fc_magnitude_squared_32f(d_magnitude.data(), d_ifft->get_outbuf() + offset, d_effective_fft_size);
+                clock.lap(times.magnitude);
+                volk_gnsssdr_32f_index_max_32u(&peak_index, d_magnitude.data(), d_effective_fft_size);
+                clock.lap(times.peak_search);
+            }
+        return times;
+    }
+
+private:
+    bool d_bit_transition;
+    bool d_cshort;
+    uint32_t d_consumed_samples;
+    uint32_t d_fft_size;
+    uint32_t d_effective_fft_size;
+    uint32_t d_num_doppler_bins;
+    std::unique_ptr<Gnss_Fft> d_fft_if;
+    std::unique_ptr<Gnss_Fft> d_ifft;
+    std::vector<lv_16sc_t> d_input_sc;
+    std::vector<gr_complex> d_input;
+    std::vector<gr_complex> d_input_signal;
+    std::vector<gr_complex> d_fft_codes;
+    std::vector<std::vector<gr_complex>> d_wipeoffs;
+    std::vector<uint32_t> d_shifts;
+    std::vector<std::vector<gr_complex>> d_spectra;
+    std::vector<float> d_magnitude;
+};
+}  // namespace
+
+
+TEST(AcqBenchmarkTest, BlockThroughput)
+{
+    std::ofstream csv;
+    if (!FLAGS_acq_benchmark_output.empty())
+        {
+            bool new_file = !std::ifstream(FLAGS_acq_benchmark_output).good();
+            csv.open(FLAGS_acq_benchmark_output, std::ios::app);
+            ASSERT_TRUE(csv.is_open()) << "Cannot open " << FLAGS_acq_benchmark_output;
+            if (new_file)
+                {
+                    csv << "mode,fs_sps,dwell_ms,doppler_max_hz,doppler_step_hz,bit_transition,input,channels,threads,"
+                        << "us_per_acquisition,acquisitions_per_second_per_core" << std::endl;
+                }
+        }
+
+    const std::vector<std::string> modes = {"grid", "streaming", "fft_shift", "shared", "fixed_point", "doppler_workers"};
+    const auto doppler_step = static_cast<uint32_t>(FLAGS_acq_benchmark_doppler_step);
+    const auto iterations = static_cast<uint32_t>(std::max(FLAGS_acq_benchmark_iterations, 1));
+    const auto channels = static_cast<uint32_t>(std::max(FLAGS_acq_benchmark_channels, 1));
+    const auto doppler_workers = static_cast<uint32_t>(std::max(FLAGS_acq_benchmark_doppler_workers, 1));
+    for (int64_t fs : parse_list(FLAGS_acq_benchmark_fs))
+        {
+            for (int64_t dwell_ms : parse_list(FLAGS_acq_benchmark_dwell_ms))
+                {
+                    for (int64_t doppler_max : parse_list(FLAGS_acq_benchmark_doppler_max))
+                        {
+                            for (bool bit_transition : {false, true})
+                                {
+                                    Acq_Grid_Size grid(fs, dwell_ms, doppler_max, doppler_step, bit_transition);
+                                    for (bool cshort : {false, true})
+                                        {
+                                            for (const auto& mode : modes)
+                                                {
+                                                    // Skip the modes that the block would replace by the plain grid search
+                                                    if ((mode == "fft_shift" and !grid.fft_shift_aligned) or (mode == "fixed_point" and !cshort))
+                                                        {
+                                                            continue;
+                                                        }
+                                                    double us = time_block(mode, fs, dwell_ms, doppler_max, doppler_step, bit_transition, cshort, channels, doppler_workers, iterations);
+                                                    EXPECT_GT(us, 0.0);
+                                                    uint32_t mode_channels = (mode == "shared") ? channels : 1;
+                                                    uint32_t threads = (mode == "doppler_workers") ? doppler_workers : 1;
+                                                    std::cout << "Acquisition block " << mode << " fs=" << fs << " dwell=" << dwell_ms << " ms doppler=+-" << doppler_max
+                                                              << " Hz bit_transition=" << bit_transition << (cshort ? " cshort" : " gr_complex")
+                                                              << " : " << us << " [us] per acquisition" << std::endl;
+                                                    if (csv.is_open())
+                                                        {
+                                                            csv << mode << "," << fs << "," << dwell_ms << "," << doppler_max << "," << doppler_step << ","
+                                                                << bit_transition << "," << (cshort ? "cshort" : "gr_complex") << ","
+                                                                << mode_channels << "," << threads << "," << us << "," << 1e6 / us / static_cast<double>(threads) << std::endl;
+                                                        }
+                                                }
+                                        }
+                                }
+                        }
+                }
+        }
+}
+
+
+TEST(AcqBenchmarkTest, StageTimings)
+{
+    std::ofstream csv;
+    if (!FLAGS_acq_benchmark_stage_output.empty())
+        {
+            bool new_file = !std::ifstream(FLAGS_acq_benchmark_stage_output).good();
+            csv.open(FLAGS_acq_benchmark_stage_output, std::ios::app);
+            ASSERT_TRUE(csv.is_open()) << "Cannot open " << FLAGS_acq_benchmark_stage_output;
+            if (new_file)
+                {
+                    csv << "mode,fs_sps,dwell_ms,doppler_max_hz,doppler_step_hz,bit_transition,input,fft_size,doppler_bins,"
+                        << "input_us,wipeoff_us,fft_us,code_multiply_us,ifft_us,magnitude_us,peak_search_us,total_us,acquisitions_per_second_per_core" << std::endl;
+                }
+        }
+
+    const std::vector<std::string> modes = {"grid", "fft_shift", "shared"};
+    const auto doppler_step = static_cast<uint32_t>(FLAGS_acq_benchmark_doppler_step);
+    const auto iterations = static_cast<uint32_t>(std::max(FLAGS_acq_benchmark_iterations, 1));
+    const auto channels = static_cast<uint32_t>(std::max(FLAGS_acq_benchmark_channels, 1));
+    for (int64_t fs : parse_list(FLAGS_acq_benchmark_fs))
+        {
+            for (int64_t dwell_ms : parse_list(FLAGS_acq_benchmark_dwell_ms))
+                {
+                    for (int64_t doppler_max : parse_list(FLAGS_acq_benchmark_doppler_max))
+                        {
+                            for (bool bit_transition : {false, true})
+                                {
+                                    Acq_Grid_Size grid(fs, dwell_ms, doppler_max, doppler_step, bit_transition);
+                                    for (bool cshort : {false, true})
+                                        {
+                                            Acq_Benchmark benchmark(fs, grid, doppler_max, doppler_step, bit_transition, cshort);
+                                            for (const auto& mode : modes)
+                                                {
+                                                    if (mode == "fft_shift" and !grid.fft_shift_aligned)
+                                                        {
+                                                            continue;
+                                                        }
+                                                    benchmark.run(mode, channels);  // warm-up
+                                                    Acq_Stage_Times sum;
+                                                    for (uint32_t n = 0; n < iterations; n++)
+                                                        {
+                                                            Acq_Stage_Times t = benchmark.run(mode, channels);
+                                                            sum.input += t.input;
+                                                            sum.wipeoff += t.wipeoff;
+                                                            sum.fft += t.fft;
+                                                            sum.code_multiply += t.code_multiply;
+                                                            sum.ifft += t.ifft;
+                                                            sum.magnitude += t.magnitude;
+                                                            sum.peak_search += t.peak_search;
+                                                        }
+                                                    double total_us = sum.total() / static_cast<double>(iterations);
+                                                    EXPECT_GT(total_us, 0.0);
+                                                    std::cout << "Acquisition " << mode << " fs=" << fs << " dwell=" << dwell_ms << " ms doppler=+-" << doppler_max
+                                                              << " Hz bit_transition=" << bit_transition << (cshort ? " cshort" : " gr_complex")
+                                                              << " : " << total_us << " [us] per dwell" << std::endl;
+                                                    if (csv.is_open())
+                                                        {
+                                                            double n = static_cast<double>(iterations);
+                                                            csv << mode << "," << fs << "," << dwell_ms << "," << doppler_max << "," << doppler_step << ","
+                                                                << bit_transition << "," << (cshort ? "cshort" : "gr_complex") << ","
+                                                                << grid.fft_size << "," << grid.num_doppler_bins << ","
+                                                                << sum.input / n << "," << sum.wipeoff / n << "," << sum.fft / n << ","
+                                                                << sum.code_multiply / n << "," << sum.ifft / n << "," << sum.magnitude / n << ","
+                                                                << sum.peak_search / n << "," << total_us << "," << 1e6 / total_us << std::endl;
+                                                        }
+                                                }
+                                        }
+                                }
+                        }
+                }
+        }
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file acq_code_spectra_cache_test.cc
+ * \brief Tests for the cache of code spectra shared by the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_code_spectra_cache.h"
+#include <gtest/gtest.h>
+
+
+TEST(AcqCodeSpectraCacheTest, ComputesEachSpectrumOnce)
+{
+    Acq_Code_Spectra_Cache& cache = Acq_Code_Spectra_Cache::instance();
+    cache.clear();
+    uint64_t misses = cache.misses();
+    int calls = 0;
+    auto compute = [&calls](Acq_Code_Spectrum& code_spectrum) {
+        calls++;
+        for (uint32_t k = 0; k < code_spectrum.fft_size(); k++)
+            {
+                code_spectrum.spectrum()[k] = std::complex<float>(static_cast<float>(k), -1.0);
+            }
+    };
+
+    Acq_Code_Key key;
+    key.block = "pcps";
+    key.code_id = "1C";
+    key.prn = 7;
+    key.fs = 4000000;
+    key.fft_size = 16;
+    key.dwell_samples = 16;
+    EXPECT_TRUE(cache.find(key) == nullptr);
+    Acq_Code_Spectra_Cache::Spectrum_sptr first = cache.get(key, 0, compute);
+    Acq_Code_Spectra_Cache::Spectrum_sptr second = cache.get(key, 0, compute);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first.get(), cache.find(key).get());
+    EXPECT_EQ(second->spectrum()[3], std::complex<float>(3.0, -1.0));
+    EXPECT_TRUE(second->code() == nullptr);
+
+    // Any change in the PRN, sampling rate or dwell length gives another spectrum
+    key.prn = 8;
+    cache.get(key, 0, compute);
+    key.fs = 8000000;
+    cache.get(key, 0, compute);
+    key.dwell_samples = 8;
+    cache.get(key, 0, compute);
+    EXPECT_EQ(calls, 4);
+    EXPECT_EQ(cache.size(), 4U);
+    EXPECT_EQ(cache.misses(), misses + 4);
+    cache.clear();
+}
+
+
+TEST(AcqCodeSpectraCacheTest, KeepsTheTimeDomainCode)
+{
+    Acq_Code_Spectra_Cache& cache = Acq_Code_Spectra_Cache::instance();
+    cache.clear();
+    Acq_Code_Key key;
+    key.block = "quicksync_2";
+    key.code_id = "1C";
+    key.prn = 1;
+    key.fs = 2000000;
+    key.fft_size = 8;
+    key.dwell_samples = 16;
+    Acq_Code_Spectra_Cache::Spectrum_sptr spectrum = cache.get(key, 16, [](Acq_Code_Spectrum& code_spectrum) {
+        for (uint32_t k = 0; k < code_spectrum.code_size(); k++)
+            {
+                code_spectrum.code()[k] = std::complex<float>(1.0, static_cast<float>(k));
+            }
+    });
+    ASSERT_EQ(spectrum->code_size(), 16U);
+    EXPECT_EQ(spectrum->code()[15], std::complex<float>(1.0, 15.0));
+    cache.clear();
+}
@@ -0,0 +1,126 @@
+/*!
+ * \file acq_decimator_test.cc
+ * \brief Tests for the polyphase decimator of the acquisition input
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_decimator.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+std::vector<std::complex<float>> tone(double cycles_per_sample, uint32_t n)
+{
+    std::vector<std::complex<float>> samples(n);
+    for (uint32_t i = 0; i < n; i++)
+        {
+            double phase = 2.0 * M_PI * cycles_per_sample * static_cast<double>(i);
+            samples[i] = std::complex<float>(std::cos(phase), std::sin(phase));
+        }
+    return samples;
+}
+}  // namespace
+
+
+TEST(AcqDecimatorTest, ChoosesTheLowestSmoothRate)
+{
+    // 50 Msps and GPS L1 C/A: 2.5 Msps is the lowest rate above 2 samples
+    // per chip with a smooth number of samples per millisecond (2500)
+    EXPECT_EQ(Acq_Decimator::choose_decimation(50000000, 1.023e6), 20U);
+    // 14 Msps has no smooth divisor, so the largest valid decimation is used
+    EXPECT_EQ(Acq_Decimator::choose_decimation(14000000, 1.023e6), 5U);
+    // Already below 2 samples per chip
+    EXPECT_EQ(Acq_Decimator::choose_decimation(2000000, 1.023e6), 1U);
+    EXPECT_TRUE(Acq_Decimator::is_smooth(2500));
+    EXPECT_FALSE(Acq_Decimator::is_smooth(2800));
+    EXPECT_THROW(Acq_Decimator(4, 3), std::invalid_argument);
+}
+
+
+TEST(AcqDecimatorTest, OutputSamplesAreAlignedWithTheInput)
+{
+    const uint32_t decimation = 4;
+    Acq_Decimator decimator(decimation);
+    std::vector<std::complex<float>> in = tone(0.02, 4000);
+    std::vector<std::complex<float>> out(in.size() / decimation);
+    uint32_t produced = decimator.filter(in.data(), in.size(), out.data());
+    ASSERT_GT(produced, 900U);
+
+    // Output n is input n * decimation, once the filter history is full
+    for (uint32_t n = 16; n < produced; n++)
+        {
+            EXPECT_LT(std::abs(out[n] - in[n * decimation]), 1e-2) << "at output " << n;
+        }
+}
+
+
+TEST(AcqDecimatorTest, RejectsTheAliases)
+{
+    const uint32_t decimation = 4;
+    Acq_Decimator decimator(decimation);
+    // Folds onto 0.2 of the output rate without the low-pass filter
+    std::vector<std::complex<float>> in = tone(0.3, 4000);
+    std::vector<std::complex<float>> out(in.size() / decimation);
+    uint32_t produced = decimator.filter(in.data(), in.size(), out.data());
+    double power = 0.0;
+    for (uint32_t n = 16; n < produced; n++)
+        {
+            power += std::norm(out[n]);
+        }
+    EXPECT_LT(power / static_cast<double>(produced - 16), 1e-3);
+}
+
+
+TEST(AcqDecimatorTest, ChunksGiveTheSameOutput)
+{
+    const uint32_t decimation = 5;
+    std::vector<std::complex<float>> in = tone(0.01, 1003);
+    Acq_Decimator whole(decimation);
+    std::vector<std::complex<float>> expected(in.size());
+    uint32_t expected_size = whole.filter(in.data(), in.size(), expected.data());
+
+    Acq_Decimator chunked(decimation);
+    std::vector<std::complex<float>> out(in.size());
+    uint32_t produced = 0;
+    uint32_t consumed = 0;
+    const uint32_t chunks[] = {1, 7, 64, 3, 500};
+    for (uint32_t chunk : chunks)
+        {
+            produced += chunked.filter(in.data() + consumed, chunk, out.data() + produced);
+            consumed += chunk;
+        }
+    produced += chunked.filter(in.data() + consumed, in.size() - consumed, out.data() + produced);
+    ASSERT_EQ(produced, expected_size);
+    for (uint32_t n = 0; n < produced; n++)
+        {
+            EXPECT_LT(std::abs(out[n] - expected[n]), 1e-5);
+        }
+}
@@ -0,0 +1,108 @@
+/*!
+ * \file acq_dump_writer_test.cc
+ * \brief Tests for the background writer of acquisition dump files
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_dump_writer.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+TEST(AcqDumpWriterTest, BlockPolicyWritesEverything)
+{
+    std::atomic<int> written(0);
+    {
+        Acq_Dump_Writer writer(2, Acq_Dump_Writer::Full_Queue_Policy::Block);
+        for (int i = 0; i < 20; i++)
+            {
+                EXPECT_TRUE(writer.push([&written] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    written++;
+                }));
+            }
+        writer.flush();
+        EXPECT_EQ(written.load(), 20);
+        EXPECT_EQ(writer.written(), 20U);
+        EXPECT_EQ(writer.dropped(), 0U);
+    }
+}
+
+
+TEST(AcqDumpWriterTest, DropPolicyNeverWaitsForTheWriter)
+{
+    std::mutex mtx;
+    std::condition_variable cond;
+    bool release = false;
+    std::atomic<int> written(0);
+    auto slow_task = [&] {
+        std::unique_lock<std::mutex> lock(mtx);
+        cond.wait(lock, [&release] { return release; });
+        written++;
+    };
+
+    Acq_Dump_Writer writer(2, Acq_Dump_Writer::Full_Queue_Policy::Drop);
+    EXPECT_TRUE(writer.push(slow_task));  // taken by the writer thread, which then waits
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(writer.push(slow_task));
+    EXPECT_TRUE(writer.push(slow_task));
+    EXPECT_FALSE(writer.push(slow_task));  // queue full
+    EXPECT_EQ(writer.dropped(), 1U);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        release = true;
+    }
+    cond.notify_all();
+    writer.flush();
+    EXPECT_EQ(written.load(), 3);
+}
+
+
+TEST(AcqDumpWriterTest, DestructorWritesThePendingTasks)
+{
+    std::atomic<int> written(0);
+    {
+        Acq_Dump_Writer writer(8, Acq_Dump_Writer::Full_Queue_Policy::Drop);
+        for (int i = 0; i < 8; i++)
+            {
+                writer.push([&written] { written++; });
+            }
+    }
+    EXPECT_EQ(written.load(), 8);
+}
+
+
+TEST(AcqDumpWriterTest, ParsesThePolicy)
+{
+    EXPECT_TRUE(Acq_Dump_Writer::policy_from_string("drop") == Acq_Dump_Writer::Full_Queue_Policy::Drop);
+    EXPECT_TRUE(Acq_Dump_Writer::policy_from_string("block") == Acq_Dump_Writer::Full_Queue_Policy::Block);
+    EXPECT_TRUE(Acq_Dump_Writer::policy_from_string("whatever") == Acq_Dump_Writer::Full_Queue_Policy::Block);
+}
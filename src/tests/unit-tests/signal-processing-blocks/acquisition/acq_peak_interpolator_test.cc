@@ -0,0 +1,101 @@
+/*!
+ * \file acq_peak_interpolator_test.cc
+ * \brief Tests for the sub-bin interpolation of the acquisition peak
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_peak_interpolator.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+double sinc_amplitude(double x, double bin_width)
+{
+    double arg = M_PI * x * bin_width;
+    return std::abs(arg) < 1e-12 ? 1.0 : std::abs(std::sin(arg) / arg);
+}
+
+double triangle_amplitude(double x, double half_width)
+{
+    return std::max(0.0, 1.0 - std::abs(x) / half_width);
+}
+}  // namespace
+
+
+TEST(AcqPeakInterpolatorTest, ParsesTheMethodNames)
+{
+    EXPECT_TRUE(Acq_Peak_Interpolator::method_from_string("none") == Acq_Peak_Interpolator::Method::None);
+    EXPECT_TRUE(Acq_Peak_Interpolator::method_from_string("parabolic") == Acq_Peak_Interpolator::Method::Parabolic);
+    EXPECT_TRUE(Acq_Peak_Interpolator::method_from_string("sinc") == Acq_Peak_Interpolator::Method::Sinc);
+    EXPECT_TRUE(Acq_Peak_Interpolator::method_from_string("spline") == Acq_Peak_Interpolator::Method::None);
+}
+
+
+TEST(AcqPeakInterpolatorTest, ParabolicFindsTheVertex)
+{
+    auto parabola = [](double x) { return 10.0 - (x - 0.3) * (x - 0.3); };
+    EXPECT_NEAR(Acq_Peak_Interpolator::parabolic_offset(parabola(-1.0), parabola(0.0), parabola(1.0)), 0.3, 1e-9);
+    EXPECT_NEAR(Acq_Peak_Interpolator::parabolic_offset(4.0, 5.0, 4.0), 0.0, 1e-9);
+    // Not a peak, or flat
+    EXPECT_EQ(Acq_Peak_Interpolator::parabolic_offset(6.0, 5.0, 1.0), 0.0);
+    EXPECT_EQ(Acq_Peak_Interpolator::parabolic_offset(5.0, 5.0, 5.0), 0.0);
+}
+
+
+TEST(AcqPeakInterpolatorTest, SincRecoversTheDopplerOffset)
+{
+    // 250 Hz bins over 1 ms of coherent integration
+    const double bin_width = 0.25;
+    for (double offset : {-0.45, -0.2, 0.0, 0.1, 0.35})
+        {
+            double left = sinc_amplitude(-1.0 - offset, bin_width);
+            double center = sinc_amplitude(-offset, bin_width);
+            double right = sinc_amplitude(1.0 - offset, bin_width);
+            EXPECT_NEAR(Acq_Peak_Interpolator::sinc_offset(left, center, right, bin_width), offset, 1e-6);
+        }
+    // The parabola is biased on the same shape
+    double left = sinc_amplitude(-1.35, 0.5);
+    double center = sinc_amplitude(-0.35, 0.5);
+    double right = sinc_amplitude(0.65, 0.5);
+    EXPECT_GT(std::abs(Acq_Peak_Interpolator::parabolic_offset(left, center, right) - 0.35), 0.01);
+    EXPECT_NEAR(Acq_Peak_Interpolator::sinc_offset(left, center, right, 0.5), 0.35, 1e-6);
+}
+
+
+TEST(AcqPeakInterpolatorTest, TriangleRecoversTheCodeDelay)
+{
+    const double half_width = 4.0;  // samples per chip
+    for (double offset : {-0.5, -0.25, 0.0, 0.4})
+        {
+            double left = triangle_amplitude(-1.0 - offset, half_width);
+            double center = triangle_amplitude(-offset, half_width);
+            double right = triangle_amplitude(1.0 - offset, half_width);
+            EXPECT_NEAR(Acq_Peak_Interpolator::triangle_offset(left, center, right, half_width), offset, 1e-9);
+        }
+}
@@ -67,6 +67,7 @@ DEFINE_bool(acq_test_bit_transition_flag, false, "Bit transition flag.");
 DEFINE_bool(acq_test_make_two_steps, false, "Perform second step in a thinner grid.");
 DEFINE_int32(acq_test_second_nbins, 4, "If --acq_test_make_two_steps is set to true, this parameter sets the number of bins done in the acquisition refinement stage.");
 DEFINE_int32(acq_test_second_doppler_step, 10, "If --acq_test_make_two_steps is set to true, this parameter sets the Doppler step applied in the acquisition refinement stage, in Hz.");
+DEFINE_bool(acq_test_fft_doppler_shift, false, "Remove the Doppler by shifting a single FFT of the input signal.");
 
 DEFINE_int32(acq_test_signal_duration_s, 2, "Generated signal duration, in s");
 DEFINE_int32(acq_test_num_meas, 0, "Number of measurements per run. 0 means the complete file.");
@@ -525,6 +526,15 @@ int AcquisitionPerformanceTest::configure_receiver(double cn0, float pfa, unsign
                     config->set_property("Acquisition.make_two_steps", "false");
                 }
 
+            if (FLAGS_acq_test_fft_doppler_shift)
+                {
+                    config->set_property("Acquisition.fft_doppler_shift", "true");
+                }
+            else
+                {
+                    config->set_property("Acquisition.fft_doppler_shift", "false");
+                }
+
             if (FLAGS_acq_test_dump)
                 {
                     config->set_property("Acquisition.dump", "true");
@@ -771,6 +781,194 @@ void AcquisitionPerformanceTest::plot_results()
 }
 
 
+// Runs a GPS L1 C/A acquisition over the reference file and returns the dumped grid
+bool run_fft_doppler_shift_acquisition(bool fft_doppler_shift, const std::string& dump_path, acquisition_dump_reader& acq_dump)
+{
+    const unsigned int fs_in = 4000000;
+    const unsigned int doppler_max = 5000;
+    const unsigned int doppler_step = 1000;  // multiple of the FFT bin width (fs_in / fft_size = 1 kHz)
+
+    std::shared_ptr<InMemoryConfiguration> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_in));
+    config->set_property("Acquisition.item_type", "gr_complex");
+    config->set_property("Acquisition.coherent_integration_time_ms", "1");
+    config->set_property("Acquisition.use_CFAR_algorithm", "true");
+    config->set_property("Acquisition.blocking", "true");
+    config->set_property("Acquisition.dump", "true");
+    config->set_property("Acquisition.dump_filename", dump_path + "/acquisition");
+    config->set_property("Acquisition.dump_channel", "0");
+    config->set_property("Acquisition.fft_doppler_shift", fft_doppler_shift ? "true" : "false");
+
+    Gnss_Synchro gnss_synchro = Gnss_Synchro();
+    gnss_synchro.Channel_ID = 0;
+    gnss_synchro.System = 'G';
+    std::string signal = "1C";
+    signal.copy(gnss_synchro.Signal, 2, 0);
+    gnss_synchro.PRN = 1;
+
+    concurrent_queue<int> channel_internal_queue;
+    gr::top_block_sptr top_block = gr::make_top_block("FFT Doppler shift acquisition test");
+    boost::shared_ptr<AcqPerfTest_msg_rx> msg_rx = AcqPerfTest_msg_rx_make(channel_internal_queue);
+    std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+    acquisition->set_gnss_synchro(&gnss_synchro);
+    acquisition->set_channel(0);
+    acquisition->set_threshold(0.001);
+    acquisition->set_doppler_max(doppler_max);
+    acquisition->set_doppler_step(doppler_step);
+    acquisition->connect(top_block);
+
+    std::string file = std::string(TEST_PATH) + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+    gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(gr_complex), file.c_str(), false);
+    top_block->connect(file_source, 0, acquisition->get_left_block(), 0);
+    top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+
+    acquisition->set_local_code();
+    acquisition->set_state(1);
+    acquisition->init();
+    top_block->run();
+
+    return acq_dump.read_binary_acq();
+}
+
+
+TEST(AcqFftDopplerShiftTest, GridMatchesTimeDomainWipeoff)
+{
+    const std::string path_time = "./acq-fft-shift-test-time";
+    const std::string path_freq = "./acq-fft-shift-test-freq";
+    const unsigned int samples_per_code = 4000;
+    for (const auto& p : {path_time, path_freq})
+        {
+            if (boost::filesystem::exists(p))
+                {
+                    boost::filesystem::remove_all(p);
+                }
+            boost::filesystem::create_directory(p);
+        }
+
+    acquisition_dump_reader dump_time(path_time + "/acquisition_G_1C", 1, 5000, 1000, samples_per_code, 0, 1);
+    acquisition_dump_reader dump_freq(path_freq + "/acquisition_G_1C", 1, 5000, 1000, samples_per_code, 0, 1);
+    ASSERT_TRUE(run_fft_doppler_shift_acquisition(false, path_time, dump_time));
+    ASSERT_TRUE(run_fft_doppler_shift_acquisition(true, path_freq, dump_freq));
+
+    // Both grids are mathematically identical; they differ only in floating-point rounding
+    ASSERT_EQ(dump_time.mag.size(), dump_freq.mag.size());
+    float max_value = 0.0;
+    for (const auto& row : dump_time.mag)
+        {
+            max_value = std::max(max_value, *std::max_element(row.begin(), row.end()));
+        }
+    for (size_t i = 0; i < dump_time.mag.size(); i++)
+        {
+            for (size_t k = 0; k < samples_per_code; k++)
+                {
+                    ASSERT_NEAR(dump_time.mag[i][k], dump_freq.mag[i][k], 1e-4 * max_value) << "Doppler bin " << i << ", sample " << k;
+                }
+        }
+    EXPECT_EQ(dump_time.acq_doppler_hz, dump_freq.acq_doppler_hz);
+    EXPECT_EQ(dump_time.acq_delay_samples, dump_freq.acq_delay_samples);
+    EXPECT_NEAR(dump_time.test_statistic, dump_freq.test_statistic, 1e-4 * dump_time.test_statistic);
+
+    boost::filesystem::remove_all(path_time);
+    boost::filesystem::remove_all(path_freq);
+}
+
+
+void run_peak_tracking_acquisition(bool dump, const std::string& dump_path, Gnss_Synchro& gnss_synchro, unsigned int doppler_workers = 1)
+{
+    const unsigned int fs_in = 4000000;
+
+    std::shared_ptr<InMemoryConfiguration> config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs_in));
+    config->set_property("Acquisition.item_type", "gr_complex");
+    config->set_property("Acquisition.coherent_integration_time_ms", "1");
+    config->set_property("Acquisition.use_CFAR_algorithm", "false");
+    config->set_property("Acquisition.blocking", "true");
+    config->set_property("Acquisition.dump", dump ? "true" : "false");
+    config->set_property("Acquisition.dump_filename", dump_path + "/acquisition");
+    config->set_property("Acquisition.dump_channel", "0");
+    config->set_property("Acquisition.doppler_workers", std::to_string(doppler_workers));
+
+    gnss_synchro = Gnss_Synchro();
+    gnss_synchro.Channel_ID = 0;
+    gnss_synchro.System = 'G';
+    std::string signal = "1C";
+    signal.copy(gnss_synchro.Signal, 2, 0);
+    gnss_synchro.PRN = 1;
+
+    concurrent_queue<int> channel_internal_queue;
+    gr::top_block_sptr top_block = gr::make_top_block("Peak tracking acquisition test");
+    boost::shared_ptr<AcqPerfTest_msg_rx> msg_rx = AcqPerfTest_msg_rx_make(channel_internal_queue);
+    std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition", 1, 0);
+    acquisition->set_gnss_synchro(&gnss_synchro);
+    acquisition->set_channel(0);
+    acquisition->set_threshold(1.5);
+    acquisition->set_doppler_max(5000);
+    acquisition->set_doppler_step(250);
+    acquisition->connect(top_block);
+
+    std::string file = std::string(TEST_PATH) + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+    gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(gr_complex), file.c_str(), false);
+    top_block->connect(file_source, 0, acquisition->get_left_block(), 0);
+    top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+
+    acquisition->set_local_code();
+    acquisition->set_state(1);
+    acquisition->init();
+    top_block->run();
+}
+
+
+TEST(AcqPeakTrackingTest, StreamingPeaksMatchFullGrid)
+{
+    // With dump enabled the block keeps the whole magnitude grid, otherwise
+    // it tracks the peaks row by row. Both must find the same cell.
+    const std::string path = "./acq-peak-tracking-test";
+    if (boost::filesystem::exists(path))
+        {
+            boost::filesystem::remove_all(path);
+        }
+    boost::filesystem::create_directory(path);
+
+    Gnss_Synchro full_grid;
+    Gnss_Synchro streaming;
+    run_peak_tracking_acquisition(true, path, full_grid);
+    run_peak_tracking_acquisition(false, path, streaming);
+
+    EXPECT_EQ(full_grid.Acq_doppler_hz, streaming.Acq_doppler_hz);
+    EXPECT_EQ(full_grid.Acq_delay_samples, streaming.Acq_delay_samples);
+    EXPECT_EQ(full_grid.Acq_samplestamp_samples, streaming.Acq_samplestamp_samples);
+
+    boost::filesystem::remove_all(path);
+}
+
+
+TEST(AcqPeakTrackingTest, DopplerWorkersMatchSerialSearch)
+{
+    // Splitting the Doppler bins among several workers must find the same
+    // cell as a single worker, both with and without the full grid.
+    const std::string path = "./acq-doppler-workers-test";
+    if (boost::filesystem::exists(path))
+        {
+            boost::filesystem::remove_all(path);
+        }
+    boost::filesystem::create_directory(path);
+
+    for (bool dump : {false, true})
+        {
+            Gnss_Synchro serial;
+            Gnss_Synchro parallel;
+            run_peak_tracking_acquisition(dump, path, serial, 1);
+            run_peak_tracking_acquisition(dump, path, parallel, 4);
+
+            EXPECT_EQ(serial.Acq_doppler_hz, parallel.Acq_doppler_hz);
+            EXPECT_EQ(serial.Acq_delay_samples, parallel.Acq_delay_samples);
+            EXPECT_EQ(serial.Acq_samplestamp_samples, parallel.Acq_samplestamp_samples);
+        }
+
+    boost::filesystem::remove_all(path);
+}
+
+
 TEST_F(AcquisitionPerformanceTest, ROC)
 {
     tracking_true_obs_reader true_trk_data;
@@ -0,0 +1,123 @@
+/*!
+ * \file acq_sample_ring_test.cc
+ * \brief Tests for the sample ring shared by the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_sample_ring.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <complex>
+#include <thread>
+#include <vector>
+
+
+TEST(AcqSampleRingTest, ReadsAcrossTheWrapAround)
+{
+    Acq_Sample_Ring ring(sizeof(int32_t), 8);
+    std::vector<int32_t> samples(20);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = static_cast<int32_t>(i);
+        }
+    ring.write(samples.data(), 6);
+    ring.write(samples.data() + 6, 5);
+    EXPECT_EQ(ring.sample_counter(), 11U);
+
+    std::vector<int32_t> out(6);
+    uint64_t start = 5;
+    ASSERT_TRUE(ring.read(start, 6, out.data(), std::chrono::milliseconds(0)) == Acq_Sample_Ring::Read_Status::Ok);
+    EXPECT_EQ(start, 5U);
+    for (size_t i = 0; i < out.size(); i++)
+        {
+            EXPECT_EQ(out[i], static_cast<int32_t>(5 + i));
+        }
+}
+
+
+TEST(AcqSampleRingTest, SkipsOverwrittenSamples)
+{
+    Acq_Sample_Ring ring(sizeof(int32_t), 8);
+    std::vector<int32_t> samples(20);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = static_cast<int32_t>(i);
+        }
+    ring.write(samples.data(), 20);
+
+    std::vector<int32_t> out(4);
+    uint64_t start = 2;
+    ASSERT_TRUE(ring.read(start, 4, out.data(), std::chrono::milliseconds(0)) == Acq_Sample_Ring::Read_Status::Ok);
+    EXPECT_EQ(start, 12U);  // oldest sample still held
+    EXPECT_EQ(out[0], 12);
+    EXPECT_EQ(ring.skipped(), 10U);
+}
+
+
+TEST(AcqSampleRingTest, WaitsForFutureSamples)
+{
+    Acq_Sample_Ring ring(sizeof(std::complex<float>), 1000);
+    std::vector<std::complex<float>> out(100);
+    uint64_t start = 0;
+    EXPECT_TRUE(ring.read(start, 100, out.data(), std::chrono::milliseconds(10)) == Acq_Sample_Ring::Read_Status::Timeout);
+
+    std::thread writer([&ring] {
+        std::vector<std::complex<float>> samples(10, std::complex<float>(1.0, -1.0));
+        for (int i = 0; i < 10; i++)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                ring.write(samples.data(), samples.size());
+            }
+    });
+    EXPECT_TRUE(ring.read(start, 100, out.data(), std::chrono::seconds(5)) == Acq_Sample_Ring::Read_Status::Ok);
+    EXPECT_EQ(out[99], std::complex<float>(1.0, -1.0));
+    writer.join();
+
+    ring.close();
+    start = 1000;
+    EXPECT_TRUE(ring.read(start, 100, out.data(), std::chrono::seconds(5)) == Acq_Sample_Ring::Read_Status::Closed);
+}
+
+
+TEST(AcqSampleRingTest, RegistryGrowsTheRing)
+{
+    Acq_Sample_Ring_Registry& registry = Acq_Sample_Ring_Registry::instance();
+    registry.clear();
+    std::shared_ptr<Acq_Sample_Ring> ring = registry.get("test_ring", sizeof(int32_t), 4);
+    std::vector<int32_t> samples = {1, 2, 3, 4, 5, 6};
+    ring->write(samples.data(), samples.size());
+
+    EXPECT_EQ(registry.get("test_ring", sizeof(int32_t), 16).get(), ring.get());
+    EXPECT_EQ(ring->capacity(), 16U);
+    std::vector<int32_t> out(4);
+    uint64_t start = 2;
+    ASSERT_TRUE(ring->read(start, 4, out.data(), std::chrono::milliseconds(0)) == Acq_Sample_Ring::Read_Status::Ok);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[3], 6);
+
+    EXPECT_TRUE(registry.get("test_ring", sizeof(int16_t), 16) == nullptr);
+    registry.clear();
+}
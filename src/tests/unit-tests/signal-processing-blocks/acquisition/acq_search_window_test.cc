@@ -0,0 +1,108 @@
+/*!
+ * \file acq_search_window_test.cc
+ * \brief Tests for the store of predicted acquisition search windows
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_search_window.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_frequencies.h"
+#include <gtest/gtest.h>
+
+
+TEST(AcqSearchWindowTest, ScalesTheRangeRateWithTheCarrier)
+{
+    Acq_Search_Window window;
+    window.range_rate_m_s = -500.0;  // approaching satellite
+    window.range_rate_uncertainty_m_s = 100.0;
+    EXPECT_NEAR(window.doppler_hz(FREQ1), 2627.5, 0.1);
+    EXPECT_NEAR(window.doppler_uncertainty_hz(FREQ1), 525.5, 0.1);
+    EXPECT_NEAR(window.doppler_hz(FREQ5) / window.doppler_hz(FREQ1), FREQ5 / FREQ1, 1e-9);
+    EXPECT_FALSE(window.code_phase_valid);
+}
+
+
+TEST(AcqSearchWindowTest, WidensAndExpiresWithAge)
+{
+    Acq_Search_Window window;
+    window.range_rate_m_s = -500.0;
+    window.range_rate_uncertainty_m_s = 100.0;
+    window.uncertainty_growth_m_s2 = 0.2;
+    EXPECT_LT(window.age_s(), 1.0);
+    EXPECT_NEAR(window.doppler_uncertainty_hz(FREQ1, 0.0), 525.5, 0.1);
+    EXPECT_NEAR(window.range_rate_uncertainty_m_s_at(500.0), 200.0, 1e-9);
+    EXPECT_NEAR(window.doppler_uncertainty_hz(FREQ1, 500.0), 1051.0, 0.1);
+    EXPECT_NEAR(window.doppler_hz(FREQ1), 2627.5, 0.1);  // the center is held
+    EXPECT_FALSE(window.expired(1e6));  // no age limit by default
+
+    window.max_age_s = 600.0;
+    EXPECT_FALSE(window.expired(599.0));
+    EXPECT_TRUE(window.expired(601.0));
+
+    window.reference_time_s = Acq_Search_Window::now_s() - 700.0;
+    EXPECT_GE(window.age_s(), 700.0);
+    EXPECT_TRUE(window.expired(window.age_s()));
+}
+
+
+TEST(AcqSearchWindowTest, PropagatesTheCodePhase)
+{
+    Acq_Search_Window window;
+    window.range_rate_m_s = 600.0;  // receding satellite
+    window.range_rate_uncertainty_m_s = 30.0;
+    window.code_phase_valid = true;
+    window.code_phase_s = 100e-6;
+    window.code_phase_window_s = 1e-6;
+    EXPECT_DOUBLE_EQ(window.code_phase_s_at(0.0), 100e-6);
+    EXPECT_NEAR(window.code_phase_s_at(10.0), 100e-6 + 6000.0 / SPEED_OF_LIGHT, 1e-15);
+    EXPECT_NEAR(window.code_phase_window_s_at(10.0), 1e-6 + 300.0 / SPEED_OF_LIGHT, 1e-15);
+    EXPECT_DOUBLE_EQ(window.code_phase_window_s_at(-10.0), window.code_phase_window_s_at(10.0));
+}
+
+
+TEST(AcqSearchWindowTest, StoresOneWindowPerSatellite)
+{
+    Acq_Search_Window_Store& store = Acq_Search_Window_Store::instance();
+    store.clear();
+    Acq_Search_Window window;
+    window.range_rate_m_s = 120.0;
+    store.set('G', 5, window);
+    window.range_rate_m_s = -80.0;
+    store.set('E', 5, window);
+    EXPECT_EQ(store.size(), 2U);
+
+    Acq_Search_Window found;
+    ASSERT_TRUE(store.find('G', 5, found));
+    EXPECT_DOUBLE_EQ(found.range_rate_m_s, 120.0);
+    ASSERT_TRUE(store.find('E', 5, found));
+    EXPECT_DOUBLE_EQ(found.range_rate_m_s, -80.0);
+    EXPECT_FALSE(store.find('G', 6, found));
+
+    store.erase('G', 5);
+    EXPECT_FALSE(store.find('G', 5, found));
+    store.clear();
+    EXPECT_EQ(store.size(), 0U);
+}
@@ -0,0 +1,97 @@
+/*!
+ * \file acq_sequential_test_test.cc
+ * \brief Tests for the sequential test of the accumulated acquisition statistic
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_conf.h"
+#include "acq_sequential_test.h"
+#include <gtest/gtest.h>
+
+
+TEST(AcqSequentialTestTest, DeclaresAboveTheDetectionThreshold)
+{
+    Acq_Sequential_Test test(0.5, 5, false);
+    EXPECT_TRUE(test.decide(3.1, 3.0, 1) == Acq_Sequential_Test::Decision::Positive);
+    EXPECT_TRUE(test.decide(3.1, 3.0, 5) == Acq_Sequential_Test::Decision::Positive);
+}
+
+
+TEST(AcqSequentialTestTest, DismissalThresholdRisesToTheDetectionThreshold)
+{
+    Acq_Sequential_Test test(0.5, 5, false);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(3.0, 1), 1.5);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(3.0, 3), 2.25);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(3.0, 5), 3.0);
+
+    EXPECT_TRUE(test.decide(1.4, 3.0, 1) == Acq_Sequential_Test::Decision::Negative);
+    EXPECT_TRUE(test.decide(2.0, 3.0, 1) == Acq_Sequential_Test::Decision::Continue);
+    EXPECT_TRUE(test.decide(2.0, 3.0, 3) == Acq_Sequential_Test::Decision::Negative);
+    EXPECT_TRUE(test.decide(2.9, 3.0, 4) == Acq_Sequential_Test::Decision::Continue);
+    EXPECT_TRUE(test.decide(2.9, 3.0, 5) == Acq_Sequential_Test::Decision::Negative);
+}
+
+
+TEST(AcqSequentialTestTest, DismissalScalesWithTheDetectionThreshold)
+{
+    Acq_Sequential_Test test(0.5, 5, false);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(10.0, 1), 5.0);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(10.0, 3), 7.5);
+    EXPECT_TRUE(test.decide(6.0, 10.0, 1) == Acq_Sequential_Test::Decision::Continue);
+}
+
+
+TEST(AcqSequentialTestTest, DefaultRatioKeepsTheRemainingDwells)
+{
+    Acq_Conf conf;
+    Acq_Sequential_Test test(conf.sequential_dismissal_ratio, 4, false);
+    EXPECT_LT(test.dismissal_threshold(3.0, 1), 3.0);
+    EXPECT_TRUE(test.decide(2.0, 3.0, 1) == Acq_Sequential_Test::Decision::Continue);
+
+    Acq_Sequential_Test clamped(4.0, 3, false);
+    EXPECT_FLOAT_EQ(clamped.dismissal_threshold(3.0, 1), 3.0);
+    Acq_Sequential_Test single_dwell(0.5, 1, false);
+    EXPECT_TRUE(single_dwell.decide(2.0, 3.0, 1) == Acq_Sequential_Test::Decision::Negative);
+}
+
+
+TEST(AcqSequentialTestTest, AccumulatedStatisticIsComparedWithItsShareOfTheThreshold)
+{
+    // A statistic accumulated over the dwells reaches the threshold only at the last one
+    Acq_Sequential_Test test(0.5, 4, true);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(4.0, 1), 0.5);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(4.0, 2), 4.0 * (2.0 / 3.0) * 0.5);
+    EXPECT_FLOAT_EQ(test.dismissal_threshold(4.0, 4), 4.0);
+
+    // About 1.1 per dwell: detected after four dwells, so it must not be dismissed before
+    EXPECT_TRUE(test.decide(1.1, 4.0, 1) == Acq_Sequential_Test::Decision::Continue);
+    EXPECT_TRUE(test.decide(2.2, 4.0, 2) == Acq_Sequential_Test::Decision::Continue);
+    EXPECT_TRUE(test.decide(3.3, 4.0, 3) == Acq_Sequential_Test::Decision::Continue);
+    EXPECT_TRUE(test.decide(4.4, 4.0, 4) == Acq_Sequential_Test::Decision::Positive);
+
+    // About 0.2 per dwell: dismissed after the first one
+    EXPECT_TRUE(test.decide(0.2, 4.0, 1) == Acq_Sequential_Test::Decision::Negative);
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file acq_shared_engine_test.cc
+ * \brief Tests for the store of input spectra shared by the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_shared_engine.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+TEST(AcqSharedEngineTest, ComputesEachSnapshotOnce)
+{
+    Acq_Shared_Engine& engine = Acq_Shared_Engine::instance();
+    engine.clear();
+    int calls = 0;
+    auto compute = [&calls](Acq_Input_Spectra& spectra) {
+        calls++;
+        for (uint32_t i = 0; i < spectra.size(); i++)
+            {
+                for (uint32_t k = 0; k < spectra.fft_size(); k++)
+                    {
+                        spectra.spectrum(i)[k] = std::complex<float>(static_cast<float>(i), static_cast<float>(k));
+                    }
+            }
+    };
+
+    Acq_Shared_Engine::Spectra_sptr first = engine.get_spectra("1C_test", 4000, 3, 16, compute);
+    Acq_Shared_Engine::Spectra_sptr second = engine.get_spectra("1C_test", 4000, 3, 16, compute);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(second->spectrum(2)[5], std::complex<float>(2.0, 5.0));
+
+    // A different snapshot or a different grid must be computed again
+    engine.get_spectra("1C_test", 8000, 3, 16, compute);
+    engine.get_spectra("1B_test", 4000, 3, 16, compute);
+    EXPECT_EQ(calls, 3);
+    engine.clear();
+}
+
+
+TEST(AcqSharedEngineTest, ConcurrentRequestsWaitForTheFirstComputation)
+{
+    Acq_Shared_Engine& engine = Acq_Shared_Engine::instance();
+    engine.clear();
+    std::atomic<int> calls(0);
+    auto compute = [&calls](Acq_Input_Spectra& spectra) {
+        calls++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        spectra.spectrum(0)[0] = std::complex<float>(1.0, 1.0);
+    };
+
+    std::vector<std::thread> channels;
+    std::vector<Acq_Shared_Engine::Spectra_sptr> results(8);
+    for (size_t i = 0; i < results.size(); i++)
+        {
+            channels.emplace_back([&engine, &results, &compute, i] { results[i] = engine.get_spectra("1C_concurrent", 1000, 1, 8, compute); });
+        }
+    for (auto& t : channels)
+        {
+            t.join();
+        }
+    EXPECT_EQ(calls.load(), 1);
+    for (const auto& r : results)
+        {
+            ASSERT_TRUE(r != nullptr);
+            EXPECT_EQ(r->spectrum(0)[0], std::complex<float>(1.0, 1.0));
+        }
+    engine.clear();
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file acq_wipeoff_store_test.cc
+ * \brief Tests for the store of Doppler wipeoff tables shared by the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_wipeoff_store.h"
+#include <gtest/gtest.h>
+
+
+TEST(AcqWipeoffStoreTest, SharesTablesWhileInUse)
+{
+    Acq_Wipeoff_Store& store = Acq_Wipeoff_Store::instance();
+    size_t tables_before = store.size();
+    int calls = 0;
+    auto fill = [&calls](Acq_Doppler_Wipeoffs& wipeoffs) {
+        calls++;
+        for (uint32_t i = 0; i < wipeoffs.num_bins(); i++)
+            {
+                wipeoffs.row(i)[0] = std::complex<float>(static_cast<float>(i), 0.0);
+            }
+    };
+
+    Acq_Wipeoff_Store::Table_sptr first = store.get("4000000_4000_5000_250_0", 40, 4000, fill);
+    Acq_Wipeoff_Store::Table_sptr second = store.get("4000000_4000_5000_250_0", 40, 4000, fill);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(second->num_bins(), 40U);
+    EXPECT_EQ(second->row(39)[0], std::complex<float>(39.0, 0.0));
+    EXPECT_EQ(store.size(), tables_before + 1);
+
+    // A different grid gets its own table
+    Acq_Wipeoff_Store::Table_sptr other = store.get("4000000_4000_5000_500_0", 20, 4000, fill);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(store.size(), tables_before + 2);
+
+    // Tables are released with their last user, and regenerated on demand
+    first.reset();
+    second.reset();
+    EXPECT_EQ(store.size(), tables_before + 1);
+    store.get("4000000_4000_5000_250_0", 40, 4000, fill);
+    EXPECT_EQ(calls, 3);
+}
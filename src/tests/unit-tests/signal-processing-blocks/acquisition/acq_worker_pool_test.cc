@@ -0,0 +1,195 @@
+/*!
+ * \file acq_worker_pool_test.cc
+ * \brief Tests for the worker pool shared by the acquisition blocks
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "acq_worker_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+TEST(AcqWorkerPoolTest, ExecutesAllJobs)
+{
+    Acq_Worker_Pool& pool = Acq_Worker_Pool::instance();
+    Acq_Worker_Pool_Stats before = pool.get_stats();
+    std::atomic<int> counter(0);
+    int submitted = 0;
+    while (submitted < 100)
+        {
+            if (pool.submit([&counter] { counter++; }))
+                {
+                    submitted++;
+                }
+            else
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+        }
+    while (pool.get_stats().jobs_completed < before.jobs_completed + 100)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    EXPECT_EQ(counter.load(), 100);
+    EXPECT_EQ(pool.get_stats().jobs_submitted, before.jobs_submitted + 100);
+}
+
+
+TEST(AcqWorkerPoolTest, RejectsJobsWhenQueueIsFull)
+{
+    Acq_Worker_Pool& pool = Acq_Worker_Pool::instance();
+    Acq_Worker_Pool_Stats before = pool.get_stats();
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool release = false;
+    std::atomic<uint32_t> running(0);
+    auto blocking_job = [&] {
+        running++;
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&] { return release; });
+    };
+
+    // Keep every worker busy, then fill the queue up to its limit
+    for (uint32_t i = 0; i < before.num_threads; i++)
+        {
+            ASSERT_TRUE(pool.submit(blocking_job));
+        }
+    while (running.load() < before.num_threads)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    for (uint32_t i = 0; i < before.queue_depth_limit; i++)
+        {
+            ASSERT_TRUE(pool.submit(blocking_job));
+        }
+    EXPECT_FALSE(pool.submit(blocking_job));
+    EXPECT_EQ(pool.get_stats().jobs_rejected, before.jobs_rejected + 1);
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        release = true;
+    }
+    cv.notify_all();
+    uint64_t expected = before.jobs_completed + before.num_threads + before.queue_depth_limit;
+    while (pool.get_stats().jobs_completed < expected)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    EXPECT_EQ(pool.get_stats().max_queue_depth, before.queue_depth_limit);
+}
+
+
+TEST(AcqWorkerPoolTest, RunsEveryTaskOnce)
+{
+    Acq_Worker_Pool& pool = Acq_Worker_Pool::instance();
+    std::vector<std::atomic<int>> runs(37);
+    for (auto& r : runs)
+        {
+            r = 0;
+        }
+    pool.run_tasks(static_cast<uint32_t>(runs.size()), [&runs](uint32_t index) { runs[index]++; });
+    for (auto& r : runs)
+        {
+            EXPECT_EQ(r.load(), 1);
+        }
+
+    // Every worker waiting in run_tasks at once must not deadlock: each caller
+    // runs the tasks that no worker picked up
+    const uint32_t num_jobs = pool.num_threads();
+    std::atomic<uint32_t> total(0);
+    std::atomic<uint32_t> finished(0);
+    for (uint32_t j = 0; j < num_jobs; j++)
+        {
+            ASSERT_TRUE(pool.submit([&pool, &total, &finished] {
+                pool.run_tasks(8, [&total](uint32_t) { total++; });
+                finished++;
+            }));
+        }
+    while (finished.load() < num_jobs)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    EXPECT_EQ(total.load(), 8 * num_jobs);
+}
+
+
+TEST(AcqWorkerPoolTest, HelpersDoNotUseTheJobQueue)
+{
+    Acq_Worker_Pool& pool = Acq_Worker_Pool::instance();
+    Acq_Worker_Pool_Stats before = pool.get_stats();
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool release = false;
+    std::atomic<uint32_t> running(0);
+    auto blocking_job = [&] {
+        running++;
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&] { return release; });
+    };
+
+    // Every worker busy and the queue one job short of its limit
+    for (uint32_t i = 0; i < before.num_threads; i++)
+        {
+            ASSERT_TRUE(pool.submit(blocking_job));
+        }
+    while (running.load() < before.num_threads)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    for (uint32_t i = 0; i + 1 < before.queue_depth_limit; i++)
+        {
+            ASSERT_TRUE(pool.submit(blocking_job));
+        }
+
+    // The calling thread runs all the tasks, and the helpers it asked for
+    // leave the last place in the queue to a dwell
+    std::atomic<uint32_t> total(0);
+    pool.run_tasks(16, [&total](uint32_t) { total++; });
+    EXPECT_EQ(total.load(), 16U);
+    Acq_Worker_Pool_Stats after = pool.get_stats();
+    EXPECT_EQ(after.jobs_submitted, before.jobs_submitted + before.num_threads + before.queue_depth_limit - 1);
+    EXPECT_EQ(after.jobs_rejected, before.jobs_rejected);
+    EXPECT_TRUE(pool.submit(blocking_job));
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        release = true;
+    }
+    cv.notify_all();
+    uint64_t expected = before.jobs_completed + before.num_threads + before.queue_depth_limit;
+    while (pool.get_stats().jobs_completed < expected)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    EXPECT_EQ(pool.get_stats().jobs_completed, expected);
+}
@@ -31,20 +31,27 @@
  */
 
 
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <glog/logging.h>
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/top_block.h>
 #include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "Galileo_E1.h"
 #include "acquisition_dump_reader.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
+#include "galileo_e1_signal_processing.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_sdr_valve.h"
@@ -362,3 +369,88 @@ TEST_F(GalileoE1PcpsAmbiguousAcquisitionTest, ValidationOfResults)
             plot_grid();
         }
 }
+
+
+TEST_F(GalileoE1PcpsAmbiguousAcquisitionTest, CombineDataPilot)
+{
+    // Data and pilot components of the same satellite, in noise, with a known
+    // code delay and Doppler
+    const int fs_in = 4000000;
+    const unsigned int samples_per_code = static_cast<unsigned int>(round(fs_in / (Galileo_E1_CODE_CHIP_RATE_HZ / Galileo_E1_B_CODE_LENGTH_CHIPS)));
+    const unsigned int expected_delay_samples = 5000;
+    const double expected_doppler_hz = 1500.0;
+    std::vector<gr_complex> code_data(samples_per_code);
+    std::vector<gr_complex> code_pilot(samples_per_code);
+    char signal_data[3] = "1B";
+    char signal_pilot[3] = "1C";
+    galileo_e1_code_gen_complex_sampled(code_data.data(), signal_data, false, 1, fs_in, 0, false);
+    galileo_e1_code_gen_complex_sampled(code_pilot.data(), signal_pilot, false, 1, fs_in, 0, false);
+    std::mt19937 generator(1234);
+    std::normal_distribution<float> noise(0.0, 4.0);
+    std::vector<gr_complex> samples(3 * samples_per_code);
+    for (size_t n = 0; n < samples.size(); n++)
+        {
+            size_t k = (n + samples_per_code - expected_delay_samples) % samples_per_code;
+            double phase = 2.0 * M_PI * expected_doppler_hz * static_cast<double>(n) / static_cast<double>(fs_in);
+            gr_complex carrier(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+            samples[n] = (code_data[k] - code_pilot[k]) * carrier / std::sqrt(2.0F) + gr_complex(noise(generator), noise(generator));
+        }
+
+    std::string data_str = "./tmp-acq-gal1-combine";
+    if (boost::filesystem::exists(data_str))
+        {
+            boost::filesystem::remove_all(data_str);
+        }
+    boost::filesystem::create_directory(data_str);
+
+    float test_statistics[2];
+    for (int combine = 0; combine < 2; combine++)
+        {
+            gnss_synchro = Gnss_Synchro();
+            init();
+            std::string dump_filename = data_str + (combine ? "/combined" : "/data");
+            config->set_property("Acquisition_1B.coherent_integration_time_ms", "4");
+            config->set_property("Acquisition_1B.doppler_max", "5000");
+            config->set_property("Acquisition_1B.use_CFAR_algorithm", "false");
+            config->set_property("Acquisition_1B.combine_data_pilot", combine ? "true" : "false");
+            config->set_property("Acquisition_1B.dump", "true");
+            config->set_property("Acquisition_1B.dump_filename", dump_filename);
+            {
+                top_block = gr::make_top_block("Acquisition test");
+                std::shared_ptr<GalileoE1PcpsAmbiguousAcquisition> acquisition = std::make_shared<GalileoE1PcpsAmbiguousAcquisition>(config.get(), "Acquisition_1B", 1, 0);
+                boost::shared_ptr<GalileoE1PcpsAmbiguousAcquisitionTest_msg_rx> msg_rx = GalileoE1PcpsAmbiguousAcquisitionTest_msg_rx_make();
+                acquisition->set_channel(gnss_synchro.Channel_ID);
+                acquisition->set_gnss_synchro(&gnss_synchro);
+                acquisition->set_threshold(1.5);
+                acquisition->set_doppler_max(5000);
+                acquisition->set_doppler_step(doppler_step);
+                acquisition->connect(top_block);
+                gr::blocks::vector_source_c::sptr source = gr::blocks::vector_source_c::make(samples, false);
+                top_block->connect(source, 0, acquisition->get_left_block(), 0);
+                top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+                acquisition->set_local_code();
+                acquisition->init();
+                acquisition->reset();
+                acquisition->set_state(1);
+                EXPECT_NO_THROW({
+                    top_block->run();  // Start threads and wait
+                }) << "Failure running the top_block.";
+                ASSERT_EQ(1, msg_rx->rx_message) << "Acquisition failure. Expected message: 1=ACQ SUCCESS.";
+                top_block.reset();  // the dump is complete once the block is destroyed
+            }
+
+            EXPECT_NEAR(gnss_synchro.Acq_delay_samples, expected_delay_samples, 1.0) << (combine ? "Combined" : "Data only");
+            EXPECT_NEAR(gnss_synchro.Acq_doppler_hz, expected_doppler_hz, doppler_step / 2.0) << (combine ? "Combined" : "Data only");
+
+            acquisition_dump_reader acq_dump(dump_filename + "_E_1B", gnss_synchro.PRN, 5000, doppler_step, samples_per_code);
+            ASSERT_TRUE(acq_dump.read_binary_acq()) << "Error reading the dump of " << dump_filename;
+            test_statistics[combine] = acq_dump.test_statistic;
+        }
+
+    // The pilot adds its energy to the data peak, while the noise of both
+    // components is averaged, so the combined peak stands out more
+    std::cout << "Test statistic, data only: " << test_statistics[0] << ", data and pilot: " << test_statistics[1] << std::endl;
+    EXPECT_GE(test_statistics[1], test_statistics[0]);
+
+    boost::filesystem::remove_all(data_str);
+}
@@ -37,12 +37,16 @@
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/top_block.h>
+#include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <utility>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
 #endif
 #include "GPS_L1_CA.h"
 #include "acquisition_dump_reader.h"
@@ -357,3 +361,101 @@ TEST_F(GpsL1CaPcpsAcquisitionTest, ValidationOfResults)
             plot_grid();
         }
 }
+
+
+TEST_F(GpsL1CaPcpsAcquisitionTest, FixedPointMultiDwellMatchesFloat)
+{
+    // Two dwells of the same signal, quantized to cshort with very different
+    // amplitudes, so that the fixed-point wipeoff scales each one differently
+    std::string file = std::string(TEST_PATH) + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+    std::ifstream input(file, std::ios::binary);
+    ASSERT_TRUE(input.is_open()) << "Cannot open " << file;
+    std::vector<gr_complex> samples(8000);
+    input.read(reinterpret_cast<char *>(samples.data()), samples.size() * sizeof(gr_complex));
+    ASSERT_EQ(static_cast<size_t>(input.gcount()), samples.size() * sizeof(gr_complex));
+    float peak = 0.0;
+    for (const auto &sample : samples)
+        {
+            peak = std::max(peak, std::max(std::abs(sample.real()), std::abs(sample.imag())));
+        }
+    // The last samples are only there to let the block run the second search
+    std::vector<int16_t> samples_sc(4 * samples.size(), 0);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            float gain = (i < 4000 ? 50.0F : 800.0F) / peak;
+            samples_sc[2 * i] = static_cast<int16_t>(std::round(samples[i].real() * gain));
+            samples_sc[2 * i + 1] = static_cast<int16_t>(std::round(samples[i].imag() * gain));
+        }
+
+    std::string data_str = "./tmp-acq-gps1-fixed-point";
+    if (boost::filesystem::exists(data_str))
+        {
+            boost::filesystem::remove_all(data_str);
+        }
+    boost::filesystem::create_directory(data_str);
+
+    std::vector<std::vector<float> > grids[2];
+    float test_statistics[2];
+    float input_powers[2];
+    for (int fixed_point = 0; fixed_point < 2; fixed_point++)
+        {
+            init();
+            std::string dump_filename = data_str + (fixed_point ? "/fixed" : "/float");
+            config->set_property("Acquisition_1C.item_type", "cshort");
+            config->set_property("Acquisition_1C.max_dwells", "2");
+            config->set_property("Acquisition_1C.use_CFAR_algorithm", "true");
+            config->set_property("Acquisition_1C.fixed_point_wipeoff", fixed_point ? "true" : "false");
+            config->set_property("Acquisition_1C.dump", "true");
+            config->set_property("Acquisition_1C.dump_filename", dump_filename);
+            {
+                top_block = gr::make_top_block("Acquisition test");
+                std::shared_ptr<GpsL1CaPcpsAcquisition> acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
+                boost::shared_ptr<GpsL1CaPcpsAcquisitionTest_msg_rx> msg_rx = GpsL1CaPcpsAcquisitionTest_msg_rx_make();
+                acquisition->set_channel(1);
+                acquisition->set_gnss_synchro(&gnss_synchro);
+                acquisition->set_threshold(1000.0);  // never reached, so both dwells are searched
+                acquisition->set_doppler_max(doppler_max);
+                acquisition->set_doppler_step(doppler_step);
+                acquisition->connect(top_block);
+                gr::blocks::vector_source_s::sptr source = gr::blocks::vector_source_s::make(samples_sc, false, 2);
+                top_block->connect(source, 0, acquisition->get_left_block(), 0);
+                top_block->msg_connect(acquisition->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+                acquisition->set_local_code();
+                acquisition->set_state(1);
+                acquisition->init();
+                EXPECT_NO_THROW({
+                    top_block->run();  // Start threads and wait
+                }) << "Failure running the top_block.";
+                EXPECT_EQ(2, msg_rx->rx_message) << "Expected message: 2=ACQ FAIL.";
+                top_block.reset();  // the dump is complete once the block is destroyed
+            }
+
+            auto samples_per_code = static_cast<unsigned int>(round(4000000 / (GPS_L1_CA_CODE_RATE_HZ / GPS_L1_CA_CODE_LENGTH_CHIPS)));
+            acquisition_dump_reader acq_dump(dump_filename + "_G_1C", gnss_synchro.PRN, doppler_max, doppler_step, samples_per_code, 1);
+            ASSERT_TRUE(acq_dump.read_binary_acq()) << "Error reading the dump of " << dump_filename;
+            EXPECT_EQ(2U, acq_dump.num_dwells);
+            grids[fixed_point] = acq_dump.mag;
+            test_statistics[fixed_point] = acq_dump.test_statistic;
+            input_powers[fixed_point] = acq_dump.input_power;
+        }
+
+    // The accumulated grids only differ by the rounding of the FFTs
+    ASSERT_EQ(grids[0].size(), grids[1].size());
+    float grid_peak = 0.0;
+    float max_error = 0.0;
+    for (size_t i = 0; i < grids[0].size(); i++)
+        {
+            ASSERT_EQ(grids[0][i].size(), grids[1][i].size());
+            for (size_t k = 0; k < grids[0][i].size(); k++)
+                {
+                    grid_peak = std::max(grid_peak, grids[0][i][k]);
+                    max_error = std::max(max_error, std::abs(grids[0][i][k] - grids[1][i][k]));
+                }
+        }
+    ASSERT_GT(grid_peak, 0.0);
+    EXPECT_LT(max_error / grid_peak, 1e-3) << "The fixed-point grid does not match the float one";
+    EXPECT_NEAR(test_statistics[0], test_statistics[1], 1e-3 * test_statistics[0]);
+    EXPECT_NEAR(input_powers[0], input_powers[1], 1e-3 * input_powers[0]);
+
+    boost::filesystem::remove_all(data_str);
+}
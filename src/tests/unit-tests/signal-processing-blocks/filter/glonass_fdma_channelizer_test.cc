@@ -0,0 +1,160 @@
+/*!
+ * \file glonass_fdma_channelizer_test.cc
+ * \brief Tests for the polyphase channelizer of the GLONASS FDMA sub-bands
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "glonass_fdma_channelizer.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace
+{
+const int64_t CHANNELIZER_TEST_FS = 9000000;  // 16 sub-bands of 562.5 kHz
+const double CHANNELIZER_TEST_SPACING_HZ = 562500.0;
+
+std::vector<std::complex<float>> make_tone(double freq_hz, uint32_t length)
+{
+    std::vector<std::complex<float>> tone(length);
+    for (uint32_t n = 0; n < length; n++)
+        {
+            double phase = 2.0 * M_PI * freq_hz * static_cast<double>(n) / static_cast<double>(CHANNELIZER_TEST_FS);
+            tone[n] = std::complex<float>(std::cos(phase), std::sin(phase));
+        }
+    return tone;
+}
+
+// Runs the channelizer over the whole input, in chunks of chunk_size samples
+std::vector<std::vector<std::complex<float>>> channelize(Glonass_Fdma_Channelizer& channelizer, const std::vector<std::complex<float>>& input, uint32_t chunk_size)
+{
+    std::vector<std::vector<std::complex<float>>> outputs(Glonass_Fdma_Channelizer::num_channels);
+    std::vector<std::vector<std::complex<float>>> chunk_out(Glonass_Fdma_Channelizer::num_channels, std::vector<std::complex<float>>(chunk_size));
+    std::vector<std::complex<float>*> out_ptrs;
+    for (auto& c : chunk_out)
+        {
+            out_ptrs.push_back(c.data());
+        }
+    for (uint32_t start = 0; start < input.size(); start += chunk_size)
+        {
+            uint32_t n = std::min(chunk_size, static_cast<uint32_t>(input.size()) - start);
+            uint32_t produced = channelizer.filter(input.data() + start, n, out_ptrs.data());
+            for (int32_t c = 0; c < Glonass_Fdma_Channelizer::num_channels; c++)
+                {
+                    outputs[c].insert(outputs[c].end(), chunk_out[c].begin(), chunk_out[c].begin() + produced);
+                }
+        }
+    return outputs;
+}
+}  // namespace
+
+
+TEST(GlonassFdmaChannelizerTest, RejectsUnsupportedRates)
+{
+    EXPECT_THROW(Glonass_Fdma_Channelizer(6625000, CHANNELIZER_TEST_SPACING_HZ), std::invalid_argument);  // not a multiple
+    EXPECT_THROW(Glonass_Fdma_Channelizer(6750000, CHANNELIZER_TEST_SPACING_HZ), std::invalid_argument);  // only 12 sub-bands
+    EXPECT_THROW(Glonass_Fdma_Channelizer(8437500, CHANNELIZER_TEST_SPACING_HZ), std::invalid_argument);  // odd number of sub-bands
+    Glonass_Fdma_Channelizer channelizer(CHANNELIZER_TEST_FS, CHANNELIZER_TEST_SPACING_HZ);
+    EXPECT_EQ(channelizer.branches(), 16U);
+    EXPECT_EQ(channelizer.decimation(), 8U);
+    EXPECT_EQ(Glonass_Fdma_Channelizer::output_rate(CHANNELIZER_TEST_SPACING_HZ), 1125000);
+}
+
+
+TEST(GlonassFdmaChannelizerTest, BringsEachSubBandToBaseband)
+{
+    const double offset_hz = 20000.0;
+    for (int32_t k = Glonass_Fdma_Channelizer::first_channel; k < Glonass_Fdma_Channelizer::first_channel + Glonass_Fdma_Channelizer::num_channels; k += 3)
+        {
+            Glonass_Fdma_Channelizer channelizer(CHANNELIZER_TEST_FS, CHANNELIZER_TEST_SPACING_HZ);
+            std::vector<std::complex<float>> input = make_tone(k * CHANNELIZER_TEST_SPACING_HZ + offset_hz, 40000);
+            auto outputs = channelize(channelizer, input, 4096);
+            const auto& own = outputs[k - Glonass_Fdma_Channelizer::first_channel];
+            // The first outputs are dropped to compensate the delay of the filter
+            ASSERT_EQ(own.size(), input.size() / channelizer.decimation() - channelizer.taps().size() / channelizer.branches());
+
+            // Past the filter transient, the sub-band holds the offset tone at unit amplitude
+            const double out_fs = static_cast<double>(Glonass_Fdma_Channelizer::output_rate(CHANNELIZER_TEST_SPACING_HZ));
+            for (size_t n = 200; n < own.size(); n += 97)
+                {
+                    double phase = 2.0 * M_PI * offset_hz * static_cast<double>(n) / out_fs;
+                    std::complex<float> expected(std::cos(phase), std::sin(phase));
+                    EXPECT_NEAR(std::abs(own[n] - expected), 0.0, 0.02) << "k=" << k << " n=" << n;
+                }
+
+            // Sub-bands far enough from the tone reject it
+            for (int32_t c = 0; c < Glonass_Fdma_Channelizer::num_channels; c++)
+                {
+                    if (std::abs(c + Glonass_Fdma_Channelizer::first_channel - k) >= 2)
+                        {
+                            EXPECT_LT(std::abs(outputs[c][outputs[c].size() / 2]), 0.01) << "k=" << k << " c=" << c;
+                        }
+                }
+        }
+}
+
+
+TEST(GlonassFdmaChannelizerTest, OutputDoesNotDependOnTheChunkSize)
+{
+    std::vector<std::complex<float>> input = make_tone(3.0 * CHANNELIZER_TEST_SPACING_HZ - 150000.0, 10000);
+    Glonass_Fdma_Channelizer whole(CHANNELIZER_TEST_FS, CHANNELIZER_TEST_SPACING_HZ);
+    Glonass_Fdma_Channelizer pieces(CHANNELIZER_TEST_FS, CHANNELIZER_TEST_SPACING_HZ);
+    auto a = channelize(whole, input, 10000);
+    auto b = channelize(pieces, input, 13);
+    for (int32_t c = 0; c < Glonass_Fdma_Channelizer::num_channels; c++)
+        {
+            ASSERT_EQ(a[c].size(), b[c].size());
+            for (size_t n = 0; n < a[c].size(); n++)
+                {
+                    EXPECT_NEAR(std::abs(a[c][n] - b[c][n]), 0.0, 1e-5);
+                }
+        }
+}
+
+
+TEST(GlonassFdmaChannelizerTest, CompensatesTheFilterDelay)
+{
+    // An impulse at input sample 40 * D shows up at output sample 40 of every sub-band
+    Glonass_Fdma_Channelizer channelizer(CHANNELIZER_TEST_FS, CHANNELIZER_TEST_SPACING_HZ);
+    std::vector<std::complex<float>> input(8000, std::complex<float>(0.0, 0.0));
+    input[40 * channelizer.decimation()] = std::complex<float>(1.0, 0.0);
+    auto outputs = channelize(channelizer, input, 1000);
+    for (int32_t c = 0; c < Glonass_Fdma_Channelizer::num_channels; c++)
+        {
+            size_t peak = 0;
+            for (size_t n = 1; n < outputs[c].size(); n++)
+                {
+                    if (std::abs(outputs[c][n]) > std::abs(outputs[c][peak]))
+                        {
+                            peak = n;
+                        }
+                }
+            EXPECT_EQ(peak, 40U) << "c=" << c;
+        }
+}
@@ -0,0 +1,170 @@
+/*!
+ * \file cpu_multicorrelator_batch_test.cc
+ * \brief Checks that the correlations computed in batches match those
+ * computed channel by channel
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "cpu_multicorrelator_batch.h"
+#include <gtest/gtest.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+TEST(CpuMulticorrelatorBatchTest, BatchMatchesSingleChannel)
+{
+    cpu_multicorrelator_batch::configure(4, 20000, 256, 0);
+    cpu_multicorrelator_batch& engine = cpu_multicorrelator_batch::instance();
+
+    const int num_channels = 6;
+    const int num_correlators = 3;
+    const int num_samples = 1000;
+    std::default_random_engine generator(17);
+    std::normal_distribution<float> noise(0.0, 1.0);
+
+    // All the channels read the same buffer, from different offsets
+    std::vector<std::complex<float>> buffer(num_samples + 64 * num_channels);
+    for (auto& sample : buffer)
+        {
+            sample = std::complex<float>(noise(generator), noise(generator));
+        }
+
+    std::vector<std::vector<std::vector<float>>> codes(num_channels, std::vector<std::vector<float>>(num_correlators, std::vector<float>(num_samples)));
+    std::vector<std::vector<const float*>> code_ptrs(num_channels, std::vector<const float*>(num_correlators));
+    std::vector<Batch_Correlation> requests(num_channels);
+    std::vector<std::vector<std::complex<float>>> batch_out(num_channels, std::vector<std::complex<float>>(num_correlators));
+    std::vector<std::vector<std::complex<float>>> single_out(num_channels, std::vector<std::complex<float>>(num_correlators));
+    for (int ch = 0; ch < num_channels; ch++)
+        {
+            for (int n = 0; n < num_correlators; n++)
+                {
+                    for (auto& chip : codes[ch][n])
+                        {
+                            chip = (noise(generator) > 0.0) ? 1.0 : -1.0;
+                        }
+                    code_ptrs[ch][n] = codes[ch][n].data();
+                }
+            requests[ch].sig_in = buffer.data() + 61 * ch;
+            requests[ch].local_codes = code_ptrs[ch].data();
+            requests[ch].corr_out = batch_out[ch].data();
+            requests[ch].rem_carrier_phase_rad = 0.3 * ch;
+            requests[ch].phase_step_rad = 0.01 + 0.002 * ch;
+            requests[ch].num_samples = num_samples - 7 * ch;
+            requests[ch].n_correlators = num_correlators;
+
+            lv_32fc_t phase_offset_as_complex[1];
+            phase_offset_as_complex[0] = lv_cmake(std::cos(static_cast<float>(requests[ch].rem_carrier_phase_rad)), -std::sin(static_cast<float>(requests[ch].rem_carrier_phase_rad)));
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(single_out[ch].data(), requests[ch].sig_in, std::exp(lv_32fc_t(0.0, -static_cast<float>(requests[ch].phase_step_rad))), phase_offset_as_complex, code_ptrs[ch].data(), num_correlators, requests[ch].num_samples);
+        }
+
+    std::vector<std::thread> channels;
+    for (int ch = 0; ch < num_channels; ch++)
+        {
+            channels.emplace_back([&engine, &requests, ch] { engine.correlate(requests[ch]); });
+        }
+    for (auto& channel : channels)
+        {
+            channel.join();
+        }
+
+    for (int ch = 0; ch < num_channels; ch++)
+        {
+            for (int n = 0; n < num_correlators; n++)
+                {
+                    float tolerance = 1e-3 * std::abs(single_out[ch][n]) + 1e-2;
+                    EXPECT_NEAR(batch_out[ch][n].real(), single_out[ch][n].real(), tolerance) << "channel " << ch << ", correlator " << n;
+                    EXPECT_NEAR(batch_out[ch][n].imag(), single_out[ch][n].imag(), tolerance) << "channel " << ch << ", correlator " << n;
+                }
+        }
+}
+
+
+TEST(CpuMulticorrelatorBatchTest, SingleChannelDoesNotWaitForOthers)
+{
+    const uint32_t gather_us = 20000;
+    cpu_multicorrelator_batch::configure(4, gather_us, 256, 0);
+    cpu_multicorrelator_batch& engine = cpu_multicorrelator_batch::instance();
+
+    const int num_correlators = 3;
+    const int num_samples = 1000;
+    const int num_requests = 20;
+    std::default_random_engine generator(23);
+    std::normal_distribution<float> noise(0.0, 1.0);
+
+    std::vector<std::complex<float>> buffer(num_samples);
+    for (auto& sample : buffer)
+        {
+            sample = std::complex<float>(noise(generator), noise(generator));
+        }
+    std::vector<std::vector<float>> codes(num_correlators, std::vector<float>(num_samples));
+    std::vector<const float*> code_ptrs(num_correlators);
+    for (int n = 0; n < num_correlators; n++)
+        {
+            for (auto& chip : codes[n])
+                {
+                    chip = (noise(generator) > 0.0) ? 1.0 : -1.0;
+                }
+            code_ptrs[n] = codes[n].data();
+        }
+
+    std::vector<std::complex<float>> batch_out(num_correlators);
+    std::vector<std::complex<float>> single_out(num_correlators);
+    Batch_Correlation request;
+    request.sig_in = buffer.data();
+    request.local_codes = code_ptrs.data();
+    request.corr_out = batch_out.data();
+    request.phase_step_rad = 0.02;
+    request.num_samples = num_samples;
+    request.n_correlators = num_correlators;
+
+    // Once the engine has seen a batch of a single request closing on time
+    // out, the next ones are computed without waiting the gathering time
+    std::chrono::time_point<std::chrono::system_clock> start, end;
+    start = std::chrono::system_clock::now();
+    for (int i = 0; i < num_requests; i++)
+        {
+            request.rem_carrier_phase_rad = 0.1 * i;
+            engine.correlate(request);
+
+            lv_32fc_t phase_offset_as_complex[1];
+            phase_offset_as_complex[0] = lv_cmake(std::cos(static_cast<float>(request.rem_carrier_phase_rad)), -std::sin(static_cast<float>(request.rem_carrier_phase_rad)));
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(single_out.data(), request.sig_in, std::exp(lv_32fc_t(0.0, -static_cast<float>(request.phase_step_rad))), phase_offset_as_complex, code_ptrs.data(), num_correlators, num_samples);
+            for (int n = 0; n < num_correlators; n++)
+                {
+                    float tolerance = 1e-3 * std::abs(single_out[n]) + 1e-2;
+                    EXPECT_NEAR(batch_out[n].real(), single_out[n].real(), tolerance) << "request " << i << ", correlator " << n;
+                    EXPECT_NEAR(batch_out[n].imag(), single_out[n].imag(), tolerance) << "request " << i << ", correlator " << n;
+                }
+        }
+    end = std::chrono::system_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    EXPECT_LT(elapsed_seconds.count(), 5.0 * static_cast<double>(gather_us) * 1e-6);
+}
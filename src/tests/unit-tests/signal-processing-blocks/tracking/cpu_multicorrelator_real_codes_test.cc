@@ -36,10 +36,13 @@
 #include <gnuradio/gr_complex.h>
 #include <gtest/gtest.h>
 #include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <complex>
 #include <random>
 #include <thread>
+#include <vector>
 
 
 DEFINE_int32(cpu_multicorrelator_real_codes_iterations_test, 100, "Number of averaged iterations in CPU multicorrelator test timing test");
@@ -172,3 +175,126 @@ TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTime)
             correlator_pool[n]->free();
         }
 }
+
+
+TEST(CpuMulticorrelatorRealCodesTest, SharedReplicaMatchesPerTapCodes)
+{
+    const int code_length_chips = 1023;
+    const int num_samples = 4000;
+    const int num_taps = 5;
+    std::default_random_engine generator(23);
+    std::normal_distribution<float> noise(0.0, 1.0);
+
+    std::vector<float> code(code_length_chips);
+    for (auto& chip : code)
+        {
+            chip = (noise(generator) > 0.0) ? 1.0 : -1.0;
+        }
+    // Very early, early, prompt, late and very late taps
+    std::vector<float> shifts_chips = {-1.0, -0.5, 0.0, 0.5, 1.0};
+    const float rem_carrier_phase_rad = 0.2;
+    const float carrier_phase_step_rad = 0.01;
+    const float rem_code_phase_chips = 0.37;
+
+    // Code-modulated carrier in noise, delayed by a tenth of a chip
+    std::vector<std::complex<float>> signal(num_samples);
+    for (int n = 0; n < num_samples; n++)
+        {
+            float carrier_phase = rem_carrier_phase_rad + carrier_phase_step_rad * static_cast<float>(n);
+            float code_phase = rem_code_phase_chips - 0.1 + 0.3 * static_cast<float>(n);
+            float chip = code[static_cast<int>(std::floor(code_phase)) % code_length_chips];
+            signal[n] = chip * std::complex<float>(std::cos(carrier_phase), std::sin(carrier_phase)) + std::complex<float>(noise(generator), noise(generator));
+        }
+
+    auto correlate = [&](bool shared_replica, bool fractional_correction, float code_phase_step_chips) {
+        std::vector<std::complex<float>> corr_out(num_taps);
+        cpu_multicorrelator_real_codes correlator;
+        correlator.set_high_dynamics_resampler(false);
+        correlator.set_shared_replica(shared_replica, fractional_correction);
+        correlator.init(num_samples, num_taps);
+        correlator.set_input_output_vectors(corr_out.data(), signal.data());
+        correlator.set_local_code_and_taps(code_length_chips, code.data(), shifts_chips.data());
+        correlator.Carrier_wipeoff_multicorrelator_resampler(rem_carrier_phase_rad, carrier_phase_step_rad, rem_code_phase_chips, code_phase_step_chips, 0.0, num_samples);
+        correlator.free();
+        return corr_out;
+    };
+    auto max_error = [](const std::vector<std::complex<float>>& a, const std::vector<std::complex<float>>& b) {
+        float error = 0.0;
+        for (unsigned int n = 0; n < a.size(); n++)
+            {
+                error = std::max(error, std::abs(a[n] - b[n]));
+            }
+        return error;
+    };
+
+    // Taps half a chip apart at 4 samples per chip fall on whole samples
+    std::vector<std::complex<float>> per_tap = correlate(false, false, 0.25);
+    std::vector<std::complex<float>> shared = correlate(true, false, 0.25);
+    EXPECT_LT(max_error(shared, per_tap), 1e-3 * std::abs(per_tap[2]));
+
+    // At 3.33 samples per chip they do not, and the fractional correction
+    // must get closer to the exact taps than the rounding to whole samples.
+    // Its error, largest next to the corners of the correlation triangle,
+    // stays a small fraction of the correlation peak.
+    per_tap = correlate(false, false, 0.3);
+    std::vector<std::complex<float>> rounded = correlate(true, false, 0.3);
+    std::vector<std::complex<float>> interpolated = correlate(true, true, 0.3);
+    float peak = 0.0;
+    for (const auto& corr : per_tap)
+        {
+            peak = std::max(peak, std::abs(corr));
+        }
+    EXPECT_LT(max_error(interpolated, per_tap), max_error(rounded, per_tap));
+    EXPECT_LT(max_error(interpolated, per_tap), 0.05 * peak);
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, SharedReplicaKeepsEarlyLateSymmetric)
+{
+    const int code_length_chips = 1023;
+    const int num_samples = 2600;
+    const int num_taps = 3;
+    std::default_random_engine generator(29);
+    std::normal_distribution<float> noise(0.0, 1.0);
+
+    std::vector<float> code(code_length_chips);
+    for (auto& chip : code)
+        {
+            chip = (noise(generator) > 0.0) ? 1.0 : -1.0;
+        }
+    std::vector<float> shifts_chips = {-0.5, 0.0, 0.5};
+    const float rem_carrier_phase_rad = 0.2;
+    const float carrier_phase_step_rad = 0.01;
+    const float rem_code_phase_chips = 0.37;
+    // 2.6 Msps is not a whole multiple of the chip rate, so the early and
+    // late taps fall between samples
+    const float code_phase_step_chips = 1.023e6 / 2.6e6;
+
+    // Code-modulated carrier aligned with the prompt tap
+    std::vector<float> per_tap_code(num_samples);
+    std::vector<float*> per_tap_codes = {per_tap_code.data()};
+    float prompt_shift_chips = 0.0;
+    volk_gnsssdr_32f_xn_resampler_32f_xn(per_tap_codes.data(), code.data(), rem_code_phase_chips, code_phase_step_chips, &prompt_shift_chips, code_length_chips, 1, num_samples);
+    std::vector<std::complex<float>> signal(num_samples);
+    for (int n = 0; n < num_samples; n++)
+        {
+            float carrier_phase = rem_carrier_phase_rad + carrier_phase_step_rad * static_cast<float>(n);
+            signal[n] = per_tap_code[n] * std::complex<float>(std::cos(carrier_phase), std::sin(carrier_phase));
+        }
+
+    std::vector<std::complex<float>> corr_out(num_taps);
+    cpu_multicorrelator_real_codes correlator;
+    correlator.set_high_dynamics_resampler(false);
+    correlator.set_shared_replica(true, false);
+    correlator.init(num_samples, num_taps);
+    correlator.set_input_output_vectors(corr_out.data(), signal.data());
+    correlator.set_local_code_and_taps(code_length_chips, code.data(), shifts_chips.data());
+    correlator.Carrier_wipeoff_multicorrelator_resampler(rem_carrier_phase_rad, carrier_phase_step_rad, rem_code_phase_chips, code_phase_step_chips, 0.0, num_samples);
+    correlator.free();
+
+    // The prompt tap is read without rounding, and the early and late taps
+    // are rounded to the same number of samples on each side of it
+    EXPECT_NEAR(std::abs(corr_out[1]), static_cast<float>(num_samples), 1e-3 * num_samples);
+    EXPECT_NEAR(std::abs(corr_out[0]), std::abs(corr_out[2]), 0.01 * std::abs(corr_out[1]));
+    EXPECT_LT(std::abs(corr_out[0]), std::abs(corr_out[1]));
+}
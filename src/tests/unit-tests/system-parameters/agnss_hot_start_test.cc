@@ -0,0 +1,149 @@
+/*!
+ * \file agnss_hot_start_test.cc
+ * \brief Tests for the channel states kept across receiver restarts
+ *
+ * -------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2018  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * GNSS-SDR is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GNSS-SDR is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNSS-SDR. If not, see <https://www.gnu.org/licenses/>.
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "agnss_hot_start.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_frequencies.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+namespace
+{
+Agnss_Hot_Start_Channel make_channel(char system, const char* signal, uint32_t prn, double doppler_hz)
+{
+    Agnss_Hot_Start_Channel channel;
+    channel.system = system;
+    channel.signal[0] = signal[0];
+    channel.signal[1] = signal[1];
+    channel.prn = prn;
+    channel.doppler_hz = doppler_hz;
+    channel.code_phase_s = 1e-7;
+    channel.sample_stamp = 4000000ULL;
+    channel.fs = 4000000LL;
+    channel.cn0_db_hz = 45.0;
+    return channel;
+}
+}  // namespace
+
+
+TEST(AgnssHotStartTest, SaveAndLoad)
+{
+    const std::string file_name = "./agnss_hot_start_test.bin";
+    Agnss_Hot_Start saved;
+    saved.save_time_s = 1.5e9;
+    saved.session_time_s = 1.0;
+    saved.position_valid = true;
+    saved.position_ecef_m[0] = 4.8e6;
+    saved.position_ecef_m[1] = 1.7e5;
+    saved.position_ecef_m[2] = 4.1e6;
+    saved.clock_drift_valid = true;
+    saved.clock_drift_ppm = -0.35;
+    saved.channels.push_back(make_channel('G', "1C", 7, 1234.5));
+    saved.channels.push_back(make_channel('E', "1B", 11, -2500.0));
+    ASSERT_TRUE(saved.save(file_name));
+
+    Agnss_Hot_Start loaded;
+    ASSERT_TRUE(loaded.load(file_name));
+    std::remove(file_name.c_str());
+    EXPECT_DOUBLE_EQ(saved.save_time_s, loaded.save_time_s);
+    EXPECT_DOUBLE_EQ(saved.session_time_s, loaded.session_time_s);
+    EXPECT_TRUE(loaded.position_valid);
+    EXPECT_DOUBLE_EQ(saved.position_ecef_m[2], loaded.position_ecef_m[2]);
+    EXPECT_TRUE(loaded.clock_drift_valid);
+    EXPECT_DOUBLE_EQ(saved.clock_drift_ppm, loaded.clock_drift_ppm);
+    ASSERT_EQ(saved.channels.size(), loaded.channels.size());
+    for (size_t i = 0; i < saved.channels.size(); i++)
+        {
+            EXPECT_EQ(saved.channels[i].system, loaded.channels[i].system);
+            EXPECT_EQ(std::string(saved.channels[i].signal), std::string(loaded.channels[i].signal));
+            EXPECT_EQ(saved.channels[i].prn, loaded.channels[i].prn);
+            EXPECT_DOUBLE_EQ(saved.channels[i].doppler_hz, loaded.channels[i].doppler_hz);
+            EXPECT_DOUBLE_EQ(saved.channels[i].code_phase_s, loaded.channels[i].code_phase_s);
+            EXPECT_EQ(saved.channels[i].sample_stamp, loaded.channels[i].sample_stamp);
+            EXPECT_EQ(saved.channels[i].fs, loaded.channels[i].fs);
+            EXPECT_DOUBLE_EQ(saved.channels[i].cn0_db_hz, loaded.channels[i].cn0_db_hz);
+        }
+}
+
+
+TEST(AgnssHotStartTest, RejectsInvalidFiles)
+{
+    const std::string file_name = "./agnss_hot_start_test.bin";
+    Agnss_Hot_Start hot_start;
+    EXPECT_FALSE(hot_start.load("./this_file_does_not_exist.bin"));
+
+    std::ofstream ofs(file_name.c_str(), std::ofstream::binary | std::ofstream::trunc);
+    ofs << "This is not a hot start file";
+    ofs.close();
+    EXPECT_FALSE(hot_start.load(file_name));
+
+    // A truncated file leaves the object empty
+    Agnss_Hot_Start saved;
+    saved.channels.push_back(make_channel('G', "1C", 7, 1234.5));
+    ASSERT_TRUE(saved.save(file_name));
+    std::ifstream ifs(file_name.c_str(), std::ifstream::binary);
+    std::string contents((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ifs.close();
+    std::ofstream truncated(file_name.c_str(), std::ofstream::binary | std::ofstream::trunc);
+    truncated.write(contents.data(), contents.size() - 4);
+    truncated.close();
+    EXPECT_FALSE(hot_start.load(file_name));
+    EXPECT_TRUE(hot_start.channels.empty());
+    std::remove(file_name.c_str());
+}
+
+
+TEST(AgnssHotStartTest, Extrapolation)
+{
+    Agnss_Hot_Start hot_start;
+    hot_start.session_time_s = 1.5;
+    Agnss_Hot_Start_Channel channel = make_channel('G', "1C", 7, 1000.0);
+
+    // An approaching satellite has a positive Doppler and a decreasing range
+    double range_rate = Agnss_Hot_Start::range_rate_m_s(channel);
+    EXPECT_NEAR(-1000.0 * SPEED_OF_LIGHT / FREQ1, range_rate, 1e-9);
+    EXPECT_EQ(0.0, Agnss_Hot_Start::range_rate_m_s(make_channel('R', "1G", 3, 1000.0)));
+
+    // The channel stamp is 0.5 s before the saved epoch, which is 2 s before the restart
+    double elapsed = 2.0;
+    EXPECT_DOUBLE_EQ(2.5, hot_start.extrapolation_time_s(channel, elapsed));
+    double expected = channel.code_phase_s - 2.5 + 2.5 * range_rate / SPEED_OF_LIGHT;
+    EXPECT_NEAR(expected, hot_start.code_phase_s(channel, elapsed), 1e-12);
+
+    // With no Doppler the code epochs keep their position modulo the code period
+    channel.doppler_hz = 0.0;
+    double code_phase = hot_start.code_phase_s(channel, elapsed);
+    double period = 1e-3;
+    EXPECT_NEAR(channel.code_phase_s, code_phase - period * std::floor(code_phase / period), 1e-12);
+}